@@ -0,0 +1,18 @@
+# Headless benchmark of the editor (offscreen platform):
+#   qmake Benchmark/Benchmark.pro && make && ./goedit-bench --output bench.json
+# Options: ./goedit-bench --help
+
+include(../Goedit.pri)
+
+TARGET = goedit-bench
+
+SOURCES += \
+    Corpus.cpp \
+    EditorBench.cpp \
+    Runner.cpp \
+    main.cpp
+
+HEADERS += \
+    Corpus.h \
+    EditorBench.h \
+    Runner.h
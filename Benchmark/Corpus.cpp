@@ -0,0 +1,184 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Corpus.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDir>
+#include <QFile>
+#include <QDebug>
+#include "Corpus.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static const char* const Words[] = {
+    "buffer", "cursor", "index", "token", "parser", "writer", "reader", "state",
+    "config", "client", "server", "request", "result", "handler", "cache", "entry",
+    "node", "tree", "queue", "stream", "packet", "frame", "record", "symbol"
+};
+static constexpr int WordCount = int(sizeof(Words) / sizeof(Words[0]));
+
+//*******************************************************************
+//                              Corpus                          CTOR
+//*******************************************************************
+Corpus::Corpus(const unsigned seed)
+    : _random(seed)
+    , _counter(0)
+{}
+
+/********************************************************************
+*                             generate                       public *
+*-------------------------------------------------------------------*
+* Writes the module into the directory 'root' (created if needed):  *
+* go.mod and 'packages' directories with 'files' files each.        *
+********************************************************************/
+bool Corpus::generate(const QString& root, const Size& size) {
+    if (!QDir().mkpath(root)) {
+        qWarning() << "Corpus: can't create" << root;
+        return false;
+    }
+    QFile mod(root + "/go.mod");
+    if (!mod.open(QIODevice::WriteOnly)) {
+        qWarning() << "Corpus: can't write" << mod.fileName();
+        return false;
+    }
+    mod.write("module example.com/bench\n\ngo 1.21\n");
+    mod.close();
+
+    for (int p = 0; p < size.packages; p++) {
+        const QString package = QString("pkg%1").arg(p);
+        if (!QDir(root).mkpath(package)) {
+            qWarning() << "Corpus: can't create" << root + '/' + package;
+            return false;
+        }
+        for (int f = 0; f < size.files; f++) {
+            const QString path = QString("%1/%2/file%3.go").arg(root, package).arg(f);
+            if (!writeFile(path, package, size.lines)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/********************************************************************
+*                             writeFile                      public *
+********************************************************************/
+bool Corpus::writeFile(const QString& path, const QString& package, const int lines) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Corpus: can't write" << path;
+        return false;
+    }
+    file.write(source(package, lines).toUtf8());
+    return true;
+}
+
+/********************************************************************
+*                              source                        public *
+*-------------------------------------------------------------------*
+* Go file of the package with at least 'lines' lines.               *
+********************************************************************/
+QString Corpus::source(const QString& package, const int lines) {
+    QString text = QString("// Code generated for the Goedit benchmark. DO NOT EDIT.\n\n"
+                           "package %1\n\nimport (\n\t\"fmt\"\n\t\"strings\"\n)\n").arg(package);
+    int count = text.count('\n');
+    while (count < lines) {
+        const QString name = identifier("T");
+        const QString chunk = below(3) ? function(name) : type(name);
+        text += chunk;
+        count += chunk.count('\n');
+    }
+    return text;
+}
+
+/********************************************************************
+*                             function                      private *
+********************************************************************/
+QString Corpus::function(const QString& name) {
+    const QString arg = identifier("");
+    QString text = QString("\n// %1 processes the %2 and reports how many items were seen.\n"
+                           "func %1(%2 []string, limit int) (int, error) {\n"
+                           "\tcount := 0\n").arg(name, arg);
+    const int steps = 2 + below(6);
+    for (int i = 0; i < steps; i++) {
+        const QString var = identifier("");
+        switch (below(4)) {
+        case 0:
+            text += QString("\tfor i, %1 := range %2 {\n"
+                            "\t\tif strings.HasPrefix(%1, \"%3\") && i < limit {\n"
+                            "\t\t\tcount++\n\t\t}\n\t}\n").arg(var, arg, Words[below(WordCount)]);
+            break;
+        case 1:
+            text += QString("\t%1 := fmt.Sprintf(\"%2-%d\", count)\n"
+                            "\tif len(%1) > %3 {\n\t\treturn count, fmt.Errorf(\"%1 too long: %s\", %1)\n\t}\n")
+                        .arg(var, Words[below(WordCount)]).arg(below(1000));
+            break;
+        case 2:
+            text += QString("\t/* %1 is rebuilt from scratch,\n\t   it is cheaper than an update. */\n"
+                            "\t%1 := make(map[string]int, %2)\n\tcount += len(%1)\n").arg(var).arg(below(64));
+            break;
+        default:
+            text += QString("\tswitch count % %1 {\n\tcase 0:\n\t\tcount += %2\n\tdefault:\n\t\tcount--\n\t}\n")
+                        .arg(2 + below(7)).arg(below(100));
+        }
+    }
+    text += "\treturn count, nil\n}\n";
+    return text;
+}
+
+/********************************************************************
+*                               type                        private *
+********************************************************************/
+QString Corpus::type(const QString& name) {
+    QString text = QString("\n// %1 holds the state of one %2.\ntype %1 struct {\n").arg(name, Words[below(WordCount)]);
+    const int fields = 2 + below(6);
+    for (int i = 0; i < fields; i++) {
+        static const char* const Types[] = {"int", "string", "[]byte", "map[string]int", "*strings.Builder", "float64"};
+        text += QString("\t%1 %2\n").arg(identifier("")).arg(Types[below(6)]);
+    }
+    text += QString("}\n\n// String implements fmt.Stringer.\n"
+                    "func (x *%1) String() string {\n\treturn fmt.Sprintf(\"%1{%p}\", x)\n}\n").arg(name);
+    return text;
+}
+
+/********************************************************************
+*                            identifier                     private *
+*-------------------------------------------------------------------*
+* Unique identifier made of a word; 'prefix' "T" makes it exported. *
+********************************************************************/
+QString Corpus::identifier(const char* prefix) {
+    QString word = Words[below(WordCount)];
+    if (*prefix) {
+        word[0] = word[0].toUpper();
+    }
+    return word + QString::number(++_counter);
+}
+
+/********************************************************************
+*                               below                       private *
+********************************************************************/
+int Corpus::below(const int n) {
+    return int(_random() % unsigned(n));
+}
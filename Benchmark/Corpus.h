@@ -0,0 +1,64 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Corpus.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_CORPUS_H
+#define GOEDIT_CORPUS_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <random>
+
+/********************************************************************
+*                              Corpus                               *
+*-------------------------------------------------------------------*
+* Synthetic Go sources for the benchmark: a module with packages of *
+* files of the requested length. The code is plausible (types,      *
+* methods, loops, literals, comments) so the lexer, the indexes and *
+* the layout do realistic work. Same seed, same corpus.             *
+********************************************************************/
+class Corpus {
+    std::mt19937 _random;
+    int _counter;
+public:
+    struct Size {
+        int packages;
+        int files;      // per package
+        int lines;      // per file
+    };
+
+    explicit Corpus(const unsigned = 1);
+
+    bool generate(const QString&, const Size&);
+    bool writeFile(const QString&, const QString&, const int);
+    QString source(const QString&, const int);
+
+private:
+    QString function(const QString&);
+    QString type(const QString&);
+    QString identifier(const char*);
+    int below(const int);
+};
+
+#endif // GOEDIT_CORPUS_H
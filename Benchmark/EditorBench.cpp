@@ -0,0 +1,258 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : EditorBench.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QApplication>
+#include <QPlainTextEdit>
+#include <QScrollBar>
+#include <QKeyEvent>
+#include <QEventLoop>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QDebug>
+#include "EditorBench.h"
+#include "Runner.h"
+#include "MainWindow.h"
+#include "Workspace/Workspace.h"
+#include "Workspace/Buffer.h"
+#include "Project/Project.h"
+#include "Project/TrigramIndex.h"
+#include "Bottomkick/SearchTab.h"
+
+//*******************************************************************
+//                            EditorBench                       CTOR
+//*******************************************************************
+EditorBench::EditorBench(MainWindow& window, Runner& runner, const QString& root)
+    : _window(window)
+    , _runner(runner)
+    , _root(root)
+    , _workspace(nullptr)
+    , _project(nullptr)
+    , _searchTab(nullptr)
+{}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Shows the window and waits for the second stage of the startup    *
+* (docks are created there).                                        *
+********************************************************************/
+bool EditorBench::start() {
+    _window.resize(1280, 800);
+    _window.show();
+
+    QElapsedTimer timer;
+    timer.start();
+    while (!_window.findChild<SearchTab*>() && timer.elapsed() < TimeoutMs) {
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents, 50);
+    }
+    _workspace = _window.findChild<Workspace*>();
+    _project = _window.findChild<Project*>();
+    _searchTab = _window.findChild<SearchTab*>();
+    if (!_workspace || !_project || !_searchTab) {
+        qWarning() << "EditorBench: the main window is not complete";
+        return false;
+    }
+    settle();
+    return true;
+}
+
+/********************************************************************
+*                            openProject                     public *
+*-------------------------------------------------------------------*
+* Opening ends when the full-text index reports its first update.   *
+********************************************************************/
+void EditorBench::openProject(const int iterations) {
+    _runner.run("project open", iterations, [this](int) {
+        _project->close();
+        QEventLoop loop;
+        QObject::connect(_project->trigramIndex(), &TrigramIndex::updated, &loop, &QEventLoop::quit);
+        QTimer::singleShot(TimeoutMs, &loop, &QEventLoop::quit);
+        if (_project->open(_root)) {
+            loop.exec();
+        }
+    });
+    settle();
+}
+
+/********************************************************************
+*                             openFiles                      public *
+********************************************************************/
+void EditorBench::openFiles(const QStringList& paths) {
+    _runner.run("open file", paths.size(), [this, &paths](const int i) {
+        if (Buffer* const buffer = _workspace->open(paths[i]); buffer) {
+            buffer->widget()->repaint();
+        }
+    });
+    settle();
+}
+
+/********************************************************************
+*                              scroll                        public *
+*-------------------------------------------------------------------*
+* Page by page, from the top to the bottom and again.               *
+********************************************************************/
+void EditorBench::scroll(const QString& path, const int iterations) {
+    QPlainTextEdit* const edit = editor(path);
+    if (!edit) {
+        return;
+    }
+    QScrollBar* const bar = edit->verticalScrollBar();
+    _runner.run("scroll page", iterations, [edit, bar](const int i) {
+        const int span = qMax(1, bar->maximum());
+        bar->setValue((i * bar->pageStep()) % span);
+        repaint(edit);
+    });
+}
+
+/********************************************************************
+*                               type                         public *
+*-------------------------------------------------------------------*
+* Keystrokes in the middle of the file: identifiers, spaces and new *
+* lines, so completion and the minimap react as for a user.         *
+********************************************************************/
+void EditorBench::type(const QString& path, const int iterations) {
+    QPlainTextEdit* const edit = editor(path);
+    if (!edit) {
+        return;
+    }
+    dynamic_cast<Buffer*>(edit)->gotoPosition(edit->blockCount() / 2, 0);
+    static const QString Text = "count := strings.TrimSpace(value)\n";
+
+    _runner.run("type key", iterations, [edit](const int i) {
+        const QChar ch = Text[i % Text.size()];
+        const int key = (ch == '\n') ? int(Qt::Key_Return) : int(ch.toUpper().unicode());
+        QKeyEvent press(QEvent::KeyPress, key, Qt::NoModifier, (ch == '\n') ? QString("\r") : QString(ch));
+        QKeyEvent release(QEvent::KeyRelease, key, Qt::NoModifier);
+        QCoreApplication::sendEvent(edit, &press);
+        QCoreApplication::sendEvent(edit, &release);
+        repaint(edit);
+    });
+}
+
+/********************************************************************
+*                             gotoLine                       public *
+********************************************************************/
+void EditorBench::gotoLine(const QString& path, const int iterations) {
+    QPlainTextEdit* const edit = editor(path);
+    if (!edit) {
+        return;
+    }
+    Buffer* const buffer = dynamic_cast<Buffer*>(edit);
+    _runner.run("goto line", iterations, [edit, buffer](const int i) {
+        // Lines spread over the whole file, not in order.
+        const int line = int((qint64(i) * 7919) % qMax(1, edit->blockCount()));
+        buffer->gotoPosition(line, 0);
+        repaint(edit);
+    });
+}
+
+/********************************************************************
+*                               save                         public *
+*-------------------------------------------------------------------*
+* Every save follows a small edit, so the file is really written.   *
+********************************************************************/
+void EditorBench::save(const QString& path, const int iterations) {
+    QPlainTextEdit* const edit = editor(path);
+    if (!edit) {
+        return;
+    }
+    Buffer* const buffer = dynamic_cast<Buffer*>(edit);
+    _runner.run("save", iterations, [this, edit, buffer](int) {
+        edit->textCursor().insertText(" ");
+        _workspace->save(buffer);
+        settle();
+    });
+}
+
+/********************************************************************
+*                               find                         public *
+*-------------------------------------------------------------------*
+* Search in the project as Tools/Find does it, with the results     *
+* shown in the search pane.                                         *
+********************************************************************/
+void EditorBench::find(const QStringList& words, const int iterations) {
+    _runner.run("find in project", iterations, [this, &words](const int i) {
+        const TrigramIndex::Query query{words[i % words.size()], false, false};
+        const auto hits = _project->trigramIndex()->search(query, FloodHits);
+        _searchTab->setResults(query.text, hits, 0);
+        _searchTab->repaint();
+    });
+}
+
+/********************************************************************
+*                               flood                        public *
+*-------------------------------------------------------------------*
+* The biggest output the application shows at once: results of a    *
+* search filled up to the limit of hits, again and again.           *
+********************************************************************/
+void EditorBench::flood(const int iterations) {
+    QVector<TrigramIndex::Hit> hits;
+    hits.reserve(FloodHits);
+    for (int i = 0; i < FloodHits; i++) {
+        hits.append({QString("pkg%1/file%2.go").arg(i % 17).arg(i % 101), i, 4, 8,
+                     QString("\tcount += len(buffer%1) // output line %1").arg(i)});
+    }
+    _runner.run("output flood", iterations, [this, &hits](int) {
+        _searchTab->setResults("flood", hits, 0);
+        _searchTab->repaint();
+    });
+}
+
+/********************************************************************
+*                              editor                       private *
+*-------------------------------------------------------------------*
+* Opens the file (if needed) and returns its editor.                *
+********************************************************************/
+QPlainTextEdit* EditorBench::editor(const QString& path) {
+    Buffer* const buffer = _workspace->open(path);
+    auto const edit = buffer ? qobject_cast<QPlainTextEdit*>(buffer->widget()) : nullptr;
+    if (!edit) {
+        qWarning() << "EditorBench: no editor for" << path;
+        return nullptr;
+    }
+    settle();
+    return edit;
+}
+
+/********************************************************************
+*                              repaint               private static *
+*-------------------------------------------------------------------*
+* Delivers posted events and paints the editor synchronously, so    *
+* the time of an operation includes its layout and painting.        *
+********************************************************************/
+void EditorBench::repaint(QPlainTextEdit* edit) {
+    QCoreApplication::processEvents();
+    edit->viewport()->repaint();
+}
+
+/********************************************************************
+*                              settle                private static *
+********************************************************************/
+void EditorBench::settle() {
+    QCoreApplication::sendPostedEvents();
+    QCoreApplication::processEvents();
+}
@@ -0,0 +1,80 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : EditorBench.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_EDITOR_BENCH_H
+#define GOEDIT_EDITOR_BENCH_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <QStringList>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class MainWindow;
+class Workspace;
+class Project;
+class SearchTab;
+class Buffer;
+class QPlainTextEdit;
+class Runner;
+
+/********************************************************************
+*                            EditorBench                            *
+*-------------------------------------------------------------------*
+* Cases of the benchmark. They drive a real MainWindow through the  *
+* components its actions use (the actions themselves open modal     *
+* dialogs) and every operation is timed up to the end of the        *
+* repaint it causes.                                                *
+********************************************************************/
+class EditorBench {
+    static constexpr int TimeoutMs = 120000;
+    static constexpr int FloodHits = 2000;
+
+    MainWindow& _window;
+    Runner& _runner;
+    const QString _root;
+    Workspace* _workspace;
+    Project* _project;
+    SearchTab* _searchTab;
+public:
+    EditorBench(MainWindow&, Runner&, const QString&);
+
+    bool start();
+    void openProject(const int);
+    void openFiles(const QStringList&);
+    void scroll(const QString&, const int);
+    void type(const QString&, const int);
+    void gotoLine(const QString&, const int);
+    void save(const QString&, const int);
+    void find(const QStringList&, const int);
+    void flood(const int);
+
+private:
+    QPlainTextEdit* editor(const QString&);
+    static void repaint(QPlainTextEdit*);
+    static void settle();
+};
+
+#endif // GOEDIT_EDITOR_BENCH_H
@@ -0,0 +1,119 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Runner.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QElapsedTimer>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include "Runner.h"
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+/********************************************************************
+*                                run                         public *
+*-------------------------------------------------------------------*
+* Calls 'operation' 'iterations' times (with the iteration number)  *
+* and records the time of every call.                               *
+********************************************************************/
+void Runner::run(const QString& name, const int iterations, const std::function<void(int)>& operation) {
+    std::vector<qint64> samples;
+    samples.reserve(size_t(iterations));
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; i++) {
+        timer.start();
+        operation(i);
+        samples.push_back(timer.nsecsElapsed());
+    }
+    record(name, std::move(samples));
+}
+
+/********************************************************************
+*                              record                        public *
+*-------------------------------------------------------------------*
+* Adds a case measured elsewhere (samples in nanoseconds).          *
+********************************************************************/
+void Runner::record(const QString& name, std::vector<qint64> samples) {
+    if (samples.empty()) {
+        qWarning() << "Runner: no samples of" << name;
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto ms = [](const double ns) {
+        return std::round(ns / 1000.0) / 1000.0;
+    };
+
+    QJsonObject item;
+    item["name"] = name;
+    item["iterations"] = int(samples.size());
+    item["p50_ms"] = ms(percentile(samples, 0.50));
+    item["p99_ms"] = ms(percentile(samples, 0.99));
+    item["max_ms"] = ms(double(samples.back()));
+    _cases.append(item);
+    qInfo().noquote() << QString("%1: p50 %2 ms, p99 %3 ms")
+                             .arg(name, -24).arg(item["p50_ms"].toDouble()).arg(item["p99_ms"].toDouble());
+}
+
+/********************************************************************
+*                              report                        public *
+********************************************************************/
+QJsonObject Runner::report(const QJsonObject& corpus) const {
+    QJsonObject result;
+    result["corpus"] = corpus;
+    result["cases"] = _cases;
+    result["peak_rss_kb"] = double(peakRss());
+    return result;
+}
+
+/********************************************************************
+*                              peakRss                public static *
+*-------------------------------------------------------------------*
+* Peak resident set size of the process in KiB (0 when unknown).    *
+********************************************************************/
+qint64 Runner::peakRss() {
+#ifdef Q_OS_UNIX
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef Q_OS_MACOS
+        return qint64(usage.ru_maxrss) / 1024;     // bytes there
+#else
+        return qint64(usage.ru_maxrss);
+#endif
+    }
+#endif
+    return 0;
+}
+
+/********************************************************************
+*                            percentile               public static *
+*-------------------------------------------------------------------*
+* Nearest-rank percentile of sorted samples, 'p' in (0, 1].         *
+********************************************************************/
+double Runner::percentile(const std::vector<qint64>& sorted, const double p) {
+    const auto rank = size_t(std::ceil(p * double(sorted.size())));
+    return double(sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1]);
+}
@@ -0,0 +1,55 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Runner.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_RUNNER_H
+#define GOEDIT_RUNNER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <functional>
+#include <vector>
+
+/********************************************************************
+*                              Runner                               *
+*-------------------------------------------------------------------*
+* Runs benchmark cases and collects their latencies. Each case is   *
+* one operation repeated; the report has the percentiles of every   *
+* case and the peak resident set size of the process, as JSON, so   *
+* results of two runs can be compared by a script.                  *
+********************************************************************/
+class Runner {
+    QJsonArray _cases;
+public:
+    void run(const QString&, const int, const std::function<void(int)>&);
+    void record(const QString&, std::vector<qint64>);
+    QJsonObject report(const QJsonObject&) const;
+
+    static qint64 peakRss();
+    static double percentile(const std::vector<qint64>&, const double);
+};
+
+#endif // GOEDIT_RUNNER_H
@@ -0,0 +1,91 @@
+#include "MainWindow.h"
+#include "Corpus.h"
+#include "Runner.h"
+#include "EditorBench.h"
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QDirIterator>
+#include <QJsonDocument>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QFile>
+#include <cstdio>
+
+// Headless benchmark of the editor. Generates a synthetic Go module,
+// drives the main window on the offscreen platform and prints JSON
+// with p50/p99 of every case and the peak RSS of the process.
+int main(int argc, char *argv[]) {
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    // Settings and databases of the user are not touched.
+    QStandardPaths::setTestMode(true);
+    QCoreApplication::setOrganizationName("Beesoft Software");
+    QCoreApplication::setApplicationName("Goedit Benchmark");
+
+    QApplication app(argc, argv);
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption packages("packages", "Packages of the module.", "n", "20");
+    const QCommandLineOption files("files", "Files per package.", "n", "20");
+    const QCommandLineOption lines("lines", "Lines per file.", "n", "400");
+    const QCommandLineOption bigLines("big-lines", "Lines of the file scrolled and edited.", "n", "100000");
+    const QCommandLineOption iterations("iterations", "Repetitions of a case.", "n", "200");
+    const QCommandLineOption seed("seed", "Seed of the corpus.", "n", "1");
+    const QCommandLineOption corpusDir("corpus", "Directory for the corpus (default: temporary).", "dir");
+    const QCommandLineOption output("output", "File for the JSON report (default: stdout).", "file");
+    parser.addOptions({packages, files, lines, bigLines, iterations, seed, corpusDir, output});
+    parser.process(app);
+
+    QTemporaryDir temporary;
+    const QString root = parser.isSet(corpusDir) ? parser.value(corpusDir) : temporary.path();
+    const Corpus::Size size{parser.value(packages).toInt(), parser.value(files).toInt(), parser.value(lines).toInt()};
+    const int n = qMax(1, parser.value(iterations).toInt());
+
+    Corpus corpus(parser.value(seed).toUInt());
+    const QString big = root + "/big/big.go";
+    if (!corpus.generate(root, size) || !QDir(root).mkpath("big")
+            || !corpus.writeFile(big, "big", parser.value(bigLines).toInt())) {
+        return 1;
+    }
+    QStringList paths;
+    for (QDirIterator it(root, {"*.go"}, QDir::Files, QDirIterator::Subdirectories); it.hasNext() && paths.size() < n;) {
+        paths.append(it.next());
+    }
+
+    Runner runner;
+    MainWindow window;
+    EditorBench bench(window, runner, root);
+    if (!bench.start()) {
+        return 1;
+    }
+    bench.openProject(qMax(1, n / 50));
+    bench.openFiles(paths);
+    bench.scroll(big, n);
+    bench.gotoLine(big, n);
+    bench.type(big, n);
+    bench.save(big, qMax(1, n / 10));
+    bench.find({"strings.HasPrefix", "count++", "buffer", "fmt.Errorf"}, n);
+    bench.flood(qMax(1, n / 10));
+
+    const QJsonObject info {
+        {"packages", size.packages},
+        {"files", size.files},
+        {"lines", size.lines},
+        {"big_lines", parser.value(bigLines).toInt()},
+        {"seed", parser.value(seed).toInt()}
+    };
+    const QByteArray json = QJsonDocument(runner.report(info)).toJson();
+    if (parser.isSet(output)) {
+        QFile file(parser.value(output));
+        if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size()) {
+            qWarning("Can't write %s", qPrintable(parser.value(output)));
+            return 1;
+        }
+    } else {
+        fwrite(json.constData(), 1, size_t(json.size()), stdout);
+    }
+    window.close();
+    return 0;
+}
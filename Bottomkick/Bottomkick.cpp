@@ -26,16 +26,38 @@
 /*------- include files:
 -------------------------------------------------------------------*/
 #include <QAction>
+#include <QTabWidget>
 #include "Bottomkick.h"
+#include "SearchTab.h"
+#include "DebugTab.h"
 
 //*******************************************************************
 //                           Bottomkick                         CTOR
 //*******************************************************************
-Bottomkick::Bottomkick(QWidget *parent)
+Bottomkick::Bottomkick(DlvClient* dlvClient, QWidget *parent)
     : QDockWidget(parent)
+    , _tabs(new QTabWidget)
+    , _searchTab(new SearchTab)
+    , _debugTab(new DebugTab(dlvClient))
 {
     setObjectName("Bottomkick");
     setFeatures(DockWidgetClosable);
     setAllowedAreas(Qt::BottomDockWidgetArea);
     toggleViewAction()->setIcon(QIcon(":/img/DockVerticalIcon"));
+
+    _tabs->setDocumentMode(true);
+    _tabs->addTab(_searchTab, "Search");
+    _tabs->addTab(_debugTab, "Debug");
+    setWidget(_tabs);
+}
+
+/********************************************************************
+*                              showTab                       public *
+*-------------------------------------------------------------------*
+* Makes the dock visible with the tab on top.                       *
+********************************************************************/
+void Bottomkick::showTab(QWidget* tab) {
+    _tabs->setCurrentWidget(tab);
+    show();
+    raise();
 }
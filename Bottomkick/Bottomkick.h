@@ -29,15 +29,32 @@
 -------------------------------------------------------------------*/
 #include <QDockWidget>
 
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QTabWidget;
+class SearchTab;
+class DebugTab;
+class DlvClient;
 
-
+/********************************************************************
+*                            Bottomkick                             *
+********************************************************************/
 class Bottomkick : public QDockWidget {
     Q_OBJECT
-public:
-    explicit Bottomkick(QWidget *parent = nullptr);
 
-signals:
+    QTabWidget* const _tabs;
+    SearchTab* const _searchTab;
+    DebugTab* const _debugTab;
+public:
+    explicit Bottomkick(DlvClient*, QWidget *parent = nullptr);
 
+    SearchTab* searchTab() const {
+        return _searchTab;
+    }
+    DebugTab* debugTab() const {
+        return _debugTab;
+    }
+    void showTab(QWidget*);
 };
 
-#endif // BOTTOMKICK_H
+#endif // GOEDIT_BOTTOMKICK_H
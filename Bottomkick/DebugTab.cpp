@@ -0,0 +1,396 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DebugTab.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QHeaderView>
+#include <QJsonArray>
+#include <QSplitter>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+#include "DebugTab.h"
+#include "Debugger/DlvClient.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static const char* const MoreText = "more...";
+
+//*******************************************************************
+//                             DebugTab                         CTOR
+//*******************************************************************
+DebugTab::DebugTab(DlvClient* client, QWidget* parent)
+    : QWidget(parent)
+    , _client(client)
+    , _goroutines(treeWidget({"Goroutine", "Location"}))
+    , _frames(treeWidget({"Function", "Location"}))
+    , _variables(treeWidget({"Name", "Type", "Value"}))
+    , _goroutine(0)
+    , _frame(0)
+    , _depth(FrameDepth)
+    , _generation(0)
+    , _scopeGeneration(0)
+{
+    _goroutines->setRootIsDecorated(false);
+    _frames->setRootIsDecorated(false);
+
+    auto const splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(_goroutines);
+    splitter->addWidget(_frames);
+    splitter->addWidget(_variables);
+    splitter->setStretchFactor(2, 1);
+
+    auto const layout = new QVBoxLayout;
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(splitter);
+    setLayout(layout);
+
+    connect(_goroutines, &QTreeWidget::itemActivated, this, &DebugTab::goroutineActivated);
+    connect(_frames, &QTreeWidget::itemActivated, this, &DebugTab::frameActivated);
+    connect(_frames, &QTreeWidget::itemSelectionChanged, this, &DebugTab::frameSelected);
+    connect(_variables, &QTreeWidget::itemExpanded, this, &DebugTab::variableExpanded);
+    connect(_variables, &QTreeWidget::itemActivated, this, &DebugTab::variableActivated);
+}
+
+/********************************************************************
+*                              refresh                       public *
+*-------------------------------------------------------------------*
+* The program stopped in the goroutine: the first page of           *
+* goroutines, its frames and the variables of its top frame.        *
+********************************************************************/
+void DebugTab::refresh(const qint64 goroutine) {
+    clear();
+    _goroutine = goroutine;
+    loadGoroutines(0);
+    loadFrames();
+}
+
+/********************************************************************
+*                               clear                        public *
+********************************************************************/
+void DebugTab::clear() {
+    ++_generation;
+    ++_scopeGeneration;
+    _goroutines->clear();
+    _frames->clear();
+    _variables->clear();
+    _frame = 0;
+    _depth = FrameDepth;
+}
+
+/********************************************************************
+*                           loadGoroutines                  private *
+********************************************************************/
+void DebugTab::loadGoroutines(const int start) {
+    _client->goroutines(start, [this, generation = _generation](const QJsonObject& result) {
+        if (generation != _generation) {
+            return;
+        }
+        QList<QTreeWidgetItem*> items;
+        for (const auto& value : result.value("Goroutines").toArray()) {
+            const QJsonObject goroutine = value.toObject();
+            const QJsonObject location = goroutine.value("userCurrentLoc").toObject();
+            const auto id = qint64(goroutine.value("id").toDouble());
+            auto const item = new QTreeWidgetItem(QStringList{
+                QString::number(id),
+                location.value("function").toObject().value("name").toString()});
+            item->setData(0, IdRole, id);
+            item->setToolTip(1, QString("%1:%2").arg(location.value("file").toString()).arg(location.value("line").toInt()));
+            if (id == _goroutine) {
+                QFont font = item->font(0);
+                font.setBold(true);
+                item->setFont(0, font);
+            }
+            items.append(item);
+        }
+        if (const int next = result.value("Nextg").toInt(); next > 0) {
+            items.append(moreItem(next));
+        }
+        _goroutines->addTopLevelItems(items);
+    });
+}
+
+/********************************************************************
+*                             loadFrames                    private *
+*-------------------------------------------------------------------*
+* Delve has no offset for frames, so the next page is asked for by  *
+* a greater depth and only frames not yet shown are added.          *
+********************************************************************/
+void DebugTab::loadFrames() {
+    _client->stacktrace(_goroutine, _depth, [this, generation = _generation, goroutine = _goroutine](const QJsonObject& result) {
+        if (generation != _generation || goroutine != _goroutine) {
+            return;
+        }
+        const QJsonArray locations = result.value("Locations").toArray();
+        if (const int last = _frames->topLevelItemCount() - 1; last >= 0 && _frames->topLevelItem(last)->data(0, MoreRole).isValid()) {
+            delete _frames->takeTopLevelItem(last);
+        }
+
+        QList<QTreeWidgetItem*> items;
+        for (int i = _frames->topLevelItemCount(); i < locations.size(); i++) {
+            const QJsonObject location = locations[i].toObject();
+            const QString path = location.value("file").toString();
+            const int line = location.value("line").toInt();
+            auto const item = new QTreeWidgetItem(QStringList{
+                location.value("function").toObject().value("name").toString(),
+                QString("%1:%2").arg(path.section('/', -1)).arg(line)});
+            item->setData(0, IdRole, i);
+            item->setData(0, PathRole, path);
+            item->setData(0, LineRole, line - 1);
+            item->setToolTip(1, path);
+            items.append(item);
+        }
+        // Depth is the index of the deepest frame asked for.
+        if (locations.size() > _depth) {
+            items.append(moreItem(_depth + FrameDepth));
+        }
+        const bool first = _frames->topLevelItemCount() == 0;
+        _frames->addTopLevelItems(items);
+        if (first && _frames->topLevelItemCount()) {
+            _frames->setCurrentItem(_frames->topLevelItem(0));
+        }
+    });
+}
+
+/********************************************************************
+*                           loadVariables                   private *
+********************************************************************/
+void DebugTab::loadVariables() {
+    _variables->clear();
+    _client->variables(_goroutine, _frame, [this, generation = ++_scopeGeneration](const QJsonObject& result) {
+        if (generation != _scopeGeneration) {
+            return;
+        }
+        QList<QTreeWidgetItem*> items;
+        for (const auto& value : result.value("Variables").toArray()) {
+            const QJsonObject variable = value.toObject();
+            const QString name = variable.value("name").toString();
+            items.append(variableItem(name, variable, name));
+        }
+        _variables->addTopLevelItems(items);
+    });
+}
+
+/********************************************************************
+*                            loadChildren                   private *
+*-------------------------------------------------------------------*
+* Evaluates the expression of the item again, one level deeper.     *
+* From 'start' on the elements come from a reslice, so every call   *
+* brings at most PageSize of them.                                  *
+********************************************************************/
+void DebugTab::loadChildren(QTreeWidgetItem* item, const int start) {
+    const QString expr = item->data(0, ExprRole).toString();
+    const QJsonObject variable = item->data(0, VariableRole).toJsonObject();
+    const int kind = variable.value("kind").toInt();
+    const int len = variable.value("len").toInt();
+
+    QString query = expr;
+    if (start > 0 && (kind == DlvClient::Slice || kind == DlvClient::Array)) {
+        query = QString("(%1)[%2:%3]").arg(expr).arg(start).arg(qMin(len, start + DlvClient::PageSize));
+    } else if (start > 0 && kind == DlvClient::Map) {
+        query = QString("(%1)[%2:]").arg(expr).arg(start);
+    }
+
+    _client->evaluate(_goroutine, _frame, query, [this, item, start, generation = _scopeGeneration](const QJsonObject& result) {
+        if (generation == _scopeGeneration) {
+            addChildren(item, result.value("Variable").toObject(), start);
+        }
+    });
+}
+
+/********************************************************************
+*                            addChildren                    private *
+*-------------------------------------------------------------------*
+* Children of a map come in pairs: key, value.                      *
+********************************************************************/
+void DebugTab::addChildren(QTreeWidgetItem* parent, const QJsonObject& loaded, const int start) {
+    const QString expr = parent->data(0, ExprRole).toString();
+    const QJsonObject variable = parent->data(0, VariableRole).toJsonObject();
+    const int kind = variable.value("kind").toInt();
+    const QJsonArray children = loaded.value("children").toArray();
+
+    if (const int last = parent->childCount() - 1; last >= 0 && parent->child(last)->data(0, MoreRole).isValid()) {
+        delete parent->takeChild(last);
+    }
+
+    QList<QTreeWidgetItem*> items;
+    int count = 0;
+    if (kind == DlvClient::Map) {
+        for (int i = 0; i + 1 < children.size(); i += 2, ++count) {
+            const QJsonObject key = children[i].toObject();
+            const QJsonObject value = children[i + 1].toObject();
+            const QString name = key.value("kind").toInt() == DlvClient::String
+                               ? '"' + key.value("value").toString() + '"'
+                               : key.value("value").toString();
+            items.append(variableItem(name, value, DlvClient::childExpression(expr, variable, value, start + count)));
+        }
+    } else {
+        for (const auto& value : children) {
+            const QJsonObject child = value.toObject();
+            QString name = child.value("name").toString();
+            if (kind == DlvClient::Slice || kind == DlvClient::Array) {
+                name = QString("[%1]").arg(start + count);
+            } else if (name.isEmpty()) {
+                name = kind == DlvClient::Pointer ? "*" : child.value("type").toString();
+            }
+            items.append(variableItem(name, child, DlvClient::childExpression(expr, variable, child, start + count)));
+            ++count;
+        }
+    }
+
+    const bool paged = kind == DlvClient::Slice || kind == DlvClient::Array || kind == DlvClient::Map;
+    if (paged && count > 0 && start + count < variable.value("len").toInt()) {
+        items.append(moreItem(start + count));
+    }
+    parent->addChildren(items);
+}
+
+/********************************************************************
+*                         goroutineActivated                private *
+********************************************************************/
+void DebugTab::goroutineActivated(QTreeWidgetItem* item) {
+    if (const QVariant more = item->data(0, MoreRole); more.isValid()) {
+        delete item;
+        loadGoroutines(more.toInt());
+        return;
+    }
+    // Goroutines are kept, late replies for frames are dropped.
+    ++_scopeGeneration;
+    _goroutine = item->data(0, IdRole).toLongLong();
+    _frames->clear();
+    _variables->clear();
+    _frame = 0;
+    _depth = FrameDepth;
+    loadFrames();
+}
+
+/********************************************************************
+*                           frameActivated                  private *
+********************************************************************/
+void DebugTab::frameActivated(QTreeWidgetItem* item) {
+    if (const QVariant more = item->data(0, MoreRole); more.isValid()) {
+        _depth = more.toInt();
+        loadFrames();
+        return;
+    }
+    const QString path = item->data(0, PathRole).toString();
+    if (!path.isEmpty()) {
+        emit locationActivated(path, item->data(0, LineRole).toInt(), 0);
+    }
+}
+
+/********************************************************************
+*                           frameSelected                   private *
+********************************************************************/
+void DebugTab::frameSelected() {
+    auto const item = _frames->currentItem();
+    if (!item || item->data(0, MoreRole).isValid()) {
+        return;
+    }
+    _frame = item->data(0, IdRole).toInt();
+    loadVariables();
+}
+
+/********************************************************************
+*                          variableExpanded                 private *
+*-------------------------------------------------------------------*
+* Children are fetched the first time the item is expanded.         *
+********************************************************************/
+void DebugTab::variableExpanded(QTreeWidgetItem* item) {
+    if (item->childCount() == 0 && !item->data(0, ExprRole).toString().isEmpty()) {
+        loadChildren(item, 0);
+    }
+}
+
+/********************************************************************
+*                          variableActivated                private *
+********************************************************************/
+void DebugTab::variableActivated(QTreeWidgetItem* item) {
+    if (const QVariant more = item->data(0, MoreRole); more.isValid() && item->parent()) {
+        loadChildren(item->parent(), more.toInt());
+    }
+}
+
+/********************************************************************
+*                            variableItem            private static *
+*-------------------------------------------------------------------*
+* Item of the variable, expandable when it has children. 'expr' is  *
+* empty for values Delve can't address, they are shown as loaded.   *
+********************************************************************/
+QTreeWidgetItem* DebugTab::variableItem(const QString& name, const QJsonObject& variable, const QString& expr) {
+    const int kind = variable.value("kind").toInt();
+    const int len = variable.value("len").toInt();
+    QString value = variable.value("value").toString();
+    if (kind == DlvClient::String) {
+        value = '"' + value + (len > value.size() ? "...\"" : "\"");
+    } else if (value.isEmpty() && (kind == DlvClient::Slice || kind == DlvClient::Array || kind == DlvClient::Map)) {
+        value = QString("len: %1").arg(len);
+    } else if (value.isEmpty() && kind == DlvClient::Pointer) {
+        value = QString("0x%1").arg(qint64(variable.value("addr").toDouble()), 0, 16);
+    }
+    const QString unreadable = variable.value("unreadable").toString();
+
+    auto const item = new QTreeWidgetItem(QStringList{
+        name,
+        variable.value("type").toString(),
+        unreadable.isEmpty() ? value : unreadable});
+    item->setData(0, ExprRole, expr);
+
+    QJsonObject stripped = variable;
+    stripped.remove("children");
+    item->setData(0, VariableRole, stripped);
+
+    const bool hasChildren = !variable.value("children").toArray().isEmpty() || (kind != DlvClient::String && len > 0);
+    if (hasChildren && unreadable.isEmpty() && !expr.isEmpty()) {
+        item->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
+    }
+    return item;
+}
+
+/********************************************************************
+*                              moreItem              private static *
+*-------------------------------------------------------------------*
+* Activating it loads the next page from 'next'.                    *
+********************************************************************/
+QTreeWidgetItem* DebugTab::moreItem(const int next) {
+    auto const item = new QTreeWidgetItem(QStringList(MoreText));
+    item->setData(0, MoreRole, next);
+    QFont font = item->font(0);
+    font.setItalic(true);
+    item->setFont(0, font);
+    return item;
+}
+
+/********************************************************************
+*                             treeWidget             private static *
+********************************************************************/
+QTreeWidget* DebugTab::treeWidget(const QStringList& labels) {
+    auto const view = new QTreeWidget;
+    view->setUniformRowHeights(true);
+    view->setAnimated(false);
+    view->setColumnCount(labels.size());
+    view->setHeaderLabels(labels);
+    view->header()->setStretchLastSection(true);
+    return view;
+}
@@ -0,0 +1,94 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DebugTab.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DEBUG_TAB_H
+#define GOEDIT_DEBUG_TAB_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QWidget>
+#include <QJsonObject>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class DlvClient;
+class QTreeWidget;
+class QTreeWidgetItem;
+
+/********************************************************************
+*                             DebugTab                              *
+*-------------------------------------------------------------------*
+* Goroutines, frames of the selected goroutine and variables of the *
+* selected frame. Everything is fetched on demand: goroutines and   *
+* frames page by page ("more..." items), children of a variable     *
+* when its item is expanded.                                        *
+********************************************************************/
+class DebugTab : public QWidget {
+    Q_OBJECT
+
+    enum Role {
+        IdRole = Qt::UserRole + 1,
+        PathRole,
+        LineRole,
+        ExprRole,
+        VariableRole,
+        MoreRole
+    };
+    static constexpr int FrameDepth = 16;
+
+    DlvClient* const _client;
+    QTreeWidget* const _goroutines;
+    QTreeWidget* const _frames;
+    QTreeWidget* const _variables;
+    qint64 _goroutine;
+    int _frame;
+    int _depth;
+    int _generation;            // of the stop, replies of older stops are dropped
+    int _scopeGeneration;       // of the frame shown in _variables
+public:
+    explicit DebugTab(DlvClient*, QWidget* = nullptr);
+
+    void refresh(const qint64);
+    void clear();
+
+private:
+    void loadGoroutines(const int);
+    void loadFrames();
+    void loadVariables();
+    void loadChildren(QTreeWidgetItem*, const int);
+    void addChildren(QTreeWidgetItem*, const QJsonObject&, const int);
+    void goroutineActivated(QTreeWidgetItem*);
+    void frameActivated(QTreeWidgetItem*);
+    void frameSelected();
+    void variableExpanded(QTreeWidgetItem*);
+    void variableActivated(QTreeWidgetItem*);
+    static QTreeWidgetItem* variableItem(const QString&, const QJsonObject&, const QString&);
+    static QTreeWidgetItem* moreItem(const int);
+    static QTreeWidget* treeWidget(const QStringList&);
+
+signals:
+    void locationActivated(const QString&, const int, const int);
+};
+
+#endif // GOEDIT_DEBUG_TAB_H
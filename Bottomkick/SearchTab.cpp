@@ -0,0 +1,101 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : SearchTab.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QLabel>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+#include "SearchTab.h"
+
+//*******************************************************************
+//                             SearchTab                        CTOR
+//*******************************************************************
+SearchTab::SearchTab(QWidget* parent)
+    : QWidget(parent)
+    , _summary(new QLabel)
+    , _view(new QTreeWidget)
+{
+    _view->setUniformRowHeights(true);
+    _view->setHeaderHidden(true);
+    _view->setAnimated(false);
+    _view->setColumnCount(1);
+    _summary->setIndent(4);
+
+    auto const layout = new QVBoxLayout;
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(_summary);
+    layout->addWidget(_view);
+    setLayout(layout);
+
+    connect(_view, &QTreeWidget::itemActivated, this, &SearchTab::activated);
+}
+
+/********************************************************************
+*                             setResults                     public *
+*-------------------------------------------------------------------*
+* Hits come ordered by file, so a file item is made when the path   *
+* changes.                                                          *
+********************************************************************/
+void SearchTab::setResults(const QString& text, const QVector<TrigramIndex::Hit>& hits, const qint64 ms) {
+    _view->setUpdatesEnabled(false);
+    _view->clear();
+
+    QList<QTreeWidgetItem*> files;
+    QTreeWidgetItem* file = nullptr;
+    for (const auto& hit : hits) {
+        if (!file || file->data(0, PathRole).toString() != hit.path) {
+            file = new QTreeWidgetItem(QStringList(hit.path));
+            file->setData(0, PathRole, hit.path);
+            files.append(file);
+        }
+        const QString line = hit.text;
+        int indent = 0;
+        while (indent < line.size() && line[indent].isSpace()) {
+            ++indent;
+        }
+        auto const item = new QTreeWidgetItem(file, QStringList(QString("%1: %2").arg(hit.line + 1).arg(line.mid(indent))));
+        item->setData(0, PathRole, hit.path);
+        item->setData(0, LineRole, hit.line);
+        item->setData(0, ColumnRole, hit.column);
+    }
+    _view->addTopLevelItems(files);
+    _view->expandAll();
+    _view->setUpdatesEnabled(true);
+
+    _summary->setText(QString("'%1': %2 matches in %3 files (%4 ms)")
+                      .arg(text).arg(hits.size()).arg(files.size()).arg(ms));
+}
+
+/********************************************************************
+*                             activated                     private *
+********************************************************************/
+void SearchTab::activated(QTreeWidgetItem* item) {
+    if (item && item->parent()) {
+        emit locationActivated(item->data(0, PathRole).toString(),
+                               item->data(0, LineRole).toInt(),
+                               item->data(0, ColumnRole).toInt());
+    }
+}
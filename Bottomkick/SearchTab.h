@@ -0,0 +1,66 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : SearchTab.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_SEARCH_TAB_H
+#define GOEDIT_SEARCH_TAB_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QWidget>
+#include "Project/TrigramIndex.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QLabel;
+class QTreeWidget;
+class QTreeWidgetItem;
+
+/********************************************************************
+*                             SearchTab                             *
+*-------------------------------------------------------------------*
+* Results of Find in Files grouped by file.                         *
+********************************************************************/
+class SearchTab : public QWidget {
+    Q_OBJECT
+
+    enum Role {
+        PathRole = Qt::UserRole + 1,
+        LineRole,
+        ColumnRole
+    };
+
+    QLabel* const _summary;
+    QTreeWidget* const _view;
+public:
+    explicit SearchTab(QWidget* = nullptr);
+    void setResults(const QString&, const QVector<TrigramIndex::Hit>&, const qint64);
+
+private:
+    void activated(QTreeWidgetItem*);
+
+signals:
+    void locationActivated(const QString&, const int, const int);
+};
+
+#endif // GOEDIT_SEARCH_TAB_H
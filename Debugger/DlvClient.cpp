@@ -0,0 +1,401 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DlvClient.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QStandardPaths>
+#include <QCoreApplication>
+#include <QDebug>
+#include "DlvClient.h"
+#include "DlvConnection.h"
+
+//*******************************************************************
+//                             DlvClient                        CTOR
+//*******************************************************************
+DlvClient::DlvClient(QObject* parent)
+    : QObject(parent)
+    , _connection(new DlvConnection)
+    , _state(Idle)
+    , _lastId(0)
+    , _command(0)
+{
+    _connection->moveToThread(&_thread);
+    connect(&_thread, &QThread::finished, _connection, &QObject::deleteLater);
+    connect(_connection, &DlvConnection::started, this, &DlvClient::started);
+    connect(_connection, &DlvConnection::received, this, &DlvClient::received);
+    connect(_connection, &DlvConnection::output, this, &DlvClient::output);
+    connect(_connection, &DlvConnection::finished, this, &DlvClient::finished);
+    _thread.setObjectName("DlvConnection");
+    _thread.start();
+}
+
+/********************************************************************
+*                            ~DlvClient                        dtor *
+********************************************************************/
+DlvClient::~DlvClient() {
+    stop();
+    QMetaObject::invokeMethod(_connection, &DlvConnection::stop, Qt::BlockingQueuedConnection);
+    _thread.quit();
+    _thread.wait();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Builds and debugs the main package in the directory 'dir'.        *
+********************************************************************/
+void DlvClient::start(const QString& dir) {
+    stop();
+
+    QStringList args = qEnvironmentVariable("GOEDIT_DLV").split(' ', Qt::SkipEmptyParts);
+    const QString program = args.isEmpty() ? QStandardPaths::findExecutable("dlv") : args.takeFirst();
+    if (program.isEmpty()) {
+        qWarning() << "DlvClient: dlv not found";
+        return;
+    }
+    args << "debug" << "--headless" << "--api-version=2" << "--listen=127.0.0.1:0";
+
+    setState(Starting);
+    QMetaObject::invokeMethod(_connection, [connection = _connection, program, args, dir] {
+        connection->start(program, args, dir);
+    });
+}
+
+/********************************************************************
+*                               stop                         public *
+*-------------------------------------------------------------------*
+* Kills the debugged program. Breakpoints are kept for the next     *
+* session.                                                          *
+********************************************************************/
+void DlvClient::stop() {
+    if (_state == Idle) {
+        return;
+    }
+    call("RPCServer.Detach", {{"Kill", true}});
+    _pending.clear();
+    _creating.clear();
+    _command = 0;
+    for (auto& id : _breakpoints) {
+        id = 0;
+    }
+    setState(Idle);
+    QMetaObject::invokeMethod(_connection, &DlvConnection::stop);
+}
+
+/********************************************************************
+*                     resume/next/step/stepOut               public *
+*-------------------------------------------------------------------*
+* The reply comes when the program stops again, until then the      *
+* state is Running.                                                 *
+********************************************************************/
+void DlvClient::resume() {
+    command("continue");
+}
+
+void DlvClient::next() {
+    command("next");
+}
+
+void DlvClient::step() {
+    command("step");
+}
+
+void DlvClient::stepOut() {
+    command("stepOut");
+}
+
+/********************************************************************
+*                               halt                         public *
+*-------------------------------------------------------------------*
+* Delve serves calls concurrently: 'halt' is answered while the     *
+* 'continue' still waits, which then returns the stop position.     *
+********************************************************************/
+void DlvClient::halt() {
+    if (_state == Running) {
+        call("RPCServer.Command", {{"name", "halt"}});
+    }
+}
+
+/********************************************************************
+*                          toggleBreakpoint                  public *
+*-------------------------------------------------------------------*
+* 'line' is 0-based. Returns true when the breakpoint is set now.   *
+* Breakpoints set without a session are created when it starts.     *
+********************************************************************/
+bool DlvClient::toggleBreakpoint(const QString& file, const int line) {
+    const QString key = QString("%1:%2").arg(file).arg(line + 1);
+    if (const auto it = _breakpoints.find(key); it != _breakpoints.end()) {
+        if (it.value() && _state != Idle) {
+            call("RPCServer.ClearBreakpoint", {{"Id", it.value()}});
+        }
+        _breakpoints.erase(it);
+        return false;
+    }
+    _breakpoints.insert(key, 0);
+    if (_state == Stopped) {
+        createBreakpoint(key);
+    }
+    return true;
+}
+
+/********************************************************************
+*                             goroutines                     public *
+*-------------------------------------------------------------------*
+* Next PageSize goroutines from the index 'start'. In the reply     *
+* 'Nextg' is the start of the next page, negative after the last.   *
+********************************************************************/
+void DlvClient::goroutines(const int start, const Handler& handler) {
+    call("RPCServer.ListGoroutines", {{"Start", start}, {"Count", PageSize}}, handler);
+}
+
+/********************************************************************
+*                             stacktrace                     public *
+*-------------------------------------------------------------------*
+* Frames (without variables) up to 'depth' of the goroutine.        *
+********************************************************************/
+void DlvClient::stacktrace(const qint64 goroutine, const int depth, const Handler& handler) {
+    call("RPCServer.Stacktrace", {{"Id", goroutine}, {"Depth", depth}, {"Full", false}}, handler);
+}
+
+/********************************************************************
+*                             variables                      public *
+*-------------------------------------------------------------------*
+* Arguments and local variables of the frame, as one reply with     *
+* 'Variables' (arguments first).                                    *
+********************************************************************/
+void DlvClient::variables(const qint64 goroutine, const int frame, const Handler& handler) {
+    const QJsonObject params{{"Scope", scope(goroutine, frame)}, {"Cfg", loadConfig()}};
+    call("RPCServer.ListFunctionArgs", params, [this, params, handler](const QJsonObject& args) {
+        call("RPCServer.ListLocalVars", params, [args, handler](const QJsonObject& locals) {
+            QJsonArray all = args.value("Args").toArray();
+            for (const auto& variable : locals.value("Variables").toArray()) {
+                all.append(variable);
+            }
+            handler({{"Variables", all}});
+        });
+    });
+}
+
+/********************************************************************
+*                              evaluate                      public *
+*-------------------------------------------------------------------*
+* Value of the expression in the frame, loaded one level deep. The  *
+* reply has 'Variable'.                                             *
+********************************************************************/
+void DlvClient::evaluate(const qint64 goroutine, const int frame, const QString& expr, const Handler& handler) {
+    call("RPCServer.Eval", {{"Scope", scope(goroutine, frame)}, {"Expr", expr}, {"Cfg", loadConfig()}}, handler);
+}
+
+/********************************************************************
+*                          childExpression            public static *
+*-------------------------------------------------------------------*
+* Expression of the child 'index' of the variable 'parent' (whose   *
+* expression is 'expr'). Elements of arrays, slices and maps are    *
+* paginated by reslicing: "x[64:128]" (for maps "m[64:]" skips 64   *
+* entries). Where no path by name exists, the child is addressed    *
+* by its type and address. Empty when it can't be evaluated.        *
+********************************************************************/
+QString DlvClient::childExpression(const QString& expr, const QJsonObject& parent, const QJsonObject& child, const int index) {
+    switch (parent.value("kind").toInt()) {
+    case Struct:
+        return QString("(%1).%2").arg(expr, child.value("name").toString());
+    case Array:
+    case Slice:
+        return QString("(%1)[%2]").arg(expr).arg(index);
+    case Pointer:
+        return QString("*(%1)").arg(expr);
+    default:
+        break;
+    }
+    const auto addr = qint64(child.value("addr").toDouble());
+    const QString type = child.value("type").toString();
+    if (addr == 0 || type.isEmpty()) {
+        return QString();
+    }
+    return QString("*(*\"%1\")(0x%2)").arg(type).arg(addr, 0, 16);
+}
+
+/********************************************************************
+*                              started                      private *
+*-------------------------------------------------------------------*
+* Delve stops the program before main: breakpoints are created      *
+* and the program continues to the first of them. Delve may answer  *
+* the calls in any order, so 'received' continues after the last    *
+* reply (an error too).                                             *
+********************************************************************/
+void DlvClient::started() {
+    if (_state != Starting) {
+        return;
+    }
+    setState(Stopped);
+    for (auto it = _breakpoints.begin(); it != _breakpoints.end(); ++it) {
+        _creating.insert(createBreakpoint(it.key()));
+    }
+    if (_creating.isEmpty()) {
+        resume();
+    }
+}
+
+/********************************************************************
+*                             finished                      private *
+********************************************************************/
+void DlvClient::finished() {
+    if (_state == Idle) {
+        return;
+    }
+    _pending.clear();
+    _creating.clear();
+    _command = 0;
+    setState(Idle);
+    emit exited(-1);
+}
+
+/********************************************************************
+*                             received                      private *
+*-------------------------------------------------------------------*
+* Handlers get successful results only. When Delve refuses a        *
+* command, the program didn't run: the state goes back to Stopped.  *
+********************************************************************/
+void DlvClient::received(const QJsonObject& message) {
+    const int id = message.value("id").toInt();
+    const auto it = _pending.find(id);
+    if (it == _pending.end()) {
+        return;
+    }
+    const Handler handler = it.value();
+    _pending.erase(it);
+
+    const QJsonValue error = message.value("error");
+    const bool command = (id == _command);
+    if (command) {
+        _command = 0;
+    }
+    if (!error.isNull() && !error.isUndefined()) {
+        qWarning() << "DlvClient:" << error.toString();
+        if (command && _state == Running) {
+            setState(Stopped);
+            emit commandFailed(error.toString());
+        }
+    } else if (handler) {
+        handler(message.value("result").toObject());
+    }
+    if (_creating.remove(id) && _creating.isEmpty()) {
+        resume();
+    }
+}
+
+/********************************************************************
+*                               call                        private *
+*-------------------------------------------------------------------*
+* Calls the method of the RPC server, returns the id of the call.   *
+********************************************************************/
+int DlvClient::call(const QString& method, const QJsonObject& params, const Handler& handler) {
+    const int id = ++_lastId;
+    _pending.insert(id, handler);
+    const QJsonObject message{{"method", method}, {"params", QJsonArray{params}}, {"id", id}};
+    QMetaObject::invokeMethod(_connection, [connection = _connection, message] {
+        connection->send(message);
+    });
+    return id;
+}
+
+/********************************************************************
+*                              command                      private *
+********************************************************************/
+void DlvClient::command(const QString& name) {
+    if (_state != Stopped) {
+        return;
+    }
+    setState(Running);
+    _command = call("RPCServer.Command", {{"name", name}}, [this](const QJsonObject& result) {
+        commandDone(result);
+    });
+}
+
+/********************************************************************
+*                            commandDone                    private *
+********************************************************************/
+void DlvClient::commandDone(const QJsonObject& result) {
+    const QJsonObject state = result.value("State").toObject();
+    if (state.value("exited").toBool()) {
+        const int status = state.value("exitStatus").toInt();
+        stop();
+        emit exited(status);
+        return;
+    }
+    setState(Stopped);
+    const QJsonObject thread = state.value("currentThread").toObject();
+    emit stopped(thread.value("file").toString(),
+                 thread.value("line").toInt() - 1,
+                 qint64(thread.value("goroutineID").toDouble()));
+}
+
+/********************************************************************
+*                          createBreakpoint                 private *
+*-------------------------------------------------------------------*
+* Returns the id of the call.                                       *
+********************************************************************/
+int DlvClient::createBreakpoint(const QString& key) {
+    const int colon = key.lastIndexOf(':');
+    const QJsonObject breakpoint{{"file", key.left(colon)}, {"line", key.mid(colon + 1).toInt()}};
+    return call("RPCServer.CreateBreakpoint", {{"Breakpoint", breakpoint}}, [this, key](const QJsonObject& result) {
+        if (const auto it = _breakpoints.find(key); it != _breakpoints.end()) {
+            it.value() = result.value("Breakpoint").toObject().value("id").toInt();
+        }
+    });
+}
+
+/********************************************************************
+*                             setState                      private *
+********************************************************************/
+void DlvClient::setState(const State state) {
+    if (_state != state) {
+        _state = state;
+        emit stateChanged(state);
+    }
+}
+
+/********************************************************************
+*                               scope                private static *
+********************************************************************/
+QJsonObject DlvClient::scope(const qint64 goroutine, const int frame) {
+    return {{"GoroutineID", goroutine}, {"Frame", frame}, {"DeferredCall", 0}};
+}
+
+/********************************************************************
+*                            loadConfig              private static *
+*-------------------------------------------------------------------*
+* One level of children, PageSize elements, shortened strings: the  *
+* reply stays small whatever the size of the value.                 *
+********************************************************************/
+QJsonObject DlvClient::loadConfig() {
+    return {
+        {"FollowPointers", true},
+        {"MaxVariableRecurse", 1},
+        {"MaxStringLen", MaxStringLen},
+        {"MaxArrayValues", PageSize},
+        {"MaxStructFields", -1}
+    };
+}
@@ -0,0 +1,127 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DlvClient.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DLV_CLIENT_H
+#define GOEDIT_DLV_CLIENT_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QThread>
+#include <QHash>
+#include <QSet>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <functional>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class DlvConnection;
+
+/********************************************************************
+*                             DlvClient                             *
+*-------------------------------------------------------------------*
+* Debugger: Delve (dlv, or the program in GOEDIT_DLV) driven by its *
+* JSON-RPC API. Every call is asynchronous, its handler is called   *
+* in the thread of the user interface when the reply comes. Nothing *
+* is fetched until asked for: goroutines are listed PageSize at a   *
+* time, variables are loaded one level deep with at most PageSize   *
+* elements and strings of MaxStringLen, deeper levels and further   *
+* elements are further calls (see evaluate).                        *
+********************************************************************/
+class DlvClient : public QObject {
+    Q_OBJECT
+public:
+    enum State {
+        Idle,
+        Starting,
+        Running,
+        Stopped
+    };
+    // Values of reflect.Kind of Go, as reported by Delve.
+    enum Kind {
+        Array = 17,
+        Interface = 20,
+        Map = 21,
+        Pointer = 22,
+        Slice = 23,
+        String = 24,
+        Struct = 25
+    };
+    using Handler = std::function<void(const QJsonObject&)>;
+
+    static constexpr int PageSize = 64;
+    static constexpr int MaxStringLen = 256;
+private:
+    DlvConnection* const _connection;
+    QThread _thread;
+    State _state;
+    int _lastId;
+    int _command;                           // id of the call of the running command, 0: none
+    QHash<int, Handler> _pending;
+    QHash<QString, int> _breakpoints;       // "file:line" -> id in Delve (0: not yet)
+    QSet<int> _creating;                    // ids of calls to wait for before continuing
+public:
+    explicit DlvClient(QObject* = nullptr);
+    ~DlvClient() override;
+
+    void start(const QString&);
+    void stop();
+    State state() const {
+        return _state;
+    }
+    void resume();
+    void next();
+    void step();
+    void stepOut();
+    void halt();
+    bool toggleBreakpoint(const QString&, const int);
+
+    void goroutines(const int, const Handler&);
+    void stacktrace(const qint64, const int, const Handler&);
+    void variables(const qint64, const int, const Handler&);
+    void evaluate(const qint64, const int, const QString&, const Handler&);
+    static QString childExpression(const QString&, const QJsonObject&, const QJsonObject&, const int);
+
+signals:
+    void stateChanged(DlvClient::State);
+    void stopped(const QString&, const int, const qint64);
+    void exited(const int);
+    void commandFailed(const QString&);
+    void output(const QString&);
+
+private:
+    void started();
+    void finished();
+    void received(const QJsonObject&);
+    int call(const QString&, const QJsonObject&, const Handler& = nullptr);
+    void command(const QString&);
+    void commandDone(const QJsonObject&);
+    int createBreakpoint(const QString&);
+    void setState(const State);
+    static QJsonObject scope(const qint64, const int);
+    static QJsonObject loadConfig();
+};
+
+#endif // GOEDIT_DLV_CLIENT_H
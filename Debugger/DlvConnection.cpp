@@ -0,0 +1,213 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DlvConnection.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QProcess>
+#include <QTcpSocket>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QDebug>
+#include <cstring>
+#include "DlvConnection.h"
+#include "Shared/Trace.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+const char* const DlvConnection::ListeningAt = "API server listening at:";
+
+//*******************************************************************
+//                           DlvConnection                      CTOR
+//*******************************************************************
+DlvConnection::DlvConnection(QObject* parent)
+    : QObject(parent)
+    , _process(nullptr)
+    , _socket(nullptr)
+    , _scanned(0)
+{}
+
+/********************************************************************
+*                          ~DlvConnection                      dtor *
+********************************************************************/
+DlvConnection::~DlvConnection() {
+    stop();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Must be called in the thread of the connection. 'started' is      *
+* emitted when the socket is connected, not when Delve runs.        *
+********************************************************************/
+void DlvConnection::start(const QString& program, const QStringList& args, const QString& dir) {
+    Trace::setThreadName("dlv");
+    stop();
+
+    _process = new QProcess(this);
+    _process->setWorkingDirectory(dir);
+    connect(_process, &QProcess::readyReadStandardOutput, this, &DlvConnection::readOutput);
+    connect(_process, &QProcess::readyReadStandardError, this, &DlvConnection::readErrors);
+    connect(_process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this, [this] {
+        emit finished();
+    });
+    connect(_process, &QProcess::errorOccurred, this, [this](const QProcess::ProcessError error) {
+        if (error == QProcess::FailedToStart) {
+            qWarning() << "DlvConnection: can't start" << _process->program() << _process->errorString();
+            emit finished();
+        }
+    });
+    _process->start(program, args);
+}
+
+/********************************************************************
+*                               stop                         public *
+*-------------------------------------------------------------------*
+* The last message (Detach) may still be buffered: the socket is    *
+* closed gracefully, so it is written first, and Delve gets a       *
+* moment to kill the program and exit before it is terminated.      *
+********************************************************************/
+void DlvConnection::stop() {
+    const bool connected = _socket && _socket->state() == QAbstractSocket::ConnectedState;
+    if (_socket) {
+        _socket->disconnect(this);
+        _socket->disconnectFromHost();
+        if (_socket->state() != QAbstractSocket::UnconnectedState) {
+            _socket->waitForDisconnected(StopTimeoutMs);
+        }
+        delete _socket;
+        _socket = nullptr;
+    }
+    if (_process) {
+        _process->disconnect(this);
+        if (connected && _process->state() != QProcess::NotRunning) {
+            _process->waitForFinished(StopTimeoutMs);
+        }
+        if (_process->state() != QProcess::NotRunning) {
+            _process->terminate();
+            if (!_process->waitForFinished(StopTimeoutMs)) {
+                _process->kill();
+                _process->waitForFinished(StopTimeoutMs);
+            }
+        }
+        delete _process;
+        _process = nullptr;
+    }
+    _banner.clear();
+    _input.clear();
+    _scanned = 0;
+}
+
+/********************************************************************
+*                               send                         public *
+*-------------------------------------------------------------------*
+* Delve reads a stream of JSON values, no framing is needed.        *
+********************************************************************/
+void DlvConnection::send(const QJsonObject& message) {
+    if (!_socket || _socket->state() != QAbstractSocket::ConnectedState) {
+        return;
+    }
+    _socket->write(QJsonDocument(message).toJson(QJsonDocument::Compact));
+    _socket->write("\n", 1);
+}
+
+/********************************************************************
+*                            readOutput                     private *
+********************************************************************/
+void DlvConnection::readOutput() {
+    const QByteArray data = _process->readAllStandardOutput();
+    if (_socket) {
+        emit output(QString::fromLocal8Bit(data));
+        return;
+    }
+
+    _banner += data;
+    const int at = _banner.indexOf(ListeningAt);
+    const int eol = (at < 0) ? -1 : _banner.indexOf('\n', at);
+    if (eol < 0) {
+        return;
+    }
+    const int start = at + int(strlen(ListeningAt));
+    connectTo(_banner.mid(start, eol - start).trimmed());
+    const QByteArray rest = _banner.mid(eol + 1);
+    _banner.clear();
+    if (!rest.isEmpty()) {
+        emit output(QString::fromLocal8Bit(rest));
+    }
+}
+
+/********************************************************************
+*                            readErrors                     private *
+*-------------------------------------------------------------------*
+* Standard error is the debugged program's (or a compiler's).       *
+********************************************************************/
+void DlvConnection::readErrors() {
+    emit output(QString::fromLocal8Bit(_process->readAllStandardError()));
+}
+
+/********************************************************************
+*                            readSocket                     private *
+*-------------------------------------------------------------------*
+* Every reply ends with '\n'. Bytes already searched are not        *
+* searched again, so a reply of many reads is scanned once.         *
+********************************************************************/
+void DlvConnection::readSocket() {
+    TraceScope trace("read", "dlv");
+    _input += _socket->readAll();
+
+    int begin = 0;
+    for (int eol = _input.indexOf('\n', _scanned); eol >= 0; eol = _input.indexOf('\n', begin)) {
+        QJsonParseError error;
+        const auto doc = QJsonDocument::fromJson(QByteArray::fromRawData(_input.constData() + begin, eol - begin), &error);
+        if (doc.isObject()) {
+            emit received(doc.object());
+        } else if (eol > begin) {
+            qWarning() << "DlvConnection: invalid reply:" << error.errorString();
+        }
+        begin = eol + 1;
+    }
+    _input.remove(0, begin);
+    _scanned = _input.size();
+}
+
+/********************************************************************
+*                             connectTo                     private *
+*-------------------------------------------------------------------*
+* 'address' as printed by Delve: host:port.                         *
+********************************************************************/
+void DlvConnection::connectTo(const QByteArray& address) {
+    const int colon = address.lastIndexOf(':');
+    const QString host = QString::fromLatin1(address.left(colon));
+    const quint16 port = address.mid(colon + 1).toUShort();
+    if (colon < 0 || port == 0) {
+        qWarning() << "DlvConnection: bad address" << address;
+        return;
+    }
+
+    _socket = new QTcpSocket(this);
+    connect(_socket, &QTcpSocket::readyRead, this, &DlvConnection::readSocket);
+    connect(_socket, &QTcpSocket::connected, this, &DlvConnection::started);
+    connect(_socket, &QTcpSocket::disconnected, this, &DlvConnection::finished);
+    _socket->connectToHost(host, port);
+}
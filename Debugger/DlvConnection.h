@@ -0,0 +1,81 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DlvConnection.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DLV_CONNECTION_H
+#define GOEDIT_DLV_CONNECTION_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QStringList>
+#include <QByteArray>
+#include <QJsonObject>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QProcess;
+class QTcpSocket;
+
+/********************************************************************
+*                           DlvConnection                           *
+*-------------------------------------------------------------------*
+* Headless Delve and its JSON-RPC socket. Lives in its own thread:  *
+* replies (a goroutine list or a big variable may have megabytes)   *
+* are read and parsed there. Delve listens on a port chosen by the  *
+* system and reports it on its standard output; all printed after   *
+* that is the output of the debugged program.                       *
+********************************************************************/
+class DlvConnection : public QObject {
+    Q_OBJECT
+
+    static constexpr int StopTimeoutMs = 1000;
+    static const char* const ListeningAt;
+
+    QProcess* _process;
+    QTcpSocket* _socket;
+    QByteArray _banner;         // output of Delve before the address
+    QByteArray _input;          // not yet complete replies
+    int _scanned;               // bytes of _input without '\n'
+public:
+    explicit DlvConnection(QObject* = nullptr);
+    ~DlvConnection() override;
+
+    void start(const QString&, const QStringList&, const QString&);
+    void stop();
+    void send(const QJsonObject&);
+
+signals:
+    void started();
+    void received(const QJsonObject&);
+    void output(const QString&);
+    void finished();
+
+private:
+    void readOutput();
+    void readErrors();
+    void readSocket();
+    void connectTo(const QByteArray&);
+};
+
+#endif // GOEDIT_DLV_CONNECTION_H
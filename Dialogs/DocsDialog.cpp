@@ -0,0 +1,171 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DocsDialog.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QLabel>
+#include <QLineEdit>
+#include <QListWidget>
+#include <QTextBrowser>
+#include <QSplitter>
+#include <QVBoxLayout>
+#include <QKeyEvent>
+#include "DocsDialog.h"
+#include "Shared/Shared.h"
+
+//*******************************************************************
+//                            DocsDialog                        CTOR
+//*******************************************************************
+DocsDialog::DocsDialog(DocIndex* index, QWidget* parent)
+    : QDialog(parent)
+    , _index(index)
+    , _edit(new QLineEdit)
+    , _list(new QListWidget)
+    , _browser(new QTextBrowser)
+    , _status(new QLabel)
+    , _shown()
+{
+    setWindowTitle("Go Documentation");
+    _list->setUniformItemSizes(true);
+    _browser->setOpenLinks(false);
+    _edit->installEventFilter(this);
+
+    auto const splitter = new QSplitter(Qt::Horizontal);
+    splitter->addWidget(_list);
+    splitter->addWidget(_browser);
+    splitter->setStretchFactor(1, 2);
+
+    auto const layout = new QVBoxLayout;
+    layout->addWidget(_edit);
+    layout->addWidget(splitter);
+    layout->addWidget(_status);
+    setLayout(layout);
+
+    connect(_edit, &QLineEdit::textChanged, this, &DocsDialog::search);
+    connect(_list, &QListWidget::currentRowChanged, this, &DocsDialog::currentRowChanged);
+    connect(_browser, &QTextBrowser::anchorClicked, this, &DocsDialog::anchorClicked);
+    connect(_index, &DocIndex::started, this, &DocsDialog::indexUpdated);
+    connect(_index, &DocIndex::updated, this, &DocsDialog::indexUpdated);
+
+    Shared::resize(this, 60, 60);
+    indexUpdated();
+}
+
+/********************************************************************
+*                              setText                       public *
+********************************************************************/
+void DocsDialog::setText(const QString& text) {
+    _edit->setText(text);
+    _edit->selectAll();
+    _edit->setFocus();
+}
+
+/********************************************************************
+*                               search                      private *
+********************************************************************/
+void DocsDialog::search(const QString& text) {
+    _entries = _index->search(text, MaxResults);
+
+    _list->setUpdatesEnabled(false);
+    _list->clear();
+    for (const auto& entry : _entries) {
+        QString name = entry.name;
+        QString detail = DocIndex::kindName(entry.kind) + "  " + entry.package;
+        if (entry.kind == DocIndex::Package) {
+            detail = DocIndex::kindName(entry.kind);
+            name = entry.package;
+        } else if (!entry.container.isEmpty()) {
+            name = entry.container + '.' + entry.name;
+        }
+        _list->addItem(name + "    " + detail);
+    }
+    _list->setCurrentRow(_entries.isEmpty() ? -1 : 0);
+    _list->setUpdatesEnabled(true);
+}
+
+/********************************************************************
+*                            showDocument                   private *
+*-------------------------------------------------------------------*
+* Reads the document from the index and renders it (only now).      *
+********************************************************************/
+void DocsDialog::showDocument(const qint64 id) {
+    const DocIndex::Document doc = _index->document(id);
+    _shown = doc.entry;
+    _browser->setHtml(doc.entry.id ? DocIndex::html(doc) : QString());
+}
+
+/********************************************************************
+*                         currentRowChanged                 private *
+********************************************************************/
+void DocsDialog::currentRowChanged(const int row) {
+    if (row >= 0 && row < _entries.size()) {
+        showDocument(_entries[row].id);
+    }
+}
+
+/********************************************************************
+*                           anchorClicked                   private *
+*-------------------------------------------------------------------*
+* "doc:<id>" shows another entry, "src:" opens the source of the    *
+* entry shown in the editor.                                        *
+********************************************************************/
+void DocsDialog::anchorClicked(const QUrl& url) {
+    if (url.scheme() == "doc") {
+        showDocument(url.path().toLongLong());
+    } else if (url.scheme() == "src" && _shown.id && _shown.kind != DocIndex::Package) {
+        emit locationActivated(_shown.path, _shown.line, 0);
+    }
+}
+
+/********************************************************************
+*                           indexUpdated                    private *
+********************************************************************/
+void DocsDialog::indexUpdated() {
+    if (_index->isBusy()) {
+        _status->setText("Indexing Go documentation...");
+        return;
+    }
+    _status->setText(QString("%1 entries").arg(_index->size()));
+    search(_edit->text());
+}
+
+/********************************************************************
+*                            eventFilter                    private *
+*-------------------------------------------------------------------*
+* Keys moving the selection go to the list, the rest to the edit.   *
+********************************************************************/
+bool DocsDialog::eventFilter(QObject* object, QEvent* event) {
+    if (object == _edit && event->type() == QEvent::KeyPress) {
+        switch (static_cast<QKeyEvent*>(event)->key()) {
+        case Qt::Key_Up:
+        case Qt::Key_Down:
+        case Qt::Key_PageUp:
+        case Qt::Key_PageDown:
+            QCoreApplication::sendEvent(_list, event);
+            return true;
+        }
+    }
+    return QDialog::eventFilter(object, event);
+}
@@ -0,0 +1,76 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DocsDialog.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DOCS_DIALOG_H
+#define GOEDIT_DOCS_DIALOG_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDialog>
+#include "Docs/DocIndex.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QLabel;
+class QLineEdit;
+class QListWidget;
+class QTextBrowser;
+class QUrl;
+
+/********************************************************************
+*                            DocsDialog                             *
+*-------------------------------------------------------------------*
+* Browser of Go documentation: search by name on every keystroke,   *
+* the page of the current result is rendered when it is selected.   *
+* Not modal, so it can stay open next to the editor.                *
+********************************************************************/
+class DocsDialog : public QDialog {
+    Q_OBJECT
+
+    static constexpr int MaxResults = 200;
+
+    DocIndex* const _index;
+    QLineEdit* const _edit;
+    QListWidget* const _list;
+    QTextBrowser* const _browser;
+    QLabel* const _status;
+    QVector<DocIndex::Entry> _entries;
+    DocIndex::Entry _shown;
+public:
+    explicit DocsDialog(DocIndex*, QWidget* = nullptr);
+    void setText(const QString&);
+
+private:
+    void search(const QString&);
+    void showDocument(const qint64);
+    void currentRowChanged(const int);
+    void anchorClicked(const QUrl&);
+    void indexUpdated();
+    bool eventFilter(QObject*, QEvent*) override;
+
+signals:
+    void locationActivated(const QString&, const int, const int);
+};
+
+#endif // GOEDIT_DOCS_DIALOG_H
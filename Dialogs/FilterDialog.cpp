@@ -0,0 +1,109 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FilterDialog.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QLineEdit>
+#include <QListWidget>
+#include <QVBoxLayout>
+#include <QKeyEvent>
+#include "FilterDialog.h"
+#include "Shared/Shared.h"
+
+//*******************************************************************
+//                           FilterDialog                       CTOR
+//*******************************************************************
+FilterDialog::FilterDialog(const QString& title, Provider provider, QWidget* parent)
+    : QDialog(parent)
+    , _provider(std::move(provider))
+    , _edit(new QLineEdit)
+    , _list(new QListWidget)
+{
+    setWindowTitle(title);
+    _list->setUniformItemSizes(true);
+    _edit->installEventFilter(this);
+
+    auto const layout = new QVBoxLayout;
+    layout->addWidget(_edit);
+    layout->addWidget(_list);
+    setLayout(layout);
+
+    connect(_edit, &QLineEdit::textChanged, this, &FilterDialog::filter);
+    connect(_edit, &QLineEdit::returnPressed, this, &QDialog::accept);
+    connect(_list, &QListWidget::itemActivated, this, &QDialog::accept);
+
+    Shared::resize(this, 40, 50);
+    filter(QString());
+}
+
+/********************************************************************
+*                              selected                      public *
+********************************************************************/
+QVariant FilterDialog::selected() const {
+    const int row = _list->currentRow();
+    return (row >= 0 && row < _items.size()) ? _items[row].data : QVariant();
+}
+
+/********************************************************************
+*                              setText                       public *
+********************************************************************/
+void FilterDialog::setText(const QString& text) {
+    _edit->setText(text);
+    _edit->selectAll();
+}
+
+/********************************************************************
+*                               filter                      private *
+********************************************************************/
+void FilterDialog::filter(const QString& text) {
+    _items = _provider(text);
+
+    _list->setUpdatesEnabled(false);
+    _list->clear();
+    for (const auto& item : _items) {
+        _list->addItem(item.detail.isEmpty() ? item.text : item.text + "    " + item.detail);
+    }
+    _list->setCurrentRow(_items.isEmpty() ? -1 : 0);
+    _list->setUpdatesEnabled(true);
+}
+
+/********************************************************************
+*                            eventFilter                    private *
+*-------------------------------------------------------------------*
+* Keys moving the selection go to the list, the rest to the edit.   *
+********************************************************************/
+bool FilterDialog::eventFilter(QObject* object, QEvent* event) {
+    if (object == _edit && event->type() == QEvent::KeyPress) {
+        switch (static_cast<QKeyEvent*>(event)->key()) {
+        case Qt::Key_Up:
+        case Qt::Key_Down:
+        case Qt::Key_PageUp:
+        case Qt::Key_PageDown:
+            QCoreApplication::sendEvent(_list, event);
+            return true;
+        }
+    }
+    return QDialog::eventFilter(object, event);
+}
@@ -0,0 +1,70 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FilterDialog.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FILTER_DIALOG_H
+#define GOEDIT_FILTER_DIALOG_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDialog>
+#include <QVariant>
+#include <QVector>
+#include <functional>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QLineEdit;
+class QListWidget;
+
+/********************************************************************
+*                           FilterDialog                            *
+*-------------------------------------------------------------------*
+* Line edit with a list of items computed by the provider for the   *
+* current text on every keystroke (quick open, go to symbol, ...).  *
+********************************************************************/
+class FilterDialog : public QDialog {
+    Q_OBJECT
+public:
+    struct Item {
+        QString text;
+        QString detail;
+        QVariant data;
+    };
+    using Provider = std::function<QVector<Item>(const QString&)>;
+private:
+    const Provider _provider;
+    QLineEdit* const _edit;
+    QListWidget* const _list;
+    QVector<Item> _items;
+public:
+    FilterDialog(const QString&, Provider, QWidget* = nullptr);
+    QVariant selected() const;
+    void setText(const QString&);
+
+private:
+    void filter(const QString&);
+    bool eventFilter(QObject*, QEvent*) override;
+};
+
+#endif // GOEDIT_FILTER_DIALOG_H
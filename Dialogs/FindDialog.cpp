@@ -0,0 +1,104 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FindDialog.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QLineEdit>
+#include <QCheckBox>
+#include <QDialogButtonBox>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QMessageBox>
+#include <QRegularExpression>
+#include "FindDialog.h"
+
+//*******************************************************************
+//                            FindDialog                        CTOR
+//*******************************************************************
+FindDialog::FindDialog(QWidget* parent)
+    : QDialog(parent)
+    , _edit(new QLineEdit)
+    , _regexBox(new QCheckBox("Regular expression"))
+    , _caseBox(new QCheckBox("Match case"))
+{
+    setWindowTitle("Find in Files");
+    _edit->setMinimumWidth(fontMetrics().horizontalAdvance('x') * 60);
+
+    auto const options = new QHBoxLayout;
+    options->addWidget(_caseBox);
+    options->addWidget(_regexBox);
+    options->addStretch();
+
+    auto const buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel);
+    connect(buttons, &QDialogButtonBox::accepted, this, &FindDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+    auto const layout = new QVBoxLayout;
+    layout->addWidget(_edit);
+    layout->addLayout(options);
+    layout->addWidget(buttons);
+    setLayout(layout);
+}
+
+/********************************************************************
+*                              getters                       public *
+********************************************************************/
+QString FindDialog::text() const {
+    return _edit->text();
+}
+
+bool FindDialog::isRegex() const {
+    return _regexBox->isChecked();
+}
+
+bool FindDialog::isCaseSensitive() const {
+    return _caseBox->isChecked();
+}
+
+/********************************************************************
+*                              setText                       public *
+********************************************************************/
+void FindDialog::setText(const QString& text) {
+    _edit->setText(text);
+    _edit->selectAll();
+}
+
+/********************************************************************
+*                               accept                      private *
+*-------------------------------------------------------------------*
+* Invalid regular expression is reported here, the dialog stays.    *
+********************************************************************/
+void FindDialog::accept() {
+    if (text().isEmpty()) {
+        return;
+    }
+    if (isRegex()) {
+        if (const QRegularExpression regex(text()); !regex.isValid()) {
+            QMessageBox::warning(this, windowTitle(), "Invalid regular expression: " + regex.errorString());
+            return;
+        }
+    }
+    QDialog::accept();
+}
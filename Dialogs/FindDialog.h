@@ -0,0 +1,60 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FindDialog.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FIND_DIALOG_H
+#define GOEDIT_FIND_DIALOG_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDialog>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QLineEdit;
+class QCheckBox;
+
+/********************************************************************
+*                            FindDialog                             *
+*-------------------------------------------------------------------*
+* Text to find in files of the project and the way to look for it.  *
+********************************************************************/
+class FindDialog : public QDialog {
+    Q_OBJECT
+
+    QLineEdit* const _edit;
+    QCheckBox* const _regexBox;
+    QCheckBox* const _caseBox;
+public:
+    explicit FindDialog(QWidget* = nullptr);
+
+    QString text() const;
+    void setText(const QString&);
+    bool isRegex() const;
+    bool isCaseSensitive() const;
+
+private:
+    void accept() override;
+};
+
+#endif // GOEDIT_FIND_DIALOG_H
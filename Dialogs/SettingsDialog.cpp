@@ -0,0 +1,92 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : SettingsDialog.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QSpinBox>
+#include <QCheckBox>
+#include <QDialogButtonBox>
+#include <QFormLayout>
+#include <QVBoxLayout>
+#include "SettingsDialog.h"
+
+//*******************************************************************
+//                          SettingsDialog                      CTOR
+//*******************************************************************
+SettingsDialog::SettingsDialog(const Settings::Values& values, QWidget* parent)
+    : QDialog(parent)
+    , _values(values)
+    , _tabWidthBox(new QSpinBox)
+    , _fontSizeBox(new QSpinBox)
+    , _minimapBox(new QCheckBox("Show minimap"))
+    , _changeBarBox(new QCheckBox("Show changes in the gutter"))
+    , _bracketsBox(new QCheckBox("Highlight matching brackets"))
+    , _formatBox(new QCheckBox("Format Go files on save"))
+{
+    setWindowTitle("Settings");
+
+    _tabWidthBox->setRange(1, 16);
+    _tabWidthBox->setValue(values.tabWidth);
+    _fontSizeBox->setRange(0, 72);
+    _fontSizeBox->setSpecialValueText("System");
+    _fontSizeBox->setValue(values.fontSize);
+    _minimapBox->setChecked(values.showMinimap);
+    _changeBarBox->setChecked(values.showChangeBar);
+    _bracketsBox->setChecked(values.matchBrackets);
+    _formatBox->setChecked(values.formatOnSave);
+
+    auto const form = new QFormLayout;
+    form->addRow("Tab width:", _tabWidthBox);
+    form->addRow("Font size:", _fontSizeBox);
+    form->addRow(_minimapBox);
+    form->addRow(_changeBarBox);
+    form->addRow(_bracketsBox);
+    form->addRow(_formatBox);
+
+    auto const buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel);
+    connect(buttons, &QDialogButtonBox::accepted, this, &QDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
+
+    auto const layout = new QVBoxLayout;
+    layout->addLayout(form);
+    layout->addWidget(buttons);
+    setLayout(layout);
+}
+
+/********************************************************************
+*                               values                       public *
+*-------------------------------------------------------------------*
+* Values not edited here are kept as they were given.               *
+********************************************************************/
+Settings::Values SettingsDialog::values() const {
+    Settings::Values values = _values;
+    values.tabWidth = _tabWidthBox->value();
+    values.fontSize = _fontSizeBox->value();
+    values.showMinimap = _minimapBox->isChecked();
+    values.showChangeBar = _changeBarBox->isChecked();
+    values.matchBrackets = _bracketsBox->isChecked();
+    values.formatOnSave = _formatBox->isChecked();
+    return values;
+}
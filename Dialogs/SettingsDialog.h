@@ -0,0 +1,59 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : SettingsDialog.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_SETTINGS_DIALOG_H
+#define GOEDIT_SETTINGS_DIALOG_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDialog>
+#include "Shared/Settings.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QSpinBox;
+class QCheckBox;
+
+/********************************************************************
+*                          SettingsDialog                           *
+*-------------------------------------------------------------------*
+* Edits a copy of the settings, the caller applies it when the      *
+* dialog is accepted.                                               *
+********************************************************************/
+class SettingsDialog : public QDialog {
+    Q_OBJECT
+
+    Settings::Values _values;
+    QSpinBox* const _tabWidthBox;
+    QSpinBox* const _fontSizeBox;
+    QCheckBox* const _minimapBox;
+    QCheckBox* const _changeBarBox;
+    QCheckBox* const _bracketsBox;
+    QCheckBox* const _formatBox;
+public:
+    explicit SettingsDialog(const Settings::Values&, QWidget* = nullptr);
+    Settings::Values values() const;
+};
+
+#endif // GOEDIT_SETTINGS_DIALOG_H
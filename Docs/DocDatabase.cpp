@@ -0,0 +1,135 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DocDatabase.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QDebug>
+#include "DocDatabase.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+// Every package is also a symbol (kind 0) carrying the package doc.
+// 'doc' is qCompress-ed: the declaration, '\f', the comment.
+static const char* const Schema = R"(
+CREATE TABLE packages (
+    id INTEGER PRIMARY KEY,
+    dir TEXT NOT NULL UNIQUE,
+    import TEXT NOT NULL,
+    name TEXT NOT NULL,
+    stamp INTEGER NOT NULL
+);
+CREATE TABLE symbols (
+    id INTEGER PRIMARY KEY,
+    package INTEGER NOT NULL,
+    name TEXT NOT NULL,
+    container TEXT NOT NULL,
+    kind INTEGER NOT NULL,
+    path TEXT NOT NULL,
+    line INTEGER NOT NULL,
+    doc BLOB
+);
+CREATE INDEX symbols_package ON symbols (package, container);
+)";
+
+using namespace beesoft::sqlite;
+
+/********************************************************************
+*                               open                  public static *
+*-------------------------------------------------------------------*
+* Opens the database, creating it if needed. Does nothing when it   *
+* is already open.                                                  *
+********************************************************************/
+bool DocDatabase::open() {
+    auto& db = SQLite::docs();
+    if (db.isOpen()) {
+        return true;
+    }
+    const QString fpath = path();
+    if (!QDir().mkpath(QFileInfo(fpath).path())) {
+        qWarning() << "DocDatabase: can't create" << QFileInfo(fpath).path();
+        return false;
+    }
+
+    const std::string name = QFile::encodeName(fpath).toStdString();
+    if (db.open(name)) {
+        const auto rows = db.select("PRAGMA user_version");
+        if (!rows.empty() && rows[0][0].as_i64() == Version) {
+            return configure();
+        }
+        db.close();
+    }
+    return create(name);
+}
+
+/********************************************************************
+*                               close                 public static *
+********************************************************************/
+void DocDatabase::close() {
+    SQLite::docs().close();
+}
+
+/********************************************************************
+*                               path                  public static *
+********************************************************************/
+QString DocDatabase::path() {
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/docs.db";
+}
+
+/********************************************************************
+*                              create                private static *
+********************************************************************/
+bool DocDatabase::create(const std::string& fpath) {
+    for (const char* suffix : {"-wal", "-shm"}) {
+        QFile::remove(QFile::decodeName(fpath + suffix));
+    }
+
+    auto& db = SQLite::docs();
+    const bool ok = db.create(fpath, [](SQLite& db) {
+        return db.exec(Schema)
+               && db.exec("PRAGMA user_version=" + std::to_string(Version));
+    }, true);
+    if (!ok) {
+        qWarning() << "DocDatabase: can't create" << QFile::decodeName(fpath);
+        db.close();
+        return false;
+    }
+    return configure();
+}
+
+/********************************************************************
+*                             configure              private static *
+*-------------------------------------------------------------------*
+* Settings of the connection (mmap_size is not stored in the file). *
+********************************************************************/
+bool DocDatabase::configure() {
+    return SQLite::docs().exec("PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;"
+                               " PRAGMA mmap_size=" + std::to_string(MmapSize));
+}
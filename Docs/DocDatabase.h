@@ -0,0 +1,61 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DocDatabase.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DOC_DATABASE_H
+#define GOEDIT_DOC_DATABASE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <string>
+
+/********************************************************************
+*                            DocDatabase                            *
+*-------------------------------------------------------------------*
+* SQLite database with the index of Go documentation (SQLite::docs) *
+* in the application data directory. It is a cache: packages of     *
+* GOROOT and of the module cache can always be indexed again, so it *
+* is kept apart from the database of the application. The file is   *
+* memory-mapped, lookups are served from the page cache of the      *
+* system without copying.                                           *
+********************************************************************/
+class DocDatabase {
+public:
+    static constexpr int Version = 1;
+    static constexpr qint64 MmapSize = 256 * 1024 * 1024;
+
+    DocDatabase() = delete;
+    ~DocDatabase() = delete;
+    DocDatabase(const DocDatabase&) = delete;
+    DocDatabase(const DocDatabase&&) = delete;
+
+    static bool open();
+    static void close();
+    static QString path();
+private:
+    static bool create(const std::string&);
+    static bool configure();
+};
+
+#endif // GOEDIT_DOC_DATABASE_H
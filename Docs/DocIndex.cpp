@@ -0,0 +1,812 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DocIndex.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
+#include <QProcess>
+#include <QRegularExpression>
+#include <QtConcurrent>
+#include <QDebug>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include "DocIndex.h"
+#include "DocDatabase.h"
+#include "Go/GoDoc.h"
+#include "Project/SymbolIndex.h"
+#include "Shared/Fuzzy.h"
+#include "Shared/Trace.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- namespaces:
+-------------------------------------------------------------------*/
+using namespace beesoft::sqlite;
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int BatchSize = 64;            // packages parsed and stored at once
+static constexpr int MaxPrefixHits = 20000;     // names with the prefix ranked at most
+static constexpr int ProcessTimeoutMs = 5000;
+static const char Separator = '\f';             // between declaration and comment
+static const char* const Columns = "SELECT s.id, s.name, s.container, s.kind, p.import, s.path, s.line";
+static const char* const Tables = " FROM symbols s JOIN packages p ON p.id = s.package";
+
+/*------- local types:
+-------------------------------------------------------------------*/
+namespace {
+    struct Symbol {
+        std::string name;
+        std::string container;
+        int kind;
+        QString path;
+        int line;
+        QByteArray doc;
+    };
+
+    struct Dir {
+        QString path;
+        QString import;
+        QStringList files;      // .go files without tests
+        quint64 stamp = 0;      // of names, times and sizes of the files
+        qint64 id = 0;          // in the database, 0 for a new one
+        std::string name;       // of the package
+        std::vector<Symbol> symbols;
+    };
+}
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+
+static int compareNoCase(std::string_view a, std::string_view b) {
+    const size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto x = static_cast<unsigned char>(Fuzzy::lower(a[i]));
+        const auto y = static_cast<unsigned char>(Fuzzy::lower(b[i]));
+        if (x != y) {
+            return x < y ? -1 : 1;
+        }
+    }
+    return (a.size() == b.size()) ? 0 : (a.size() < b.size() ? -1 : 1);
+}
+
+static bool startsWithNoCase(std::string_view text, std::string_view prefix) {
+    return text.size() >= prefix.size() && compareNoCase(text.substr(0, prefix.size()), prefix) == 0;
+}
+
+// Import path of a directory of the module cache: versions are cut
+// off ("golang.org/x/text@v0.14.0/unicode" -> "golang.org/x/text/unicode")
+// and "!x" stands for an upper case letter.
+static QString modulePath(const QString& rel) {
+    QStringList parts = rel.split('/', Qt::SkipEmptyParts);
+    for (auto& part : parts) {
+        if (const int at = part.indexOf('@'); at >= 0) {
+            part.truncate(at);
+        }
+    }
+    const QString path = parts.join('/');
+    QString result;
+    for (int i = 0; i < path.size(); i++) {
+        if (path[i] == '!' && i + 1 < path.size()) {
+            result += path[++i].toUpper();
+        } else {
+            result += path[i];
+        }
+    }
+    return result;
+}
+
+// Compares semantic versions ("v1.2.3", "v1.3.0-rc.1", pseudo-versions
+// "v0.0.0-20231010123456-abcdef"): numbers first, a release is above
+// its pre-releases, whose identifiers compare numerically or textually.
+static int compareVersions(const QString& a, const QString& b) {
+    auto split = [](const QString& version) {
+        QString core = version.startsWith('v') ? version.mid(1) : version;
+        core = core.section('+', 0, 0);
+        const int dash = core.indexOf('-');
+        const QString pre = (dash < 0) ? QString() : core.mid(dash + 1);
+        return std::make_pair((dash < 0) ? core : core.left(dash), pre);
+    };
+    auto compareIds = [](const QStringList& x, const QStringList& y, const bool numeric) {
+        for (int i = 0; i < std::min(x.size(), y.size()); i++) {
+            bool xnum = false, ynum = false;
+            const qlonglong xn = x[i].toLongLong(&xnum);
+            const qlonglong yn = y[i].toLongLong(&ynum);
+            if (numeric || (xnum && ynum)) {
+                if (xn != yn) {
+                    return xn < yn ? -1 : 1;
+                }
+            } else if (xnum != ynum) {
+                return xnum ? -1 : 1;
+            } else if (const int c = QString::compare(x[i], y[i]); c != 0) {
+                return c < 0 ? -1 : 1;
+            }
+        }
+        return (x.size() == y.size()) ? 0 : (x.size() < y.size() ? -1 : 1);
+    };
+    const auto [coreA, preA] = split(a);
+    const auto [coreB, preB] = split(b);
+    if (const int c = compareIds(coreA.split('.'), coreB.split('.'), true); c != 0) {
+        return c;
+    }
+    if (preA.isEmpty() || preB.isEmpty()) {
+        return (preA.isEmpty() == preB.isEmpty()) ? 0 : (preA.isEmpty() ? 1 : -1);
+    }
+    return compareIds(preA.split('.'), preB.split('.'), false);
+}
+
+// The module cache keeps every downloaded version of a module side by
+// side ("text@v0.13.0", "text@v0.14.0"); only the highest is indexed.
+static QFileInfoList latestVersions(const QFileInfoList& entries) {
+    QHash<QString, int> best;   // module name -> index in entries
+    QFileInfoList result;
+    for (const auto& info : entries) {
+        const QString name = info.fileName();
+        const int at = name.indexOf('@');
+        if (at < 0 || !info.isDir()) {
+            result.append(info);
+            continue;
+        }
+        const auto it = best.find(name.left(at));
+        if (it == best.end()) {
+            best.insert(name.left(at), result.size());
+            result.append(info);
+        } else if (compareVersions(name.mid(at + 1), result[it.value()].fileName().section('@', 1)) > 0) {
+            result[it.value()] = info;
+        }
+    }
+    return result;
+}
+
+static bool isSkipped(const QString& name) {
+    return name.startsWith('.') || name.startsWith('_')
+           || name == "testdata" || name == "vendor" || name == "internal";
+}
+
+// Directories with Go files under the root. Internal packages, tests
+// and commands of the toolchain are left out, as well as the download
+// cache and older versions of modules in the module cache.
+static void walk(const QString& root, QVector<Dir>& dirs, const std::function<bool()>& cancelled) {
+    const bool modules = !root.endsWith("/src");
+    QStringList stack{root};
+    while (!stack.isEmpty() && !cancelled()) {
+        const QString path = stack.takeLast();
+        const QString rel = path.mid(root.size() + 1);
+        Dir dir;
+        const auto filter = QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot | QDir::NoSymLinks;
+        const QFileInfoList entries = QDir(path).entryInfoList(filter, QDir::Name);
+        for (const auto& info : modules ? latestVersions(entries) : entries) {
+            const QString name = info.fileName();
+            if (info.isDir()) {
+                if (!isSkipped(name) && !(rel.isEmpty() && name == (modules ? "cache" : "cmd"))) {
+                    stack.append(info.filePath());
+                }
+            } else if (name.endsWith(".go") && !name.endsWith("_test.go")) {
+                dir.files.append(info.filePath());
+                dir.stamp = (dir.stamp ^ quint64(qHash(name) + info.lastModified().toMSecsSinceEpoch() + info.size())) * 1099511628211ULL;
+            }
+        }
+        if (!dir.files.isEmpty() && !rel.isEmpty()) {
+            dir.path = path;
+            dir.import = modules ? modulePath(rel) : rel;
+            dirs.append(dir);
+        }
+    }
+}
+
+static QByteArray compress(const std::string& declaration, const std::string& comment) {
+    QByteArray data = QByteArray::fromStdString(declaration);
+    data += Separator;
+    data += QByteArray::fromStdString(comment);
+    return qCompress(data);
+}
+
+// Parses files of the package (called in parallel for a batch).
+// Commands (package main) get no entries.
+static void extract(Dir& dir) {
+    std::string packageDoc;
+    for (const auto& path : dir.files) {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        const QByteArray data = file.readAll();
+        const std::string_view text(data.constData(), size_t(data.size()));
+        GoParser parser(text);
+        const auto symbols = parser.parse();
+        const std::string& package = parser.package();
+        if (package.empty() || package == "main" || (!dir.name.empty() && package != dir.name)) {
+            continue;
+        }
+        dir.name = package;
+
+        const GoDoc doc(text);
+        if (packageDoc.empty() || path.endsWith("/doc.go")) {
+            if (std::string comment = doc.packageComment(); !comment.empty()) {
+                packageDoc = std::move(comment);
+            }
+        }
+        for (const auto& symbol : symbols) {
+            if (!GoDoc::isExported(symbol.name) || !(symbol.container.empty() || GoDoc::isExported(symbol.container))) {
+                continue;
+            }
+            dir.symbols.push_back({
+                symbol.name,
+                symbol.container,
+                int(symbol.kind),
+                path,
+                symbol.line,
+                compress(doc.declaration(symbol), doc.comment(symbol.line))
+            });
+        }
+    }
+    if (!dir.name.empty()) {
+        dir.symbols.push_back({dir.name, std::string(), DocIndex::Package, dir.path, 0, compress("package " + dir.name, packageDoc)});
+    }
+}
+
+// Writes packages of a batch in one transaction.
+static bool store(const QVector<Dir>& dirs) {
+    return SQLite::docs().transaction([&dirs](SQLite& db) {
+        for (const auto& dir : dirs) {
+            i64 id = dir.id;
+            const std::vector<Field> fields{
+                Field("import", dir.import.toStdString()),
+                Field("name", dir.name),
+                Field("stamp", i64(dir.stamp))
+            };
+            if (id) {
+                std::vector<Field> values{Field("id", id)};
+                values.insert(values.end(), fields.begin(), fields.end());
+                if (!db.exec("DELETE FROM symbols WHERE package = :id", {Field("id", id)}) || !db.update("packages", values)) {
+                    return false;
+                }
+            } else {
+                std::vector<Field> values{Field("dir", dir.path.toStdString())};
+                values.insert(values.end(), fields.begin(), fields.end());
+                if ((id = db.insert("packages", values)) < 0) {
+                    return false;
+                }
+            }
+
+            std::vector<Row> rows;
+            rows.reserve(dir.symbols.size());
+            for (const auto& symbol : dir.symbols) {
+                rows.push_back({
+                    Field("package", id),
+                    Field("name", symbol.name),
+                    Field("container", symbol.container),
+                    Field("kind", i64(symbol.kind)),
+                    Field("path", symbol.path.toStdString()),
+                    Field("line", i64(symbol.line)),
+                    Field("doc", vec(symbol.doc.begin(), symbol.doc.end()))
+                });
+            }
+            if (!rows.empty() && !db.insert("symbols", rows)) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+// Packages which are no longer on the disk.
+static bool removePackages(const QList<qint64>& ids) {
+    return SQLite::docs().transaction([&ids](SQLite& db) {
+        for (const qint64 value : ids) {
+            const Field id("id", i64(value));
+            if (!db.exec("DELETE FROM symbols WHERE package = :id", {id}) || !db.exec("DELETE FROM packages WHERE id = :id", {id})) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+static QVector<DocIndex::Entry> entries(const Result& rows) {
+    QVector<DocIndex::Entry> result;
+    result.reserve(int(rows.size()));
+    for (const auto& row : rows) {
+        result.append({
+            row[0].as_i64(),
+            QString::fromStdString(row[1].as_text()),
+            QString::fromStdString(row[2].as_text()),
+            int(row[3].as_i64()),
+            QString::fromStdString(row[4].as_text()),
+            QString::fromStdString(row[5].as_text()),
+            int(row[6].as_i64())
+        });
+    }
+    return result;
+}
+
+// Go doc comment as HTML: paragraphs, headings ("# Title"), lists
+// and indented (preformatted) blocks.
+static QString commentHtml(const QString& text) {
+    static const QRegularExpression listItem(R"(^\s*(?:[-*+]|\d+[.)])\s+)");
+
+    QString html;
+    QString paragraph;
+    QString code;
+    bool list = false;
+    auto flush = [&] {
+        if (!paragraph.isEmpty()) {
+            html += "<p>" + paragraph.toHtmlEscaped() + "</p>";
+            paragraph.clear();
+        }
+        while (code.endsWith('\n')) {
+            code.chop(1);
+        }
+        if (!code.isEmpty()) {
+            html += "<pre>" + code.toHtmlEscaped() + "</pre>";
+            code.clear();
+        }
+        if (list) {
+            html += "</ul>";
+            list = false;
+        }
+    };
+
+    for (const QString& line : text.split('\n')) {
+        if (line.trimmed().isEmpty()) {
+            if (code.isEmpty()) {
+                flush();
+            } else {
+                code += '\n';
+            }
+            continue;
+        }
+        if (const auto match = listItem.match(line); match.hasMatch()) {
+            if (!list) {
+                flush();
+                html += "<ul>";
+                list = true;
+            }
+            html += "<li>" + line.mid(match.capturedLength()).toHtmlEscaped() + "</li>";
+            continue;
+        }
+        if (line[0] == ' ' || line[0] == '\t') {
+            if (!paragraph.isEmpty() || list) {
+                flush();
+            }
+            code += line.mid(1) + '\n';
+            continue;
+        }
+        if (line.startsWith("# ")) {
+            flush();
+            html += "<h3>" + line.mid(2).toHtmlEscaped() + "</h3>";
+            continue;
+        }
+        if (!code.isEmpty() || list) {
+            flush();
+        }
+        paragraph += paragraph.isEmpty() ? line : ' ' + line;
+    }
+    flush();
+    return html;
+}
+
+//*******************************************************************
+//                             DocIndex                         CTOR
+//*******************************************************************
+DocIndex::DocIndex(QObject* parent)
+    : QObject(parent)
+    , _epoch(0)
+    , _busy(false)
+{
+    // One thread: only one pass writes the database.
+    // Parsing itself runs on the global pool.
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                             ~DocIndex                        dtor *
+********************************************************************/
+DocIndex::~DocIndex() {
+    cancel();
+    DocDatabase::close();
+}
+
+/********************************************************************
+*                               open                         public *
+*-------------------------------------------------------------------*
+* Opens the database and loads the names in background. The first   *
+* time (empty database) the packages are indexed before.            *
+********************************************************************/
+bool DocIndex::open() {
+    if (!DocDatabase::open()) {
+        return false;
+    }
+    if (!_table && !_busy) {
+        const auto rows = SQLite::docs().select("SELECT count(*) FROM packages");
+        run(rows.empty() || rows[0][0].as_i64() == 0);
+    }
+    return true;
+}
+
+/********************************************************************
+*                              update                        public *
+*-------------------------------------------------------------------*
+* Indexes new and changed packages again (after 'go get', a new Go  *
+* release, ...).                                                    *
+********************************************************************/
+void DocIndex::update() {
+    if (!_busy && DocDatabase::open()) {
+        run(true);
+    }
+}
+
+/********************************************************************
+*                              cancel                        public *
+*-------------------------------------------------------------------*
+* Stops the work in progress and waits for it. What was stored      *
+* stays, the next update continues from there.                      *
+********************************************************************/
+void DocIndex::cancel() {
+    ++_epoch;
+    _pool.clear();
+    _pool.waitForDone();
+    _busy = false;
+}
+
+/********************************************************************
+*                              search                        public *
+*-------------------------------------------------------------------*
+* Names starting with the text (exact and short ones first), then   *
+* names matching it fuzzily. "Qualifier.name" looks for members of  *
+* the type or symbols of the package named by the qualifier.        *
+********************************************************************/
+QVector<DocIndex::Entry> DocIndex::search(const QString& text, const int limit) const {
+    auto& db = SQLite::docs();
+    const QString query = text.trimmed();
+    if (!_table || query.isEmpty() || !db.isOpen()) {
+        return {};
+    }
+    TraceScope trace("DocIndex::search", "docs");
+
+    if (const int dot = query.lastIndexOf('.'); dot > 0) {
+        std::string pattern;
+        for (const char c : query.mid(dot + 1).toStdString()) {
+            if (c == '%' || c == '_' || c == '\\') {
+                pattern += '\\';
+            }
+            pattern += c;
+        }
+        return entries(db.select(
+            std::string(Columns) + Tables +
+            " WHERE (s.container = :qualifier COLLATE NOCASE OR p.name = :qualifier COLLATE NOCASE OR p.import = :qualifier)"
+            " AND s.kind <> 0 AND s.name LIKE :name ESCAPE '\\'"
+            " ORDER BY s.name = :exact COLLATE NOCASE DESC, length(s.name), s.name, p.import"
+            " LIMIT :limit",
+            {Field("qualifier", query.left(dot).toStdString()),
+             Field("name", pattern + '%'),
+             Field("exact", query.mid(dot + 1).toStdString()),
+             Field("limit", i64(limit))}));
+    }
+
+    const Table& table = *_table;
+    const auto& all = table.entries;
+    const std::string name = query.toStdString();
+
+    const auto begin = std::lower_bound(all.begin(), all.end(), name, [&table](const Name& entry, const std::string& value) {
+        return compareNoCase(table.names[entry.name], value) < 0;
+    });
+    const auto end = std::partition_point(begin, all.end(), [&table, &name](const Name& entry) {
+        return startsWithNoCase(table.names[entry.name], name);
+    });
+
+    // Prefix matches: exact first, then the shorter the better.
+    std::vector<std::pair<size_t, qint64>> prefixed;
+    for (auto it = begin; it != end && int(prefixed.size()) < MaxPrefixHits; ++it) {
+        const size_t length = table.names[it->name].size();
+        prefixed.emplace_back(length == name.size() ? 0 : length, it->id);
+    }
+    std::stable_sort(prefixed.begin(), prefixed.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    std::vector<qint64> ids;
+    for (size_t i = 0; i < prefixed.size() && int(ids.size()) < limit; i++) {
+        ids.push_back(prefixed[i].second);
+    }
+
+    if (int(ids.size()) < limit) {
+        std::string pattern;
+        for (const char c : name) {
+            pattern += Fuzzy::lower(c);
+        }
+        const uint64_t mask = Fuzzy::mask(pattern);
+        std::vector<std::pair<int, qint64>> scored;
+        for (auto it = all.begin(); it != all.end(); ++it) {
+            if (it == begin) {
+                it = end;
+                if (it == all.end()) {
+                    break;
+                }
+            }
+            if ((it->mask & mask) == mask) {
+                if (const int score = Fuzzy::score(pattern, table.names[it->name]); score != Fuzzy::NoMatch) {
+                    scored.emplace_back(score, it->id);
+                }
+            }
+        }
+        const size_t keep = std::min(scored.size(), size_t(limit) - ids.size());
+        std::partial_sort(scored.begin(), scored.begin() + ptrdiff_t(keep), scored.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+        for (size_t i = 0; i < keep; i++) {
+            ids.push_back(scored[i].second);
+        }
+    }
+    if (ids.empty()) {
+        return {};
+    }
+
+    // Details of the hits, in the order of ranking.
+    std::string list;
+    for (const qint64 id : ids) {
+        list += (list.empty() ? "" : ",") + std::to_string(id);
+    }
+    const auto found = entries(db.select(std::string(Columns) + Tables + " WHERE s.id IN (" + list + ")"));
+    QHash<qint64, int> index;
+    for (int i = 0; i < found.size(); i++) {
+        index.insert(found[i].id, i);
+    }
+    QVector<Entry> result;
+    result.reserve(found.size());
+    for (const qint64 id : ids) {
+        if (const auto it = index.find(id); it != index.end()) {
+            result.append(found[it.value()]);
+        }
+    }
+    return result;
+}
+
+/********************************************************************
+*                             document                       public *
+*-------------------------------------------------------------------*
+* Text of the entry, with the index of its package or type.         *
+********************************************************************/
+DocIndex::Document DocIndex::document(const qint64 id) const {
+    auto& db = SQLite::docs();
+    if (!db.isOpen()) {
+        return {};
+    }
+    const auto rows = db.select(std::string(Columns) + ", s.doc, s.package" + Tables + " WHERE s.id = :id",
+                                {Field("id", i64(id))});
+    if (rows.empty()) {
+        return {};
+    }
+
+    Document doc;
+    doc.entry = entries(rows)[0];
+    const vec blob = rows[0][7].as_vector();
+    const QByteArray data = qUncompress(reinterpret_cast<const uchar*>(blob.data()), int(blob.size()));
+    const int separator = data.indexOf(Separator);
+    doc.declaration = QString::fromUtf8(data.left(separator));
+    doc.text = QString::fromUtf8(data.mid(separator + 1));
+
+    const Field package("package", rows[0][8].as_i64());
+    if (doc.entry.kind == Package) {
+        doc.members = entries(db.select(
+            std::string(Columns) + Tables +
+            " WHERE s.package = :package AND s.container = '' AND s.kind <> 0 ORDER BY s.kind, s.name",
+            {package}));
+    } else if (doc.entry.kind == GoSymbol::Type) {
+        doc.members = entries(db.select(
+            std::string(Columns) + Tables +
+            " WHERE s.package = :package AND s.container = :name ORDER BY s.kind, s.name",
+            {package, Field("name", doc.entry.name.toStdString())}));
+    }
+    return doc;
+}
+
+/********************************************************************
+*                               html                  public static *
+*-------------------------------------------------------------------*
+* Page of the document. Links: "doc:<id>" to other entries, "src:"  *
+* to the source of this one.                                        *
+********************************************************************/
+QString DocIndex::html(const Document& doc) {
+    const Entry& entry = doc.entry;
+    QString title = entry.name;
+    if (entry.kind == Package) {
+        title = "package " + entry.name;
+    } else if (!entry.container.isEmpty()) {
+        title = entry.container + '.' + entry.name;
+    }
+
+    QString html = QString("<h2>%1</h2><p><code>%2</code> &mdash; <a href=\"src:\">source</a></p>")
+                   .arg(title.toHtmlEscaped(), entry.package.toHtmlEscaped());
+    if (entry.kind != Package) {
+        html += "<pre>" + doc.declaration.toHtmlEscaped() + "</pre>";
+    }
+    html += commentHtml(doc.text);
+
+    if (!doc.members.isEmpty()) {
+        html += "<h3>Index</h3><ul>";
+        for (const auto& member : doc.members) {
+            html += QString("<li>%1 <a href=\"doc:%2\">%3</a></li>")
+                    .arg(kindName(member.kind)).arg(member.id).arg(member.name.toHtmlEscaped());
+        }
+        html += "</ul>";
+    }
+    return html;
+}
+
+/********************************************************************
+*                             kindName                public static *
+********************************************************************/
+QString DocIndex::kindName(const int kind) {
+    return kind == Package ? QString("package") : SymbolIndex::kindName(kind);
+}
+
+/********************************************************************
+*                                run                        private *
+*-------------------------------------------------------------------*
+* Indexes packages (when 'sync') and loads the names in the pool    *
+* thread; the new table of names replaces the old one when ready.   *
+********************************************************************/
+void DocIndex::run(const bool sync) {
+    _busy = true;
+    emit started();
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, sync, epoch] {
+        if (sync && !this->sync(epoch)) {
+            return;
+        }
+        const auto table = load();
+        QMetaObject::invokeMethod(this, [this, table, epoch] {
+            if (epoch == _epoch) {
+                _table = table;
+                _busy = false;
+                emit updated();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               sync                        private *
+*-------------------------------------------------------------------*
+* Runs in the pool thread. Walks GOROOT and the module cache and    *
+* parses packages whose files changed, in batches. Returns false    *
+* when cancelled.                                                   *
+********************************************************************/
+bool DocIndex::sync(const quint32 epoch) {
+    TraceScope trace("DocIndex::sync", "docs");
+    const auto cancelled = [this, epoch] {
+        return epoch != _epoch;
+    };
+
+    QHash<QString, QPair<qint64, qint64>> known;   // dir -> id, stamp
+    for (const auto& row : SQLite::docs().select("SELECT id, dir, stamp FROM packages")) {
+        known.insert(QString::fromStdString(row[1].as_text()), {row[0].as_i64(), row[2].as_i64()});
+    }
+
+    QVector<Dir> changed;
+    for (const auto& root : roots()) {
+        QVector<Dir> dirs;
+        walk(root, dirs, cancelled);
+        for (auto& dir : dirs) {
+            if (const auto it = known.find(dir.path); it != known.end()) {
+                dir.id = it->first;
+                const bool same = it->second == qint64(dir.stamp);
+                known.erase(it);
+                if (same) {
+                    continue;
+                }
+            }
+            changed.append(dir);
+        }
+    }
+
+    for (int i = 0; i < changed.size(); i += BatchSize) {
+        if (cancelled()) {
+            return false;
+        }
+        QVector<Dir> batch = changed.mid(i, BatchSize);
+        QtConcurrent::blockingMap(batch, extract);
+        if (!store(batch)) {
+            qWarning() << "DocIndex: can't store packages";
+            return false;
+        }
+    }
+    if (cancelled()) {
+        return false;
+    }
+
+    QList<qint64> gone;
+    for (const auto& value : known) {
+        gone.append(value.first);
+    }
+    if (!gone.isEmpty() && !removePackages(gone)) {
+        qWarning() << "DocIndex: can't remove packages";
+    }
+    return true;
+}
+
+/********************************************************************
+*                               load                 private static *
+*-------------------------------------------------------------------*
+* Names of all entries sorted case insensitively, with their masks. *
+********************************************************************/
+std::shared_ptr<const DocIndex::Table> DocIndex::load() {
+    TraceScope trace("DocIndex::load", "docs");
+    auto table = std::make_shared<Table>();
+    const auto rows = SQLite::docs().select("SELECT id, name FROM symbols");
+    table->entries.reserve(rows.size());
+    for (const auto& row : rows) {
+        const std::string name = row[1].as_text();
+        table->entries.push_back({table->names.intern(name), Fuzzy::mask(name), row[0].as_i64()});
+    }
+    const StringPool& names = table->names;
+    std::sort(table->entries.begin(), table->entries.end(), [&names](const Name& a, const Name& b) {
+        return compareNoCase(names[a.name], names[b.name]) < 0;
+    });
+    return table;
+}
+
+/********************************************************************
+*                               roots                private static *
+*-------------------------------------------------------------------*
+* GOROOT/src and the module cache. Taken from the environment or    *
+* from 'go env', which needs no network.                            *
+********************************************************************/
+QStringList DocIndex::roots() {
+    QString goroot = qEnvironmentVariable("GOROOT");
+    QString modules = qEnvironmentVariable("GOMODCACHE");
+    if (goroot.isEmpty() || modules.isEmpty()) {
+        QProcess go;
+        go.start("go", {"env", "GOROOT", "GOMODCACHE"});
+        if (go.waitForFinished(ProcessTimeoutMs) && go.exitCode() == 0) {
+            const QStringList lines = QString::fromLocal8Bit(go.readAllStandardOutput()).split('\n');
+            if (goroot.isEmpty() && lines.size() > 0) {
+                goroot = lines[0].trimmed();
+            }
+            if (modules.isEmpty() && lines.size() > 1) {
+                modules = lines[1].trimmed();
+            }
+        }
+    }
+    if (modules.isEmpty()) {
+        const QString gopath = qEnvironmentVariable("GOPATH", QDir::homePath() + "/go");
+        modules = gopath.section(QDir::listSeparator(), 0, 0) + "/pkg/mod";
+    }
+
+    QStringList result;
+    if (!goroot.isEmpty() && QFileInfo(goroot + "/src").isDir()) {
+        result.append(QDir::cleanPath(goroot + "/src"));
+    }
+    if (QFileInfo(modules).isDir()) {
+        result.append(QDir::cleanPath(modules));
+    }
+    return result;
+}
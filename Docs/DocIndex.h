@@ -0,0 +1,112 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DocIndex.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DOC_INDEX_H
+#define GOEDIT_DOC_INDEX_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QVector>
+#include <QThreadPool>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "Shared/StringPool.h"
+
+/********************************************************************
+*                             DocIndex                              *
+*-------------------------------------------------------------------*
+* Documentation of exported declarations of all packages of GOROOT  *
+* and of the module cache, extracted from the sources (GoDoc) into  *
+* the DocDatabase; nothing needs the network. Only packages whose   *
+* files changed are parsed again. Names are kept in memory, sorted, *
+* for prefix and fuzzy search; the compressed text of a document is *
+* read from the database and rendered only when it is shown.        *
+********************************************************************/
+class DocIndex : public QObject {
+    Q_OBJECT
+public:
+    static constexpr int Package = 0;  // kind of package entries
+
+    struct Entry {
+        qint64 id;
+        QString name;
+        QString container;      // receiver of a method, owner of a field
+        int kind;               // GoSymbol::Kind or Package
+        QString package;        // import path
+        QString path;           // source file, directory of a package
+        int line;               // 0-based
+    };
+    struct Document {
+        Entry entry;
+        QString declaration;
+        QString text;
+        QVector<Entry> members; // of a package or of a type
+    };
+private:
+    struct Name {
+        uint32_t name;          // in Table::names
+        uint64_t mask;
+        qint64 id;
+    };
+    struct Table {
+        StringPool names;
+        std::vector<Name> entries;  // sorted by name, case insensitive
+    };
+
+    std::shared_ptr<const Table> _table;
+    std::atomic<quint32> _epoch;
+    bool _busy;
+    QThreadPool _pool;
+public:
+    explicit DocIndex(QObject* = nullptr);
+    ~DocIndex() override;
+
+    bool open();
+    void update();
+    void cancel();
+    bool isBusy() const {
+        return _busy;
+    }
+    size_t size() const {
+        return _table ? _table->entries.size() : 0;
+    }
+    QVector<Entry> search(const QString&, const int) const;
+    Document document(const qint64) const;
+    static QString html(const Document&);
+    static QString kindName(const int);
+
+private:
+    void run(const bool);
+    bool sync(const quint32);
+    static std::shared_ptr<const Table> load();
+    static QStringList roots();
+
+signals:
+    void started();
+    void updated();
+};
+
+#endif // GOEDIT_DOC_INDEX_H
@@ -0,0 +1,216 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoDoc.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "GoDoc.h"
+
+//*******************************************************************
+//                               GoDoc                          CTOR
+//*******************************************************************
+GoDoc::GoDoc(std::string_view text)
+    : _text(text)
+{
+    _lines.push_back(0);
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\n') {
+            _lines.push_back(i + 1);
+        }
+    }
+}
+
+/********************************************************************
+*                              comment                       public *
+*-------------------------------------------------------------------*
+* Text of the comment ending on the line above the line 'line'      *
+* (0-based), with the comment markers removed. Both a run of line   *
+* comments and a block comment (its lines trimmed) are taken.       *
+********************************************************************/
+std::string GoDoc::comment(const int line) const {
+    int first = line;
+    std::vector<std::string_view> parts;
+
+    if (line > 0 && trimmed(this->line(line - 1)).substr(0, 2) != "//") {
+        // Block comment: from "*/" above up to its "/*".
+        const std::string_view last = trimmed(this->line(line - 1));
+        if (last.size() < 2 || last.substr(last.size() - 2) != "*/") {
+            return std::string();
+        }
+        for (first = line - 1; first >= 0; --first) {
+            if (trimmed(this->line(first)).substr(0, 2) == "/*") {
+                break;
+            }
+        }
+        if (first < 0) {
+            return std::string();
+        }
+        for (int i = first; i < line; i++) {
+            std::string_view text = this->line(i);
+            if (i == first) {
+                text = text.substr(text.find("/*") + 2);
+            }
+            if (i == line - 1) {
+                text = text.substr(0, text.rfind("*/"));
+            }
+            parts.push_back(trimmed(text));
+        }
+    } else {
+        while (first > 0 && trimmed(this->line(first - 1)).substr(0, 2) == "//") {
+            --first;
+        }
+        for (int i = first; i < line; i++) {
+            std::string_view text = trimmed(this->line(i)).substr(2);
+            if (isDirective(text)) {
+                continue;
+            }
+            if (!text.empty() && text[0] == ' ') {
+                text.remove_prefix(1);
+            }
+            parts.push_back(text);
+        }
+    }
+
+    // Leading and trailing empty lines are not a part of the text.
+    while (!parts.empty() && trimmed(parts.back()).empty()) {
+        parts.pop_back();
+    }
+    size_t begin = 0;
+    while (begin < parts.size() && trimmed(parts[begin]).empty()) {
+        ++begin;
+    }
+    std::string result;
+    for (size_t i = begin; i < parts.size(); i++) {
+        result.append(parts[i]);
+        result += '\n';
+    }
+    return result;
+}
+
+/********************************************************************
+*                            declaration                     public *
+*-------------------------------------------------------------------*
+* Source of the declaration from the start of the line of the       *
+* symbol up to the end of the statement, or up to the body of a     *
+* function. Long declarations (struct types, composite literals)    *
+* are cut after MaxDeclarationLines lines.                          *
+********************************************************************/
+std::string GoDoc::declaration(const GoSymbol& symbol) const {
+    if (symbol.line < 0 || size_t(symbol.line) >= _lines.size()) {
+        return std::string();
+    }
+    const size_t start = _lines[size_t(symbol.line)];
+    GoLexer<char> lexer(_text.data() + start, int(_text.size() - start));
+    const bool function = symbol.kind == GoSymbol::Function || symbol.kind == GoSymbol::Method;
+
+    int depth = 0;
+    size_t end = _text.size() - start;
+    for (GoToken token = lexer.next(); token.kind != GoToken::End; token = lexer.next()) {
+        if (token.line >= MaxDeclarationLines) {
+            return std::string(trimmed(_text.substr(start, size_t(token.begin) - size_t(token.column)))) + "\n\t...";
+        }
+        if (token.kind == GoToken::LParen || token.kind == GoToken::LBracket || token.kind == GoToken::LBrace) {
+            if (function && depth == 0 && token.kind == GoToken::LBrace) {
+                end = size_t(token.begin);
+                break;
+            }
+            ++depth;
+        } else if (token.kind == GoToken::RParen || token.kind == GoToken::RBracket || token.kind == GoToken::RBrace) {
+            if (--depth < 0) {
+                // end of the group the symbol is in
+                end = size_t(token.begin);
+                break;
+            }
+        } else if (token.kind == GoToken::Semicolon && depth == 0) {
+            end = size_t(token.begin);
+            break;
+        }
+    }
+    return std::string(trimmed(_text.substr(start, end)));
+}
+
+/********************************************************************
+*                           packageComment                   public *
+*-------------------------------------------------------------------*
+* Comment above the package clause (the package documentation).     *
+********************************************************************/
+std::string GoDoc::packageComment() const {
+    for (size_t i = 0; i < _lines.size(); i++) {
+        if (line(int(i)).substr(0, 8) == "package ") {
+            return comment(int(i));
+        }
+    }
+    return std::string();
+}
+
+/********************************************************************
+*                            isExported               public static *
+*-------------------------------------------------------------------*
+* Name starts with an upper case letter. Names with non-ASCII first *
+* letters are taken as not exported, they are rare in libraries.    *
+********************************************************************/
+bool GoDoc::isExported(std::string_view name) {
+    return !name.empty() && name[0] >= 'A' && name[0] <= 'Z';
+}
+
+/********************************************************************
+*                               line                        private *
+*-------------------------------------------------------------------*
+* Text of the line without the line terminator.                     *
+********************************************************************/
+std::string_view GoDoc::line(const int n) const {
+    const size_t begin = _lines[size_t(n)];
+    size_t end = (size_t(n) + 1 < _lines.size()) ? _lines[size_t(n) + 1] - 1 : _text.size();
+    if (end > begin && _text[end - 1] == '\r') {
+        --end;
+    }
+    return _text.substr(begin, end - begin);
+}
+
+/********************************************************************
+*                              trimmed               private static *
+********************************************************************/
+std::string_view GoDoc::trimmed(std::string_view text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r' || text.back() == '\n')) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+/********************************************************************
+*                            isDirective             private static *
+*-------------------------------------------------------------------*
+* "//go:build", "//nolint:errcheck": a word and a colon right after *
+* the slashes, as recognized by gofmt.                              *
+********************************************************************/
+bool GoDoc::isDirective(std::string_view text) {
+    size_t i = 0;
+    while (i < text.size() && ((text[i] >= 'a' && text[i] <= 'z') || (text[i] >= '0' && text[i] <= '9'))) {
+        ++i;
+    }
+    return i > 0 && i + 1 < text.size() && text[i] == ':' && text[i + 1] >= 'a' && text[i + 1] <= 'z';
+}
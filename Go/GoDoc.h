@@ -0,0 +1,64 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoDoc.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_GO_DOC_H
+#define GOEDIT_GO_DOC_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "GoParser.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/********************************************************************
+*                               GoDoc                               *
+*-------------------------------------------------------------------*
+* Documentation of declarations found by GoParser, taken from the   *
+* source as go doc does: the comment directly above a declaration   *
+* (directives like //go:build left out) and the declaration itself  *
+* without the body of a function.                                   *
+********************************************************************/
+class GoDoc {
+    static constexpr int MaxDeclarationLines = 40;
+
+    const std::string_view _text;
+    std::vector<size_t> _lines;         // offsets of line starts
+public:
+    explicit GoDoc(std::string_view);
+    GoDoc(const GoDoc&) = delete;
+    GoDoc& operator=(const GoDoc&) = delete;
+
+    std::string comment(const int) const;
+    std::string declaration(const GoSymbol&) const;
+    std::string packageComment() const;
+
+    static bool isExported(std::string_view);
+private:
+    std::string_view line(const int) const;
+    static std::string_view trimmed(std::string_view);
+    static bool isDirective(std::string_view);
+};
+
+#endif // GOEDIT_GO_DOC_H
@@ -0,0 +1,331 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoLexer.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_GO_LEXER_H
+#define GOEDIT_GO_LEXER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/********************************************************************
+*                              GoToken                              *
+********************************************************************/
+struct GoToken {
+    enum Kind : uint8_t {
+        End = 0,
+        Identifier,
+        Keyword,
+        Number,
+        String,
+        RawString,
+        Rune,
+        Comment,
+        Operator,
+        LParen,
+        RParen,
+        LBrace,
+        RBrace,
+        LBracket,
+        RBracket,
+        Comma,
+        Dot,
+        Semicolon       // explicit or inserted at the end of line
+    };
+
+    Kind kind;
+    int begin;
+    int length;
+    int line;           // 0-based
+    int column;         // 0-based, in code units
+};
+
+/********************************************************************
+*                              GoLexer                              *
+*-------------------------------------------------------------------*
+* Tokenizer of Go source. Works on UTF-8 bytes (indexers) as well   *
+* as on UTF-16 (QString, highlighting), only ASCII is significant;  *
+* any non-ASCII code unit is taken as a part of an identifier.      *
+* The lexer can start and end in the middle of a block comment or   *
+* a raw string, so it can be run line by line. At the end of text   *
+* End is returned in any state (the state is kept for the next      *
+* line).                                                            *
+* Semicolons are inserted at line ends following Go rules.          *
+********************************************************************/
+template<typename Char>
+class GoLexer {
+public:
+    enum State : uint8_t {
+        Normal = 0,
+        InComment,
+        InRawString
+    };
+private:
+    const Char* const _text;
+    const int _size;
+    int _pos;
+    int _line;
+    int _lineStart;
+    State _state;
+    bool _needSemicolon;
+public:
+    GoLexer(const Char* text, const int size, const State state = Normal)
+        : _text(text)
+        , _size(size)
+        , _pos(0)
+        , _line(0)
+        , _lineStart(0)
+        , _state(state)
+        , _needSemicolon(false)
+    {}
+
+    State state() const {
+        return _state;
+    }
+    int position() const {
+        return _pos;
+    }
+    bool equals(const GoToken& token, const char* word) const {
+        const int n = int(strlen(word));
+        if (token.length != n) return false;
+        for (int i = 0; i < n; i++) {
+            if (code(_text[token.begin + i]) != uint32_t(static_cast<unsigned char>(word[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    GoToken next() {
+        if (_state != Normal && _pos >= _size) {
+            return make(GoToken::End, _pos, 0);
+        }
+        if (_state == InComment) {
+            return blockComment(_pos);
+        }
+        if (_state == InRawString) {
+            return rawString(_pos);
+        }
+
+        for (;;) {
+            if (_pos >= _size) {
+                if (_needSemicolon) {
+                    _needSemicolon = false;
+                    return make(GoToken::Semicolon, _pos, 0);
+                }
+                return make(GoToken::End, _pos, 0);
+            }
+            const uint32_t c = code(_text[_pos]);
+            if (c == '\n') {
+                if (_needSemicolon) {
+                    _needSemicolon = false;
+                    return make(GoToken::Semicolon, _pos, 0);
+                }
+                newline(++_pos);
+                continue;
+            }
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\f') {
+                ++_pos;
+                continue;
+            }
+            break;
+        }
+
+        const int start = _pos;
+        const uint32_t c = code(_text[_pos]);
+        const uint32_t c1 = peek(1);
+
+        if (c == '/' && c1 == '/') {
+            while (_pos < _size && code(_text[_pos]) != '\n') ++_pos;
+            return make(GoToken::Comment, start, _pos - start);
+        }
+        if (c == '/' && c1 == '*') {
+            _pos += 2;
+            return blockComment(start);
+        }
+        if (c == '`') {
+            ++_pos;
+            return rawString(start);
+        }
+        if (c == '"' || c == '\'') {
+            ++_pos;
+            while (_pos < _size) {
+                const uint32_t x = code(_text[_pos]);
+                if (x == '\n') break;
+                ++_pos;
+                if (x == '\\' && _pos < _size && code(_text[_pos]) != '\n') {
+                    ++_pos;
+                } else if (x == c) {
+                    break;
+                }
+            }
+            _needSemicolon = true;
+            return make(c == '"' ? GoToken::String : GoToken::Rune, start, _pos - start);
+        }
+        if (isDigit(c) || (c == '.' && isDigit(c1))) {
+            ++_pos;
+            while (_pos < _size) {
+                const uint32_t x = code(_text[_pos]);
+                const uint32_t prev = code(_text[_pos - 1]) | 0x20;
+                if (isLetter(x) || isDigit(x) || x == '.') {
+                    ++_pos;
+                } else if ((x == '+' || x == '-') && (prev == 'e' || prev == 'p')) {
+                    ++_pos;
+                } else {
+                    break;
+                }
+            }
+            _needSemicolon = true;
+            return make(GoToken::Number, start, _pos - start);
+        }
+        if (isLetter(c)) {
+            ++_pos;
+            while (_pos < _size && (isLetter(code(_text[_pos])) || isDigit(code(_text[_pos])))) {
+                ++_pos;
+            }
+            GoToken token = make(GoToken::Identifier, start, _pos - start);
+            if (isKeyword(token)) {
+                token.kind = GoToken::Keyword;
+                _needSemicolon = equals(token, "break") || equals(token, "continue")
+                                 || equals(token, "fallthrough") || equals(token, "return");
+            } else {
+                _needSemicolon = true;
+            }
+            return token;
+        }
+
+        ++_pos;
+        switch (c) {
+        case '(': _needSemicolon = false; return make(GoToken::LParen, start, 1);
+        case ')': _needSemicolon = true;  return make(GoToken::RParen, start, 1);
+        case '{': _needSemicolon = false; return make(GoToken::LBrace, start, 1);
+        case '}': _needSemicolon = true;  return make(GoToken::RBrace, start, 1);
+        case '[': _needSemicolon = false; return make(GoToken::LBracket, start, 1);
+        case ']': _needSemicolon = true;  return make(GoToken::RBracket, start, 1);
+        case ',': _needSemicolon = false; return make(GoToken::Comma, start, 1);
+        case ';': _needSemicolon = false; return make(GoToken::Semicolon, start, 1);
+        case '.':
+            _needSemicolon = false;
+            if (c1 == '.' && peek(1) == '.') {
+                _pos += 2;
+                return make(GoToken::Operator, start, 3);
+            }
+            return make(GoToken::Dot, start, 1);
+        }
+
+        // operators: maximal run of operator characters
+        while (_pos < _size && isOperator(code(_text[_pos]))) {
+            const uint32_t x = code(_text[_pos]);
+            if (x == '/' && (peek(1) == '/' || peek(1) == '*')) break;
+            ++_pos;
+        }
+        const int length = _pos - start;
+        _needSemicolon = (length == 2) && ((c == '+' && c1 == '+') || (c == '-' && c1 == '-'));
+        return make(GoToken::Operator, start, length);
+    }
+
+private:
+    static uint32_t code(const Char c) {
+        if constexpr (std::is_same_v<Char, char>) {
+            return static_cast<unsigned char>(c);
+        } else {
+            return static_cast<uint32_t>(c);
+        }
+    }
+    static bool isDigit(const uint32_t c) {
+        return c >= '0' && c <= '9';
+    }
+    static bool isLetter(const uint32_t c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c >= 0x80;
+    }
+    static bool isOperator(const uint32_t c) {
+        switch (c) {
+        case '+': case '-': case '*': case '/': case '%': case '&': case '|':
+        case '^': case '<': case '>': case '=': case '!': case ':': case '~':
+            return true;
+        }
+        return false;
+    }
+    uint32_t peek(const int n) const {
+        return (_pos + n < _size) ? code(_text[_pos + n]) : 0;
+    }
+    void newline(const int pos) {
+        ++_line;
+        _lineStart = pos;
+    }
+    GoToken make(const GoToken::Kind kind, const int begin, const int length) const {
+        return {kind, begin, length, _line, begin - _lineStart};
+    }
+
+    // Token that may span lines; 'line' and 'column' are of its start.
+    template<typename Predicate>
+    GoToken multiline(const int start, const GoToken::Kind kind, const int closeLength, Predicate closes) {
+        const int line = _line;
+        const int column = start - _lineStart;
+        _state = (kind == GoToken::Comment) ? InComment : InRawString;
+        while (_pos < _size) {
+            if (closes(_pos)) {
+                _pos += closeLength;
+                _state = Normal;
+                break;
+            }
+            if (code(_text[_pos]) == '\n') {
+                newline(_pos + 1);
+            }
+            ++_pos;
+        }
+        if (kind == GoToken::RawString) {
+            _needSemicolon = true;
+        }
+        return {kind, start, _pos - start, line, column};
+    }
+    GoToken blockComment(const int start) {
+        return multiline(start, GoToken::Comment, 2, [this](const int p) {
+            return code(_text[p]) == '*' && p + 1 < _size && code(_text[p + 1]) == '/';
+        });
+    }
+    GoToken rawString(const int start) {
+        return multiline(start, GoToken::RawString, 1, [this](const int p) {
+            return code(_text[p]) == '`';
+        });
+    }
+
+    bool isKeyword(const GoToken& t) const {
+        static const char* const keywords[] = {
+            "break", "case", "chan", "const", "continue", "default", "defer",
+            "else", "fallthrough", "for", "func", "go", "goto", "if", "import",
+            "interface", "map", "package", "range", "return", "select", "struct",
+            "switch", "type", "var"
+        };
+        if (t.length < 2 || t.length > 11) return false;
+        for (const char* const kw : keywords) {
+            if (equals(t, kw)) return true;
+        }
+        return false;
+    }
+};
+
+#endif // GOEDIT_GO_LEXER_H
@@ -0,0 +1,372 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoParser.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "GoParser.h"
+
+//*******************************************************************
+//                             GoParser                         CTOR
+//*******************************************************************
+GoParser::GoParser(std::string_view text)
+    : _text(text)
+    , _lexer(text.data(), int(text.size()))
+    , _token()
+{
+    advance();
+}
+
+/********************************************************************
+*                               parse                        public *
+********************************************************************/
+std::vector<GoSymbol> GoParser::parse() {
+    while (_token.kind != GoToken::End) {
+        if (_token.kind == GoToken::Keyword) {
+            if (is("package")) {
+                advance();
+                if (_token.kind == GoToken::Identifier) {
+                    _package = text(_token);
+                }
+                skipStatement();
+                continue;
+            }
+            if (is("import")) {
+                advance();
+                group([this] { importSpec(); });
+                continue;
+            }
+            if (is("func")) {
+                advance();
+                function();
+                continue;
+            }
+            if (is("type")) {
+                advance();
+                group([this] { typeSpec(); });
+                continue;
+            }
+            if (is("const")) {
+                advance();
+                group([this] { valueSpec(GoSymbol::Constant); });
+                continue;
+            }
+            if (is("var")) {
+                advance();
+                group([this] { valueSpec(GoSymbol::Variable); });
+                continue;
+            }
+        }
+        skipStatement();
+    }
+    return std::move(_symbols);
+}
+
+/********************************************************************
+*                            importSpec                     private *
+*-------------------------------------------------------------------*
+* Optional name of the import ('.', '_' or an identifier) and the   *
+* quoted path; escapes are not expected in import paths.            *
+********************************************************************/
+void GoParser::importSpec() {
+    if (_token.kind == GoToken::Identifier || _token.kind == GoToken::Dot) {
+        advance();
+    }
+    if ((_token.kind == GoToken::String || _token.kind == GoToken::RawString) && _token.length >= 2) {
+        _imports.push_back(std::string(_text.substr(size_t(_token.begin) + 1, size_t(_token.length) - 2)));
+        advance();
+    }
+    skipSpec();
+}
+
+/********************************************************************
+*                             function                      private *
+*-------------------------------------------------------------------*
+* After 'func'. The type of a receiver is its last identifier at    *
+* the top level of the parentheses: (s *Server[T]) -> Server.       *
+********************************************************************/
+void GoParser::function() {
+    std::string receiver;
+    if (_token.kind == GoToken::LParen) {
+        int depth = 0;
+        for (;;) {
+            const GoToken::Kind kind = _token.kind;
+            if (kind == GoToken::End) return;
+            if (kind == GoToken::LParen || kind == GoToken::LBracket || kind == GoToken::LBrace) {
+                ++depth;
+            } else if (kind == GoToken::RParen || kind == GoToken::RBracket || kind == GoToken::RBrace) {
+                if (--depth == 0) {
+                    advance();
+                    break;
+                }
+            } else if (kind == GoToken::Identifier && depth == 1) {
+                receiver = text(_token);
+            }
+            advance();
+        }
+    }
+    if (_token.kind == GoToken::Identifier) {
+        if (receiver.empty()) {
+            add(GoSymbol::Function, _token);
+        } else {
+            add(GoSymbol::Method, _token, receiver);
+        }
+    }
+    skipStatement();
+}
+
+/********************************************************************
+*                             typeSpec                      private *
+********************************************************************/
+void GoParser::typeSpec() {
+    if (_token.kind != GoToken::Identifier) {
+        skipSpec();
+        return;
+    }
+    const std::string name = text(_token);
+    add(GoSymbol::Type, _token);
+    advance();
+
+    if (_token.kind == GoToken::LBracket) {
+        skipBalanced();         // type parameters
+    }
+    if (_token.kind == GoToken::Operator && _lexer.equals(_token, "=")) {
+        advance();              // alias
+    }
+    if (is("struct")) {
+        advance();
+        if (_token.kind == GoToken::LBrace) {
+            structFields(name);
+        }
+    } else if (is("interface")) {
+        advance();
+        if (_token.kind == GoToken::LBrace) {
+            interfaceMethods(name);
+        }
+    }
+    skipSpec();
+}
+
+/********************************************************************
+*                             valueSpec                     private *
+*-------------------------------------------------------------------*
+* const/var spec: the identifier list before the type or values.    *
+********************************************************************/
+void GoParser::valueSpec(const GoSymbol::Kind kind) {
+    while (_token.kind == GoToken::Identifier) {
+        add(kind, _token);
+        advance();
+        if (_token.kind != GoToken::Comma) {
+            break;
+        }
+        advance();
+    }
+    skipSpec();
+}
+
+/********************************************************************
+*                           structFields                    private *
+*-------------------------------------------------------------------*
+* Current token is '{'. Embedded fields are named after their type. *
+********************************************************************/
+void GoParser::structFields(const std::string& owner) {
+    advance();
+    while (_token.kind != GoToken::RBrace && _token.kind != GoToken::End) {
+        if (_token.kind == GoToken::Semicolon) {
+            advance();
+            continue;
+        }
+        if (_token.kind == GoToken::Operator && _lexer.equals(_token, "*")) {
+            advance();
+        }
+        if (_token.kind == GoToken::Identifier) {
+            GoToken first = _token;
+            advance();
+            if (_token.kind == GoToken::Comma) {
+                add(GoSymbol::Field, first, owner);
+                while (_token.kind == GoToken::Comma) {
+                    advance();
+                    if (_token.kind == GoToken::Identifier) {
+                        add(GoSymbol::Field, _token, owner);
+                        advance();
+                    }
+                }
+            } else if (_token.kind == GoToken::Dot) {
+                advance();      // embedded pkg.Type
+                if (_token.kind == GoToken::Identifier) {
+                    add(GoSymbol::Field, _token, owner);
+                }
+            } else {
+                add(GoSymbol::Field, first, owner);
+            }
+        }
+        while (_token.kind != GoToken::Semicolon && _token.kind != GoToken::RBrace && _token.kind != GoToken::End) {
+            skipBalanced();
+        }
+    }
+    if (_token.kind == GoToken::RBrace) {
+        advance();
+    }
+}
+
+/********************************************************************
+*                         interfaceMethods                  private *
+********************************************************************/
+void GoParser::interfaceMethods(const std::string& owner) {
+    advance();
+    while (_token.kind != GoToken::RBrace && _token.kind != GoToken::End) {
+        if (_token.kind == GoToken::Identifier) {
+            const GoToken name = _token;
+            advance();
+            if (_token.kind == GoToken::LParen) {
+                add(GoSymbol::Method, name, owner);
+            }
+        }
+        while (_token.kind != GoToken::Semicolon && _token.kind != GoToken::RBrace && _token.kind != GoToken::End) {
+            skipBalanced();
+        }
+        if (_token.kind == GoToken::Semicolon) {
+            advance();
+        }
+    }
+    if (_token.kind == GoToken::RBrace) {
+        advance();
+    }
+}
+
+/********************************************************************
+*                               group                       private *
+*-------------------------------------------------------------------*
+* Single spec or a parenthesized list of specs.                     *
+********************************************************************/
+template<typename Spec>
+void GoParser::group(Spec spec) {
+    if (_token.kind == GoToken::LParen) {
+        advance();
+        while (_token.kind != GoToken::RParen && _token.kind != GoToken::End) {
+            if (_token.kind == GoToken::Semicolon) {
+                advance();
+                continue;
+            }
+            const int position = _lexer.position();
+            spec();
+            if (_lexer.position() == position && _token.kind != GoToken::Semicolon && _token.kind != GoToken::RParen) {
+                advance();
+            }
+        }
+    } else {
+        spec();
+    }
+    skipStatement();
+}
+
+/********************************************************************
+*                           skipStatement                   private *
+*-------------------------------------------------------------------*
+* Skips tokens up to and including the semicolon at the top level.  *
+********************************************************************/
+void GoParser::skipStatement() {
+    while (_token.kind != GoToken::End) {
+        if (_token.kind == GoToken::Semicolon) {
+            advance();
+            return;
+        }
+        skipBalanced();
+    }
+}
+
+/********************************************************************
+*                             skipSpec                      private *
+*-------------------------------------------------------------------*
+* Skips to the end of a spec: ';' or ')' closing the group.         *
+********************************************************************/
+void GoParser::skipSpec() {
+    while (_token.kind != GoToken::End && _token.kind != GoToken::Semicolon && _token.kind != GoToken::RParen) {
+        skipBalanced();
+    }
+}
+
+/********************************************************************
+*                           skipBalanced                    private *
+*-------------------------------------------------------------------*
+* Skips one token, or the whole bracketed group if it opens one.    *
+* Unbalanced closing brackets are skipped on their own.             *
+********************************************************************/
+void GoParser::skipBalanced() {
+    int depth = 0;
+    do {
+        switch (_token.kind) {
+        case GoToken::End:
+            return;
+        case GoToken::LParen:
+        case GoToken::LBracket:
+        case GoToken::LBrace:
+            ++depth;
+            break;
+        case GoToken::RParen:
+        case GoToken::RBracket:
+        case GoToken::RBrace:
+            if (depth > 0) --depth;
+            break;
+        default:
+            break;
+        }
+        advance();
+    } while (depth > 0);
+}
+
+/********************************************************************
+*                              advance                      private *
+********************************************************************/
+void GoParser::advance() {
+    do {
+        _token = _lexer.next();
+    } while (_token.kind == GoToken::Comment);
+}
+
+/********************************************************************
+*                                is                         private *
+********************************************************************/
+bool GoParser::is(const char* keyword) const {
+    return _token.kind == GoToken::Keyword && _lexer.equals(_token, keyword);
+}
+
+/********************************************************************
+*                               text                        private *
+********************************************************************/
+std::string GoParser::text(const GoToken& token) const {
+    return std::string(_text.substr(size_t(token.begin), size_t(token.length)));
+}
+
+/********************************************************************
+*                                add                        private *
+*-------------------------------------------------------------------*
+* The blank identifier declares nothing.                            *
+********************************************************************/
+void GoParser::add(const GoSymbol::Kind kind, const GoToken& token, const std::string& container) {
+    if (token.length == 1 && _text[size_t(token.begin)] == '_') {
+        return;
+    }
+    _symbols.push_back({kind, text(token), container, token.line, token.column});
+}
@@ -0,0 +1,101 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoParser.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_GO_PARSER_H
+#define GOEDIT_GO_PARSER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "GoLexer.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/********************************************************************
+*                              GoSymbol                             *
+********************************************************************/
+struct GoSymbol {
+    enum Kind : int {
+        Function = 1,
+        Method,
+        Type,
+        Field,
+        Constant,
+        Variable
+    };
+
+    Kind kind;
+    std::string name;
+    std::string container;  // receiver of a method, owner of a field
+    int line;               // 0-based
+    int column;             // 0-based, in bytes
+};
+
+/********************************************************************
+*                              GoParser                             *
+*-------------------------------------------------------------------*
+* Extracts package level declarations from a Go file: functions,    *
+* methods, types with their fields (and interface methods),         *
+* constants and variables, and the imported packages. Bodies of     *
+* functions are skipped, the parser does not need the file to be    *
+* correct.                                                          *
+********************************************************************/
+class GoParser {
+    const std::string_view _text;
+    GoLexer<char> _lexer;
+    GoToken _token;
+    std::string _package;
+    std::vector<GoSymbol> _symbols;
+    std::vector<std::string> _imports;
+public:
+    explicit GoParser(std::string_view);
+    GoParser(const GoParser&) = delete;
+    GoParser& operator=(const GoParser&) = delete;
+
+    std::vector<GoSymbol> parse();
+    const std::string& package() const {
+        return _package;
+    }
+    const std::vector<std::string>& imports() const {
+        return _imports;
+    }
+private:
+    void advance();
+    bool is(const char*) const;
+    std::string text(const GoToken&) const;
+    void add(GoSymbol::Kind, const GoToken&, const std::string& = std::string());
+
+    void importSpec();
+    void function();
+    void typeSpec();
+    void valueSpec(GoSymbol::Kind);
+    void structFields(const std::string&);
+    void interfaceMethods(const std::string&);
+    template<typename Spec> void group(Spec);
+    void skipStatement();
+    void skipSpec();
+    void skipBalanced();
+};
+
+#endif // GOEDIT_GO_PARSER_H
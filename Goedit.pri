@@ -0,0 +1,158 @@
+# Sources of Goedit without main.cpp, shared by the application
+# (Goedit.pro) and the benchmark (Benchmark/Benchmark.pro).
+
+QT       += core gui concurrent network printsupport
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17
+INCLUDEPATH += $$PWD
+LIBS += -lsqlite3
+
+# The following define makes your compiler emit warnings if you use
+# any Qt feature that has been marked deprecated (the exact warnings
+# depend on your compiler). Please consult the documentation of the
+# deprecated API in order to know how to port your code away from it.
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# You can also make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+# You can also select to disable deprecated APIs only up to a certain version of Qt.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+SOURCES += \
+    $$PWD/Bottomkick/Bottomkick.cpp \
+    $$PWD/Bottomkick/DebugTab.cpp \
+    $$PWD/Bottomkick/SearchTab.cpp \
+    $$PWD/Debugger/DlvClient.cpp \
+    $$PWD/Debugger/DlvConnection.cpp \
+    $$PWD/Dialogs/DocsDialog.cpp \
+    $$PWD/Dialogs/FilterDialog.cpp \
+    $$PWD/Dialogs/FindDialog.cpp \
+    $$PWD/Dialogs/SettingsDialog.cpp \
+    $$PWD/Docs/DocDatabase.cpp \
+    $$PWD/Docs/DocIndex.cpp \
+    $$PWD/Go/GoDoc.cpp \
+    $$PWD/Go/GoParser.cpp \
+    $$PWD/Lsp/LspClient.cpp \
+    $$PWD/Lsp/LspConnection.cpp \
+    $$PWD/Lsp/LspDocument.cpp \
+    $$PWD/Lsp/LspFramer.cpp \
+    $$PWD/Project/FileIndex.cpp \
+    $$PWD/Project/FileSystem.cpp \
+    $$PWD/Project/FileWatcher.cpp \
+    $$PWD/Project/IgnoreRules.cpp \
+    $$PWD/Project/ImportGraph.cpp \
+    $$PWD/Project/Project.cpp \
+    $$PWD/Project/ProjectDatabase.cpp \
+    $$PWD/Project/ProjectModel.cpp \
+    $$PWD/Project/ProjectWalker.cpp \
+    $$PWD/Project/Session.cpp \
+    $$PWD/Project/SymbolIndex.cpp \
+    $$PWD/Project/TrigramIndex.cpp \
+    $$PWD/Project/TrigramSegment.cpp \
+    $$PWD/Shared/Diff.cpp \
+    $$PWD/Shared/Fuzzy.cpp \
+    $$PWD/Shared/GlobalDatabase.cpp \
+    $$PWD/Shared/RecentStore.cpp \
+    $$PWD/Shared/SQLite/Field.cpp \
+    $$PWD/Shared/SQLite/SQLite.cpp \
+    $$PWD/Shared/SQLite/Statement.cpp \
+    $$PWD/Shared/Settings.cpp \
+    $$PWD/Shared/Shared.cpp \
+    $$PWD/Shared/StartupTimer.cpp \
+    $$PWD/Shared/StringPool.cpp \
+    $$PWD/Shared/TextScan.cpp \
+    $$PWD/Shared/Trace.cpp \
+    $$PWD/Shared/Trigram.cpp \
+    $$PWD/Sidekick/GraphTab.cpp \
+    $$PWD/Sidekick/ProjectTab.cpp \
+    $$PWD/Sidekick/Sidekick.cpp \
+    $$PWD/Vcs/Blame.cpp \
+    $$PWD/Vcs/GitClient.cpp \
+    $$PWD/Workspace/BracketTree.cpp \
+    $$PWD/Workspace/ChangeBar.cpp \
+    $$PWD/Workspace/Completer.cpp \
+    $$PWD/Workspace/CompletionIndex.cpp \
+    $$PWD/Workspace/DiffView.cpp \
+    $$PWD/Workspace/Editor.cpp \
+    $$PWD/Workspace/Formatter.cpp \
+    $$PWD/Workspace/LongLineEditor.cpp \
+    $$PWD/Workspace/Minimap.cpp \
+    $$PWD/Workspace/MinimapSummary.cpp \
+    $$PWD/Workspace/MultiCursor.cpp \
+    $$PWD/Workspace/PrintJob.cpp \
+    $$PWD/Workspace/TextFile.cpp \
+    $$PWD/Workspace/Workspace.cpp \
+    $$PWD/MainWindow.cpp
+
+HEADERS += \
+    $$PWD/Bottomkick/Bottomkick.h \
+    $$PWD/Bottomkick/DebugTab.h \
+    $$PWD/Bottomkick/SearchTab.h \
+    $$PWD/Debugger/DlvClient.h \
+    $$PWD/Debugger/DlvConnection.h \
+    $$PWD/Dialogs/DocsDialog.h \
+    $$PWD/Dialogs/FilterDialog.h \
+    $$PWD/Dialogs/FindDialog.h \
+    $$PWD/Dialogs/SettingsDialog.h \
+    $$PWD/Docs/DocDatabase.h \
+    $$PWD/Docs/DocIndex.h \
+    $$PWD/Go/GoDoc.h \
+    $$PWD/Go/GoLexer.h \
+    $$PWD/Go/GoParser.h \
+    $$PWD/Lsp/LspClient.h \
+    $$PWD/Lsp/LspConnection.h \
+    $$PWD/Lsp/LspDocument.h \
+    $$PWD/Lsp/LspFramer.h \
+    $$PWD/MainWindow.h \
+    $$PWD/Project/FileIndex.h \
+    $$PWD/Project/FileSystem.h \
+    $$PWD/Project/FileWatcher.h \
+    $$PWD/Project/IgnoreRules.h \
+    $$PWD/Project/ImportGraph.h \
+    $$PWD/Project/Project.h \
+    $$PWD/Project/ProjectDatabase.h \
+    $$PWD/Project/ProjectModel.h \
+    $$PWD/Project/ProjectWalker.h \
+    $$PWD/Project/Session.h \
+    $$PWD/Project/SymbolIndex.h \
+    $$PWD/Project/TrigramIndex.h \
+    $$PWD/Project/TrigramSegment.h \
+    $$PWD/Shared/Diff.h \
+    $$PWD/Shared/Fuzzy.h \
+    $$PWD/Shared/GlobalDatabase.h \
+    $$PWD/Shared/RecentStore.h \
+    $$PWD/Shared/SQLite/Field.h \
+    $$PWD/Shared/SQLite/SQLite.h \
+    $$PWD/Shared/SQLite/Statement.h \
+    $$PWD/Shared/Settings.h \
+    $$PWD/Shared/Shared.h \
+    $$PWD/Shared/StartupTimer.h \
+    $$PWD/Shared/StringPool.h \
+    $$PWD/Shared/TextScan.h \
+    $$PWD/Shared/Trace.h \
+    $$PWD/Shared/Trigram.h \
+    $$PWD/Sidekick/GraphTab.h \
+    $$PWD/Sidekick/ProjectTab.h \
+    $$PWD/Sidekick/Sidekick.h \
+    $$PWD/Vcs/Blame.h \
+    $$PWD/Vcs/GitClient.h \
+    $$PWD/Workspace/BracketTree.h \
+    $$PWD/Workspace/Buffer.h \
+    $$PWD/Workspace/ChangeBar.h \
+    $$PWD/Workspace/Completer.h \
+    $$PWD/Workspace/CompletionIndex.h \
+    $$PWD/Workspace/DiffView.h \
+    $$PWD/Workspace/Editor.h \
+    $$PWD/Workspace/Formatter.h \
+    $$PWD/Workspace/LongLineEditor.h \
+    $$PWD/Workspace/Minimap.h \
+    $$PWD/Workspace/MinimapSummary.h \
+    $$PWD/Workspace/MultiCursor.h \
+    $$PWD/Workspace/PrintJob.h \
+    $$PWD/Workspace/TextFile.h \
+    $$PWD/Workspace/Workspace.h
+
+RESOURCES += \
+    $$PWD/resources.qrc
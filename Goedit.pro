@@ -1,48 +1,9 @@
-QT       += core gui
-
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
-
-CONFIG += c++17
-LIBS += -lsqlite3
-
-# The following define makes your compiler emit warnings if you use
-# any Qt feature that has been marked deprecated (the exact warnings
-# depend on your compiler). Please consult the documentation of the
-# deprecated API in order to know how to port your code away from it.
-DEFINES += QT_DEPRECATED_WARNINGS
-
-# You can also make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-# You can also select to disable deprecated APIs only up to a certain version of Qt.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+include(Goedit.pri)
 
 SOURCES += \
-    Bottomkick/Bottomkick.cpp \
-    Shared/SQLite/Field.cpp \
-    Shared/SQLite/SQLite.cpp \
-    Shared/SQLite/Statement.cpp \
-    Shared/Shared.cpp \
-    Sidekick/ProjectTab.cpp \
-    Sidekick/Sidekick.cpp \
-    Workspace/Workspace.cpp \
-    main.cpp \
-    MainWindow.cpp
-
-HEADERS += \
-    Bottomkick/Bottomkick.h \
-    MainWindow.h \
-    Shared/SQLite/Field.h \
-    Shared/SQLite/SQLite.h \
-    Shared/SQLite/Statement.h \
-    Shared/Shared.h \
-    Sidekick/ProjectTab.h \
-    Sidekick/Sidekick.h \
-    Workspace/Workspace.h
+    main.cpp
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
 else: unix:!android: target.path = /opt/$${TARGET}/bin
 !isEmpty(target.path): INSTALLS += target
-
-RESOURCES += \
-    resources.qrc
@@ -0,0 +1,428 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspClient.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QTimer>
+#include <QTextDocument>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QCoreApplication>
+#include <QUrl>
+#include <QDebug>
+#include "LspClient.h"
+#include "LspConnection.h"
+#include "LspDocument.h"
+
+//*******************************************************************
+//                             LspClient                        CTOR
+//*******************************************************************
+LspClient::LspClient(QObject* parent)
+    : QObject(parent)
+    , _connection(new LspConnection)
+    , _changeTimer(new QTimer(this))
+    , _deferredTimer(new QTimer(this))
+    , _running(false)
+    , _ready(false)
+    , _lastId(0)
+{
+    _changeTimer->setSingleShot(true);
+    _changeTimer->setInterval(ChangeDelayMs);
+    _deferredTimer->setSingleShot(true);
+    _deferredTimer->setInterval(DeferredDelayMs);
+    connect(_changeTimer, &QTimer::timeout, this, &LspClient::flushChanges);
+    connect(_deferredTimer, &QTimer::timeout, this, &LspClient::flushDeferred);
+
+    _connection->moveToThread(&_thread);
+    connect(&_thread, &QThread::finished, _connection, &QObject::deleteLater);
+    connect(_connection, &LspConnection::started, this, &LspClient::started);
+    connect(_connection, &LspConnection::received, this, &LspClient::received);
+    connect(_connection, &LspConnection::finished, this, &LspClient::finished);
+    _thread.setObjectName("LspConnection");
+    _thread.start();
+}
+
+/********************************************************************
+*                            ~LspClient                        dtor *
+*-------------------------------------------------------------------*
+* Waits until the server got shutdown/exit and the process ended.   *
+********************************************************************/
+LspClient::~LspClient() {
+    stop();
+    QMetaObject::invokeMethod(_connection, &LspConnection::stop, Qt::BlockingQueuedConnection);
+    _thread.quit();
+    _thread.wait();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Starts the server for the project 'root'. The server is optional: *
+* when it can't be found, the editor works without it.              *
+********************************************************************/
+void LspClient::start(const QString& root) {
+    stop();
+
+    QStringList args = qEnvironmentVariable("GOEDIT_LSP_SERVER").split(' ', Qt::SkipEmptyParts);
+    QString program = args.isEmpty() ? QStandardPaths::findExecutable("gopls") : args.takeFirst();
+    if (program.isEmpty()) {
+        qInfo() << "LspClient: gopls not found, code intelligence is disabled";
+        return;
+    }
+
+    _root = root;
+    _running = true;
+    QMetaObject::invokeMethod(_connection, [connection = _connection, program, args, root] {
+        connection->start(program, args, root);
+    });
+}
+
+/********************************************************************
+*                               stop                         public *
+*-------------------------------------------------------------------*
+* Documents stay registered, they are opened again in the next      *
+* server.                                                           *
+********************************************************************/
+void LspClient::stop() {
+    if (!_running) {
+        return;
+    }
+    if (_ready) {
+        send({"shutdown", {}, nullptr, Immediate});
+        notify("exit", {});
+    }
+    _running = false;
+    _ready = false;
+    for (auto const doc : qAsConst(_documents)) {
+        doc->detach();
+    }
+    _root.clear();
+    _sent.clear();
+    _deferred.clear();
+    _changeTimer->stop();
+    _deferredTimer->stop();
+    QMetaObject::invokeMethod(_connection, &LspConnection::stop);
+}
+
+/********************************************************************
+*                           openDocument                     public *
+********************************************************************/
+void LspClient::openDocument(const QString& path, QTextDocument* document) {
+    const QString language = languageId(path);
+    if (language.isEmpty()) {
+        return;
+    }
+    closeDocument(path);
+
+    auto const doc = new LspDocument(path, language, document, this);
+    _documents.insert(path, doc);
+    connect(doc, &LspDocument::changed, this, [this] {
+        // Batch is sent not later than ChangeDelayMs after the first change.
+        if (!_changeTimer->isActive()) {
+            _changeTimer->start();
+        }
+    });
+    connect(document, &QObject::destroyed, this, [this, path, document] {
+        if (auto const doc = _documents.value(path); doc && doc->document() == document) {
+            closeDocument(path);
+        }
+    });
+    if (_ready) {
+        notify("textDocument/didOpen", doc->openParams());
+    }
+}
+
+/********************************************************************
+*                           closeDocument                    public *
+********************************************************************/
+void LspClient::closeDocument(const QString& path) {
+    LspDocument* const doc = _documents.take(path);
+    if (!doc) {
+        return;
+    }
+    if (_ready) {
+        notify("textDocument/didClose", {{"textDocument", doc->identifier()}});
+    }
+    delete doc;
+}
+
+/********************************************************************
+*                           saveDocument                     public *
+********************************************************************/
+void LspClient::saveDocument(const QString& path) {
+    if (auto const doc = _documents.value(path); doc && _ready) {
+        flushChanges();
+        notify("textDocument/didSave", {{"textDocument", doc->identifier()}});
+    }
+}
+
+/********************************************************************
+*                              request                       public *
+*-------------------------------------------------------------------*
+* Returns id of the request sent, 0 when it was queued (Deferred)   *
+* or the server is not ready. Handler gets the result, it's not     *
+* called for cancelled and failed requests.                         *
+********************************************************************/
+int LspClient::request(const QString& method, const QJsonObject& params, const Handler& handler, const Priority priority) {
+    if (!_ready) {
+        return 0;
+    }
+    if (priority == Deferred) {
+        _deferred.insert(method, {method, params, handler, priority});
+        _deferredTimer->start();
+        return 0;
+    }
+    flushChanges();
+    cancel(method);
+    return send({method, params, handler, priority});
+}
+
+/********************************************************************
+*                          positionParams                    public *
+*-------------------------------------------------------------------*
+* TextDocumentPositionParams, 'line' and 'column' are 0-based.      *
+********************************************************************/
+QJsonObject LspClient::positionParams(const QString& path, const int line, const int column) const {
+    return {
+        {"textDocument", QJsonObject{{"uri", QUrl::fromLocalFile(path).toString()}}},
+        {"position", QJsonObject{{"line", line}, {"character", column}}}
+    };
+}
+
+/********************************************************************
+*                              started                      private *
+*-------------------------------------------------------------------*
+* Process is running, the handshake follows. Documents are opened   *
+* when the server is initialized.                                   *
+********************************************************************/
+void LspClient::started() {
+    if (!_running) {
+        return;
+    }
+    const QString rootUri = QUrl::fromLocalFile(_root).toString();
+    const QJsonObject capabilities{
+        {"textDocument", QJsonObject{
+            {"synchronization", QJsonObject{{"didSave", true}}},
+            {"completion", QJsonObject{{"completionItem", QJsonObject{{"snippetSupport", false}}}}},
+            {"hover", QJsonObject{{"contentFormat", QJsonArray{"plaintext"}}}},
+            {"publishDiagnostics", QJsonObject{}}
+        }},
+        {"workspace", QJsonObject{{"configuration", true}, {"workspaceFolders", true}}}
+    };
+    const QJsonObject params{
+        {"processId", QCoreApplication::applicationPid()},
+        {"rootUri", rootUri},
+        {"capabilities", capabilities},
+        {"workspaceFolders", QJsonArray{QJsonObject{{"uri", rootUri}, {"name", QFileInfo(_root).fileName()}}}}
+    };
+
+    send({"initialize", params, [this](const QJsonValue&) {
+        _ready = true;
+        notify("initialized", {});
+        for (auto const doc : qAsConst(_documents)) {
+            notify("textDocument/didOpen", doc->openParams());
+        }
+        emit ready();
+    }, Immediate});
+}
+
+/********************************************************************
+*                             finished                      private *
+********************************************************************/
+void LspClient::finished() {
+    if (_running) {
+        qWarning() << "LspClient: language server has stopped";
+    }
+    _running = false;
+    _ready = false;
+    for (auto const doc : qAsConst(_documents)) {
+        doc->detach();
+    }
+    _sent.clear();
+    _deferred.clear();
+    _changeTimer->stop();
+    _deferredTimer->stop();
+}
+
+/********************************************************************
+*                             received                      private *
+*-------------------------------------------------------------------*
+* Response, request or notification from the server. Responses to   *
+* requests cancelled meanwhile are dropped.                         *
+********************************************************************/
+void LspClient::received(const QJsonObject& message) {
+    if (!_running) {
+        return;
+    }
+    const bool hasId = message.contains("id");
+    const QString method = message.value("method").toString();
+
+    if (hasId && !method.isEmpty()) {
+        reply(message);
+        return;
+    }
+    if (hasId) {
+        const auto it = _sent.find(message.value("id").toInt());
+        if (it == _sent.end()) {
+            return;
+        }
+        const Request request = it.value();
+        _sent.erase(it);
+
+        if (message.contains("error")) {
+            const QJsonObject error = message.value("error").toObject();
+            if (error.value("code").toInt() != RequestCancelled) {
+                qWarning() << "LspClient:" << request.method << error.value("message").toString();
+            }
+        } else if (request.handler) {
+            request.handler(message.value("result"));
+        }
+        if (!_deferred.isEmpty() && !_deferredTimer->isActive()) {
+            _deferredTimer->start();
+        }
+        return;
+    }
+    if (method == "textDocument/publishDiagnostics") {
+        const QJsonObject params = message.value("params").toObject();
+        emit diagnostics(QUrl(params.value("uri").toString()).toLocalFile(), params.value("diagnostics").toArray());
+    }
+}
+
+/********************************************************************
+*                               reply                       private *
+*-------------------------------------------------------------------*
+* Requests of the server. Nothing is configured, so the defaults of *
+* the server are used, and every other request simply succeeds.     *
+********************************************************************/
+void LspClient::reply(const QJsonObject& message) {
+    QJsonValue result;
+    if (message.value("method").toString() == "workspace/configuration") {
+        QJsonArray items;
+        const int n = message.value("params").toObject().value("items").toArray().size();
+        for (int i = 0; i < n; i++) {
+            items.append(QJsonObject());
+        }
+        result = items;
+    }
+    QJsonObject response{{"id", message.value("id")}, {"result", result}};
+    QMetaObject::invokeMethod(_connection, [connection = _connection, response] {
+        connection->send(response);
+    });
+}
+
+/********************************************************************
+*                               send                        private *
+********************************************************************/
+int LspClient::send(const Request& request) {
+    const int id = ++_lastId;
+    _sent.insert(id, request);
+    const QJsonObject message{{"id", id}, {"method", request.method}, {"params", request.params}};
+    QMetaObject::invokeMethod(_connection, [connection = _connection, message] {
+        connection->send(message);
+    });
+    return id;
+}
+
+/********************************************************************
+*                              notify                       private *
+********************************************************************/
+void LspClient::notify(const QString& method, const QJsonObject& params) {
+    const QJsonObject message{{"method", method}, {"params", params}};
+    QMetaObject::invokeMethod(_connection, [connection = _connection, message] {
+        connection->send(message);
+    });
+}
+
+/********************************************************************
+*                               cancel                      private *
+*-------------------------------------------------------------------*
+* Cancels requests of the method waiting for the result. The server *
+* may still answer them, the answers are dropped.                   *
+********************************************************************/
+void LspClient::cancel(const QString& method) {
+    for (auto it = _sent.begin(); it != _sent.end();) {
+        if (it.value().method == method) {
+            notify("$/cancelRequest", {{"id", it.key()}});
+            it = _sent.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/********************************************************************
+*                           flushChanges                    private *
+********************************************************************/
+void LspClient::flushChanges() {
+    _changeTimer->stop();
+    if (!_ready) {
+        return;
+    }
+    for (auto const doc : qAsConst(_documents)) {
+        if (doc->hasChanges()) {
+            notify("textDocument/didChange", doc->changeParams());
+        }
+    }
+}
+
+/********************************************************************
+*                           flushDeferred                   private *
+*-------------------------------------------------------------------*
+* Deferred requests wait while an Immediate one is being answered.  *
+* They are sent again when its result comes (see received).         *
+********************************************************************/
+void LspClient::flushDeferred() {
+    if (!_ready) {
+        return;
+    }
+    for (const auto& request : qAsConst(_sent)) {
+        if (request.priority == Immediate) {
+            return;
+        }
+    }
+    flushChanges();
+    const auto deferred = _deferred;
+    _deferred.clear();
+    for (const auto& request : deferred) {
+        cancel(request.method);
+        send(request);
+    }
+}
+
+/********************************************************************
+*                            languageId              private static *
+*-------------------------------------------------------------------*
+* Language of the file for the server, empty when it's not for it.  *
+********************************************************************/
+QString LspClient::languageId(const QString& path) {
+    const QFileInfo info(path);
+    if (info.suffix() == "go") {
+        return "go";
+    }
+    if (info.fileName() == "go.mod") {
+        return "go.mod";
+    }
+    return QString();
+}
@@ -0,0 +1,121 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspClient.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_LSP_CLIENT_H
+#define GOEDIT_LSP_CLIENT_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QThread>
+#include <QHash>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <functional>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QTimer;
+class QTextDocument;
+class LspConnection;
+class LspDocument;
+
+/********************************************************************
+*                             LspClient                             *
+*-------------------------------------------------------------------*
+* Client of the language server (gopls, or the program given in     *
+* GOEDIT_LSP_SERVER). The connection runs in its own thread, here   *
+* only requests are queued:                                         *
+*  - changes of documents are collected and sent as one didChange   *
+*    after ChangeDelayMs, or at once before a request,              *
+*  - Immediate requests (completion) are sent at once and cancel    *
+*    the older request of the same method still waiting for result, *
+*  - Deferred requests (hover) wait DeferredDelayMs, a newer one    *
+*    replaces the older one, and they are postponed while any       *
+*    Immediate request waits for its result.                        *
+********************************************************************/
+class LspClient : public QObject {
+    Q_OBJECT
+public:
+    enum Priority {
+        Immediate,
+        Deferred
+    };
+    using Handler = std::function<void(const QJsonValue&)>;
+private:
+    static constexpr int ChangeDelayMs = 50;
+    static constexpr int DeferredDelayMs = 250;
+    static constexpr int RequestCancelled = -32800;
+
+    struct Request {
+        QString method;
+        QJsonObject params;
+        Handler handler;
+        Priority priority;
+    };
+
+    LspConnection* const _connection;
+    QThread _thread;
+    QTimer* const _changeTimer;
+    QTimer* const _deferredTimer;
+    QString _root;
+    bool _running;
+    bool _ready;
+    int _lastId;
+    QHash<QString, LspDocument*> _documents;
+    QHash<int, Request> _sent;
+    QHash<QString, Request> _deferred;
+public:
+    explicit LspClient(QObject* = nullptr);
+    ~LspClient() override;
+
+    void start(const QString&);
+    void stop();
+    bool isReady() const {
+        return _ready;
+    }
+    void openDocument(const QString&, QTextDocument*);
+    void closeDocument(const QString&);
+    void saveDocument(const QString&);
+    int request(const QString&, const QJsonObject&, const Handler&, const Priority = Immediate);
+    QJsonObject positionParams(const QString&, const int, const int) const;
+
+signals:
+    void ready();
+    void diagnostics(const QString&, const QJsonArray&);
+
+private:
+    void started();
+    void finished();
+    void received(const QJsonObject&);
+    void reply(const QJsonObject&);
+    int send(const Request&);
+    void notify(const QString&, const QJsonObject&);
+    void cancel(const QString&);
+    void flushChanges();
+    void flushDeferred();
+    static QString languageId(const QString&);
+};
+
+#endif // GOEDIT_LSP_CLIENT_H
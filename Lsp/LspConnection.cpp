@@ -0,0 +1,143 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspConnection.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QProcess>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QDebug>
+#include "LspConnection.h"
+#include "Shared/Trace.h"
+
+//*******************************************************************
+//                           LspConnection                      CTOR
+//*******************************************************************
+LspConnection::LspConnection(QObject* parent)
+    : QObject(parent)
+    , _process(nullptr)
+{}
+
+/********************************************************************
+*                          ~LspConnection                      dtor *
+********************************************************************/
+LspConnection::~LspConnection() {
+    stop();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Must be called in the thread of the connection.                   *
+********************************************************************/
+void LspConnection::start(const QString& program, const QStringList& args, const QString& dir) {
+    Trace::setThreadName("lsp");
+    stop();
+
+    _process = new QProcess(this);
+    _process->setWorkingDirectory(dir);
+    // gopls logs to stderr; nobody reads it, so it doesn't go to a pipe.
+    _process->setStandardErrorFile(QProcess::nullDevice());
+    connect(_process, &QProcess::readyReadStandardOutput, this, &LspConnection::readOutput);
+    connect(_process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this, [this] {
+        emit finished();
+    });
+    connect(_process, &QProcess::errorOccurred, this, [this](const QProcess::ProcessError error) {
+        if (error == QProcess::FailedToStart) {
+            qWarning() << "LspConnection: can't start" << _process->program() << _process->errorString();
+            emit finished();
+        }
+    });
+
+    _process->start(program, args);
+    if (_process->waitForStarted()) {
+        emit started();
+    }
+}
+
+/********************************************************************
+*                               stop                         public *
+*-------------------------------------------------------------------*
+* Server asked to exit has a moment to do it, then it's killed.     *
+********************************************************************/
+void LspConnection::stop() {
+    if (!_process) {
+        return;
+    }
+    _process->disconnect(this);
+    if (_process->state() != QProcess::NotRunning) {
+        _process->closeWriteChannel();
+        if (!_process->waitForFinished(StopTimeoutMs)) {
+            _process->kill();
+            _process->waitForFinished(StopTimeoutMs);
+        }
+    }
+    delete _process;
+    _process = nullptr;
+    _framer.clear();
+}
+
+/********************************************************************
+*                               send                         public *
+********************************************************************/
+void LspConnection::send(const QJsonObject& message) {
+    if (!_process || _process->state() != QProcess::Running) {
+        return;
+    }
+    QJsonObject full(message);
+    full["jsonrpc"] = "2.0";
+    const QByteArray body = QJsonDocument(full).toJson(QJsonDocument::Compact);
+    const std::string frame = LspFramer::frame(std::string_view(body.constData(), size_t(body.size())));
+    _process->write(frame.data(), qint64(frame.size()));
+}
+
+/********************************************************************
+*                            readOutput                     private *
+*-------------------------------------------------------------------*
+* Data goes from the pipe straight to the framer's buffer, bodies   *
+* are parsed in place.                                              *
+********************************************************************/
+void LspConnection::readOutput() {
+    TraceScope trace("read", "lsp");
+    for (qint64 available = _process->bytesAvailable(); available > 0; available = _process->bytesAvailable()) {
+        char* const ptr = _framer.reserve(size_t(available));
+        const qint64 n = _process->read(ptr, available);
+        if (n <= 0) {
+            break;
+        }
+        _framer.commit(size_t(n));
+    }
+
+    std::string_view body;
+    while (_framer.next(body)) {
+        QJsonParseError error;
+        const auto doc = QJsonDocument::fromJson(QByteArray::fromRawData(body.data(), int(body.size())), &error);
+        if (doc.isObject()) {
+            emit received(doc.object());
+        } else {
+            qWarning() << "LspConnection: invalid message:" << error.errorString();
+        }
+    }
+}
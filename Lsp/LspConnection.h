@@ -0,0 +1,70 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspConnection.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_LSP_CONNECTION_H
+#define GOEDIT_LSP_CONNECTION_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QStringList>
+#include <QJsonObject>
+#include "Lsp/LspFramer.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QProcess;
+
+/********************************************************************
+*                           LspConnection                           *
+*-------------------------------------------------------------------*
+* Process of the language server and its pipes. Lives in its own    *
+* thread: messages are framed, serialized and parsed there, so      *
+* the user interface never waits for the server.                    *
+********************************************************************/
+class LspConnection : public QObject {
+    Q_OBJECT
+
+    static constexpr int StopTimeoutMs = 1000;
+
+    QProcess* _process;
+    LspFramer _framer;
+public:
+    explicit LspConnection(QObject* = nullptr);
+    ~LspConnection() override;
+
+    void start(const QString&, const QStringList&, const QString&);
+    void stop();
+    void send(const QJsonObject&);
+
+signals:
+    void started();
+    void received(const QJsonObject&);
+    void finished();
+
+private:
+    void readOutput();
+};
+
+#endif // GOEDIT_LSP_CONNECTION_H
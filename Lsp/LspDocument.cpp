@@ -0,0 +1,180 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspDocument.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QTextDocument>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QUrl>
+#include "LspDocument.h"
+
+//*******************************************************************
+//                            LspDocument                       CTOR
+//*******************************************************************
+LspDocument::LspDocument(const QString& path, const QString& languageId, QTextDocument* document, QObject* parent)
+    : QObject(parent)
+    , _document(document)
+    , _uri(QUrl::fromLocalFile(path).toString())
+    , _languageId(languageId)
+    , _characters(0)
+    , _version(0)
+    , _open(false)
+{
+    reset();
+    connect(_document, &QTextDocument::contentsChange, this, &LspDocument::contentsChange);
+}
+
+/********************************************************************
+*                            openParams                      public *
+*-------------------------------------------------------------------*
+* Parameters of didOpen: the whole current text. Changes waiting    *
+* are included in it.                                               *
+********************************************************************/
+QJsonObject LspDocument::openParams() {
+    reset();
+    _open = true;
+    return {{"textDocument", QJsonObject{
+        {"uri", _uri},
+        {"languageId", _languageId},
+        {"version", ++_version},
+        {"text", text(0, _characters - 1)}
+    }}};
+}
+
+/********************************************************************
+*                               detach                       public *
+*-------------------------------------------------------------------*
+* The server is gone (or not ready yet). Edits are not recorded     *
+* until the document is opened again with its full text.            *
+********************************************************************/
+void LspDocument::detach() {
+    _open = false;
+    _changes = QJsonArray();
+}
+
+/********************************************************************
+*                           changeParams                     public *
+*-------------------------------------------------------------------*
+* Parameters of didChange with all changes since the last call.     *
+********************************************************************/
+QJsonObject LspDocument::changeParams() {
+    QJsonObject params{
+        {"textDocument", QJsonObject{{"uri", _uri}, {"version", ++_version}}},
+        {"contentChanges", _changes}
+    };
+    _changes = QJsonArray();
+    return params;
+}
+
+/********************************************************************
+*                            identifier                      public *
+********************************************************************/
+QJsonObject LspDocument::identifier() const {
+    return {{"uri", _uri}};
+}
+
+/********************************************************************
+*                          contentsChange                   private *
+*-------------------------------------------------------------------*
+* Text before 'position' is unchanged, so the start of the range is *
+* found in the current document. The end is found by walking the    *
+* lengths of the old lines. When the whole text was replaced (load, *
+* reload) the change is the full text.                              *
+********************************************************************/
+void LspDocument::contentsChange(const int position, const int removed, const int added) {
+    if (!_open) {
+        return;
+    }
+    // Range out of the old text should not happen, but a wrong range
+    // would corrupt the copy of the server, full text is safe.
+    if ((position == 0 && removed >= _characters - 1) || position + removed > _characters) {
+        reset();
+        _changes = QJsonArray{QJsonObject{{"text", text(0, _characters - 1)}}};
+        emit changed();
+        return;
+    }
+
+    const QTextBlock first = _document->findBlock(position);
+    const int line = first.blockNumber();
+    const int column = position - first.position();
+
+    int endLine = line;
+    int endColumn = column + removed;
+    while (endLine + 1 < int(_lines.size()) && endColumn >= _lines[size_t(endLine)]) {
+        endColumn -= _lines[size_t(endLine)];
+        endLine++;
+    }
+
+    _changes.append(QJsonObject{
+        {"range", QJsonObject{{"start", location(line, column)}, {"end", location(endLine, endColumn)}}},
+        {"text", text(position, position + added)}
+    });
+
+    // Lines of the range are replaced by the lines of the new text.
+    const int last = _document->findBlock(position + added).blockNumber();
+    std::vector<int> lengths;
+    lengths.reserve(size_t(last - line + 1));
+    for (QTextBlock block = first; block.isValid() && block.blockNumber() <= last; block = block.next()) {
+        lengths.push_back(block.length());
+    }
+    _lines.erase(_lines.begin() + line, _lines.begin() + endLine + 1);
+    _lines.insert(_lines.begin() + line, lengths.cbegin(), lengths.cend());
+    _characters = _document->characterCount();
+    emit changed();
+}
+
+/********************************************************************
+*                               reset                       private *
+********************************************************************/
+void LspDocument::reset() {
+    _lines.clear();
+    _lines.reserve(size_t(_document->blockCount()));
+    for (QTextBlock block = _document->begin(); block.isValid(); block = block.next()) {
+        _lines.push_back(block.length());
+    }
+    _characters = _document->characterCount();
+    _changes = QJsonArray();
+}
+
+/********************************************************************
+*                               text                        private *
+*-------------------------------------------------------------------*
+* Text between positions, with normal line separators.              *
+********************************************************************/
+QString LspDocument::text(const int begin, const int end) const {
+    const int max = _document->characterCount() - 1;
+    QTextCursor cursor(_document);
+    cursor.setPosition(qBound(0, begin, max));
+    cursor.setPosition(qBound(0, end, max), QTextCursor::KeepAnchor);
+    return cursor.selectedText().replace(QChar::ParagraphSeparator, '\n');
+}
+
+/********************************************************************
+*                             location               private static *
+********************************************************************/
+QJsonObject LspDocument::location(const int line, const int column) {
+    return {{"line", line}, {"character", column}};
+}
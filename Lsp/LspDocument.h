@@ -0,0 +1,86 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspDocument.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_LSP_DOCUMENT_H
+#define GOEDIT_LSP_DOCUMENT_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <vector>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QTextDocument;
+
+/********************************************************************
+*                            LspDocument                            *
+*-------------------------------------------------------------------*
+* Document opened in the language server. Edits are turned into     *
+* incremental changes (range + new text) as they happen. The range  *
+* must be given in the document before the edit, so only lengths of *
+* the lines are remembered, never a copy of the text. Edits are     *
+* recorded only while the document is open in a server.             *
+********************************************************************/
+class LspDocument : public QObject {
+    Q_OBJECT
+
+    QTextDocument* const _document;
+    const QString _uri;
+    const QString _languageId;
+    std::vector<int> _lines;    // lengths of blocks, with separators
+    int _characters;
+    int _version;
+    bool _open;
+    QJsonArray _changes;
+public:
+    LspDocument(const QString&, const QString&, QTextDocument*, QObject* = nullptr);
+
+    QString uri() const {
+        return _uri;
+    }
+    QTextDocument* document() const {
+        return _document;
+    }
+    bool hasChanges() const {
+        return !_changes.isEmpty();
+    }
+    QJsonObject openParams();
+    void detach();
+    QJsonObject changeParams();
+    QJsonObject identifier() const;
+
+signals:
+    void changed();
+
+private:
+    void contentsChange(const int, const int, const int);
+    void reset();
+    QString text(const int, const int) const;
+    static QJsonObject location(const int, const int);
+};
+
+#endif // GOEDIT_LSP_DOCUMENT_H
@@ -0,0 +1,158 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspFramer.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+#include "LspFramer.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr std::string_view HeaderEnd = "\r\n\r\n";
+static constexpr std::string_view LengthField = "content-length:";
+
+//*******************************************************************
+//                             LspFramer                        CTOR
+//*******************************************************************
+LspFramer::LspFramer()
+    : _buffer(64 * 1024)
+    , _begin(0)
+    , _end(0)
+{}
+
+/********************************************************************
+*                              reserve                       public *
+*-------------------------------------------------------------------*
+* Returns a place for at least 'n' bytes after the data. Unread     *
+* data is moved to the front of the buffer first, views returned    *
+* by next() are not valid after that.                               *
+********************************************************************/
+char* LspFramer::reserve(const size_t n) {
+    if (_begin > 0) {
+        memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+        _end -= _begin;
+        _begin = 0;
+    }
+    if (_buffer.size() - _end < n) {
+        _buffer.resize(std::max(_buffer.size() * 2, _end + n));
+    }
+    return _buffer.data() + _end;
+}
+
+/********************************************************************
+*                              commit                        public *
+*-------------------------------------------------------------------*
+* 'n' bytes were written to the place returned by reserve.          *
+********************************************************************/
+void LspFramer::commit(const size_t n) {
+    _end += n;
+}
+
+/********************************************************************
+*                               next                         public *
+*-------------------------------------------------------------------*
+* Next complete message. Returns false when more data is needed.    *
+* Header without a valid length can't be recovered from, all data   *
+* up to the end of that header is skipped then.                     *
+********************************************************************/
+bool LspFramer::next(std::string_view& body) {
+    for (;;) {
+        const std::string_view data(_buffer.data() + _begin, _end - _begin);
+        const size_t headerEnd = data.find(HeaderEnd);
+        if (headerEnd == std::string_view::npos) {
+            // Garbage without a header end must not grow forever.
+            if (data.size() > 64 * 1024) {
+                _begin = _end - HeaderEnd.size();
+            }
+            return false;
+        }
+
+        size_t length = 0;
+        const size_t bodyBegin = headerEnd + HeaderEnd.size();
+        if (!contentLength(data.substr(0, headerEnd), length) || length > MaxMessage) {
+            _begin += bodyBegin;
+            continue;
+        }
+        if (data.size() - bodyBegin < length) {
+            return false;
+        }
+        body = data.substr(bodyBegin, length);
+        _begin += bodyBegin + length;
+        return true;
+    }
+}
+
+/********************************************************************
+*                               frame                 public static *
+********************************************************************/
+std::string LspFramer::frame(std::string_view body) {
+    std::string message = "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+    message.append(body);
+    return message;
+}
+
+/********************************************************************
+*                           contentLength            private static *
+*-------------------------------------------------------------------*
+* Value of Content-Length from the header lines (name of the field  *
+* is case insensitive). Other fields are ignored.                   *
+********************************************************************/
+bool LspFramer::contentLength(std::string_view header, size_t& length) {
+    while (!header.empty()) {
+        const size_t eol = header.find("\r\n");
+        const std::string_view line = header.substr(0, eol);
+        header = (eol == std::string_view::npos) ? std::string_view() : header.substr(eol + 2);
+
+        if (line.size() <= LengthField.size()) {
+            continue;
+        }
+        bool match = true;
+        for (size_t i = 0; i < LengthField.size() && match; i++) {
+            match = (tolower(static_cast<unsigned char>(line[i])) == LengthField[i]);
+        }
+        if (!match) {
+            continue;
+        }
+        size_t i = LengthField.size();
+        while (i < line.size() && line[i] == ' ') {
+            i++;
+        }
+        if (i == line.size()) {
+            return false;
+        }
+        size_t value = 0;
+        for (; i < line.size(); i++) {
+            if (!isdigit(static_cast<unsigned char>(line[i])) || value > MaxMessage) {
+                return false;
+            }
+            value = value * 10 + size_t(line[i] - '0');
+        }
+        length = value;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,66 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LspFramer.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_LSP_FRAMER_H
+#define GOEDIT_LSP_FRAMER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <string>
+#include <string_view>
+#include <vector>
+
+/********************************************************************
+*                             LspFramer                             *
+*-------------------------------------------------------------------*
+* Splits the byte stream of a language server into messages         *
+* ("Content-Length: n\r\n\r\n" + body). Data is read directly into  *
+* the buffer of the framer (reserve/commit) and bodies are returned *
+* as views into it, so a message is never copied. A view is valid   *
+* until the next call of reserve.                                   *
+********************************************************************/
+class LspFramer {
+    std::vector<char> _buffer;
+    size_t _begin;      // first unread byte
+    size_t _end;        // end of data
+public:
+    static constexpr size_t MaxMessage = 64 * 1024 * 1024;
+
+    LspFramer();
+
+    char* reserve(const size_t);
+    void commit(const size_t);
+    bool next(std::string_view&);
+    bool isEmpty() const {
+        return _begin == _end;
+    }
+    void clear() {
+        _begin = _end = 0;
+    }
+    static std::string frame(std::string_view);
+private:
+    static bool contentLength(std::string_view, size_t&);
+};
+
+#endif // GOEDIT_LSP_FRAMER_H
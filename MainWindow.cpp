@@ -31,12 +31,49 @@
 #include <QSettings>
 #include <QLabel>
 #include <QIcon>
+#include <QFileDialog>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QPrinter>
+#include <QPrintDialog>
+#include <QPdfWriter>
+#include <QProgressDialog>
 #include <QDebug>
+#include <vector>
 #include "MainWindow.h"
 #include "Shared/Shared.h"
+#include "Shared/StartupTimer.h"
+#include "Shared/Settings.h"
+#include "Shared/Trace.h"
 #include "Workspace/Workspace.h"
+#include "Workspace/Buffer.h"
+#include "Workspace/Editor.h"
+#include "Workspace/Completer.h"
+#include "Workspace/PrintJob.h"
 #include "Sidekick/Sidekick.h"
+#include "Sidekick/ProjectTab.h"
+#include "Sidekick/GraphTab.h"
 #include "Bottomkick/Bottomkick.h"
+#include "Bottomkick/SearchTab.h"
+#include "Bottomkick/DebugTab.h"
+#include "Project/Project.h"
+#include "Project/FileIndex.h"
+#include "Project/SymbolIndex.h"
+#include "Project/TrigramIndex.h"
+#include "Project/Session.h"
+#include "Shared/GlobalDatabase.h"
+#include "Shared/RecentStore.h"
+#include "Lsp/LspClient.h"
+#include "Debugger/DlvClient.h"
+#include "Vcs/GitClient.h"
+#include "Docs/DocIndex.h"
+#include "Dialogs/FilterDialog.h"
+#include "Dialogs/FindDialog.h"
+#include "Dialogs/DocsDialog.h"
+#include "Dialogs/SettingsDialog.h"
 
 /*------- local constants:
 -------------------------------------------------------------------*/
@@ -46,6 +83,7 @@ const char* const MainWindow::MenuTools     = "Tools";
 const char* const MainWindow::MenuProject   = "Project";
 const char* const MainWindow::MenuDebugger  = "Debugger";
 const char* const MainWindow::MenuDocuments = "Documents";
+const char* const MainWindow::MenuDeveloper = "Developer";
 const char* const MainWindow::MenuHelp      = "Help";
 
 //*******************************************************************
@@ -54,60 +92,202 @@ const char* const MainWindow::MenuHelp      = "Help";
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     // File menu subitems
-    , _openFileAction         (new QAction(QIcon(":/img/OpenFileIcon"), "Open File ..."))
-    , _newFileAction          (new QAction(QIcon(":/img/NewFileIcon"), "New File"))
-    , _saveFileAction         (new QAction(QIcon(":/img/SaveFileIcon"), "Save File"))
+    , _openFileAction         (new QAction("Open File ..."))
+    , _quickOpenAction        (new QAction("Quick Open ..."))
+    , _newFileAction          (new QAction("New File"))
+    , _saveFileAction         (new QAction("Save File"))
     , _saveAsAction           (new QAction("Save As ..."))
-    , _saveAllAction          (new QAction(QIcon(":/img/SaveAllIcon"), "Save All..."))
+    , _saveAllAction          (new QAction("Save All..."))
     , _lastOpenedFilesMenu    (new QMenu("Last Opened Files"))
     , _lastOpenedProjectsMenu (new QMenu("Last Opened Projects"))
-    , _propertiesAction       (new QAction(QIcon(":/img/PropertiesIcon"), "Settings"))
-    , _printAction            (new QAction(QIcon(":/img/PrintIcon"), "Print ..."))
-    , _quitAction             (new QAction(QIcon(":/img/ExitIcon"), "Quit"))
+    , _propertiesAction       (new QAction("Settings"))
+    , _printAction            (new QAction("Print ..."))
+    , _exportPdfAction        (new QAction("Export to PDF ..."))
+    , _quitAction             (new QAction("Quit"))
     // Edit menu subitems
-    , _undoAction             (new QAction(QIcon(":/img/UndoIcon"), "Undo"))
-    , _redoAction             (new QAction(QIcon(":/img/RedoIcon"), "Redo"))
-    , _cutAction              (new QAction(QIcon(":/img/CutIcon"), "Cut"))
-    , _copyAction             (new QAction(QIcon(":/img/CopyIcon"), "Copy"))
-    , _pasteAction            (new QAction(QIcon(":/img/PasteIcon"), "Paste"))
+    , _undoAction             (new QAction("Undo"))
+    , _redoAction             (new QAction("Redo"))
+    , _cutAction              (new QAction("Cut"))
+    , _copyAction             (new QAction("Copy"))
+    , _pasteAction            (new QAction("Paste"))
     , _deleteAction           (new QAction("Delete"))
     , _selectAllAction        (new QAction("Select All"))
+    , _cursorAboveAction      (new QAction("Add Cursor Above"))
+    , _cursorBelowAction      (new QAction("Add Cursor Below"))
+    , _nextOccurrenceAction   (new QAction("Add Next Occurrence"))
+    , _allOccurrencesAction   (new QAction("Select All Occurrences"))
+    , _foldAction             (new QAction("Fold"))
+    , _unfoldAction           (new QAction("Unfold"))
+    , _foldAllAction          (new QAction("Fold All"))
+    , _unfoldAllAction        (new QAction("Unfold All"))
+    , _matchingBracketAction  (new QAction("Go to Matching Bracket"))
     // Tools menu subitems
-    , _findAction             (new QAction(QIcon(":/img/FindIcon"), "Find"))
-    , _bookmarkNextAction     (new QAction(QIcon(":/img/BookmarkNextIcon"), "Bookmark Next"))
-    , _bookmarkPrevAction     (new QAction(QIcon(":/img/BookmarkPrevIcon"), "Bookmark Previous"))
-    , _bookmarkToggleAction   (new QAction(QIcon(":/img/BookmarkIcon"), "Bookmark Toggle"))
-    , _bookmarkAllAction      (new QAction(QIcon(":/img/BookmarkToggleIcon"), "Bookmark List"))
+    , _findAction             (new QAction("Find"))
+    , _bookmarkNextAction     (new QAction("Bookmark Next"))
+    , _bookmarkPrevAction     (new QAction("Bookmark Previous"))
+    , _bookmarkToggleAction   (new QAction("Bookmark Toggle"))
+    , _bookmarkAllAction      (new QAction("Bookmark List"))
     , _gotoLineAction         (new QAction("Goto Line"))
+    , _gotoSymbolAction       (new QAction("Go to Symbol ..."))
+    , _findDeclarationAction  (new QAction("Find Declaration"))
+    , _compareSavedAction     (new QAction("Compare with Saved"))
+    , _compareHeadAction      (new QAction("Compare with HEAD"))
+    , _compareFilesAction     (new QAction("Compare Files ..."))
     // Project menu subitems
     , _openProjectAction      (new QAction("Open project"))
     , _closeProjectAction     (new QAction("Close project"))
     , _newProjectAction       (new QAction("New project"))
-    , _runAction              (new QAction(QIcon(":/img/RunIcon"), "Run"))
-    , _buildAction            (new QAction(QIcon(":/img/MakeIcon"), "Build"))
+    , _runAction              (new QAction("Run"))
+    , _buildAction            (new QAction("Build"))
     , _testAction             (new QAction("Test"))
-    , _rebuildAction          (new QAction(QIcon(":/img/RebuildIcon"), "Rebuild"))
-    , _breakAction            (new QAction(QIcon(":/img/BreakIcon"), "Break"))
+    , _rebuildAction          (new QAction("Rebuild"))
+    , _breakAction            (new QAction("Break"))
+    // Debugger menu subitems
+    , _debugStartAction       (new QAction("Start Debugging"))
+    , _debugStopAction        (new QAction("Stop Debugging"))
+    , _debugContinueAction    (new QAction("Continue"))
+    , _debugStepOverAction    (new QAction("Step Over"))
+    , _debugStepIntoAction    (new QAction("Step Into"))
+    , _debugStepOutAction     (new QAction("Step Out"))
+    , _debugPauseAction       (new QAction("Pause"))
+    , _breakpointToggleAction (new QAction("Toggle Breakpoint"))
+    // Documents menu subitems
+    , _docsAction             (new QAction("Go Documentation ..."))
+    , _updateDocsAction       (new QAction("Update Documentation Index"))
+    // Developer menu subitems
+    , _traceAction            (new QAction("Record Trace"))
+    , _saveTraceAction        (new QAction("Save Trace ..."))
+    , _clearTraceAction       (new QAction("Clear Trace"))
     // Status Bar items
     , _currentColumnValue     (new QLabel)
     , _currentRowValue        (new QLabel)
     // Working widgets
     , _workspace              (new Workspace(this))
-    , _sidekick               (new Sidekick(this))
-    , _bottomkick             (new Bottomkick(this))
+    , _sidekick               (nullptr)
+    , _bottomkick             (nullptr)
+    , _docsDialog             (nullptr)
+    // Services
+    , _settings               (new Settings(this))
+    , _project                (new Project(this))
+    , _recentFiles            (new RecentStore(RecentStore::Files, this))
+    , _recentProjects         (new RecentStore(RecentStore::Projects, this))
+    , _docIndex               (new DocIndex(this))
+    , _started                (false)
 {
+    // Only what is needed for the first paint is done here,
+    // the rest is completed by completeStartup().
+    connect(_project, &Project::filesChanged, _workspace, &Workspace::filesChanged);
+    connect(_workspace, &Workspace::saved, _project, &Project::fileSaved);
+    _workspace->completer()->setProject(_project);
+    connect(_workspace, &Workspace::documentOpened, _project->lspClient(), &LspClient::openDocument);
+    connect(_workspace, &Workspace::documentClosed, _project->lspClient(), &LspClient::closeDocument);
+    connect(_workspace, &Workspace::documentOpened, _project->gitClient(), &GitClient::loadBase);
+    connect(_workspace, &Workspace::baseWanted, _project->gitClient(), &GitClient::loadBase);
+    connect(_workspace, &Workspace::blameWanted, _project->gitClient(), &GitClient::loadBlame);
+    connect(_project->gitClient(), &GitClient::baseLoaded, _workspace, &Workspace::setBase);
+    connect(_project->gitClient(), &GitClient::blameLoaded, _workspace, &Workspace::setBlame);
+    connect(_project->gitClient(), &GitClient::headChanged, _workspace, &Workspace::headChanged);
+    connect(_project, &Project::opened, this, &MainWindow::restoreSession);
+    connect(_project, &Project::aboutToClose, this, &MainWindow::saveSession);
+    connect(_workspace, &Workspace::fileOpened, _recentFiles, &RecentStore::touch);
+    connect(_project, &Project::opened, _recentProjects, &RecentStore::touch);
+    connect(_project->dlvClient(), &DlvClient::stateChanged, this, &MainWindow::debuggerStateChanged);
+    connect(_project->dlvClient(), &DlvClient::stopped, this, &MainWindow::debuggerStopped);
+    connect(_project->dlvClient(), &DlvClient::exited, this, &MainWindow::debuggerExited);
+    connect(_project->dlvClient(), &DlvClient::commandFailed, this, &MainWindow::debuggerFailed);
+    setCentralWidget(_workspace);
+}
+
+/********************************************************************
+*                            ~MainWindow                       dtor *
+********************************************************************/
+MainWindow::~MainWindow() {
+    _settings->wait();
+    _recentFiles->wait();
+    _recentProjects->wait();
+    GlobalDatabase::close();
+}
+
+/********************************************************************
+*                          completeStartup                  private *
+*-------------------------------------------------------------------*
+* Second stage of the startup, run from the event loop after the    *
+* first paint. Icons are loaded in a separate pass, so the menus    *
+* are usable even before all images are decoded.                    *
+********************************************************************/
+void MainWindow::completeStartup() {
     createMenu();
+    StartupTimer::mark("menus");
+    createDocks();
+    StartupTimer::mark("docks");
     createStatusBar();
+    StartupTimer::mark("status bar");
+    if (GlobalDatabase::open()) {
+        _settings->load();
+    }
+    StartupTimer::mark("settings");
+    loadRecent();
+    StartupTimer::mark("recent");
+
+    QTimer::singleShot(0, this, [this] {
+        applyIcons();
+        StartupTimer::mark("icons");
+        StartupTimer::finish();
+    });
+}
+
+/********************************************************************
+*                            createDocks                    private *
+*-------------------------------------------------------------------*
+* Sidekick and Bottomkick are created on first use. Safe to call    *
+* many times.                                                       *
+********************************************************************/
+void MainWindow::createDocks() {
+    if (_sidekick) {
+        return;
+    }
+    _sidekick = new Sidekick(this);
+    _bottomkick = new Bottomkick(_project->dlvClient(), this);
+    _sidekick->setProject(_project);
+    connect(_sidekick->projectTab(), &ProjectTab::fileActivated, _workspace, &Workspace::open);
+    connect(_sidekick->graphTab(), &GraphTab::fileActivated, _workspace, &Workspace::open);
+    connect(_bottomkick->searchTab(), &SearchTab::locationActivated, this, &MainWindow::openLocation);
+    connect(_bottomkick->debugTab(), &DebugTab::locationActivated, this, &MainWindow::openLocation);
 
-    setCentralWidget(_workspace);
     addDockWidget(Qt::LeftDockWidgetArea, _sidekick);
     addDockWidget(Qt::BottomDockWidgetArea, _bottomkick);
 }
 
 /********************************************************************
-*                            ~MainWindow                       dtor *
+*                            applyIcons                     private *
 ********************************************************************/
-MainWindow::~MainWindow() {
+void MainWindow::applyIcons() {
+    const std::vector<std::pair<QAction*, const char*>> icons {
+        {_openFileAction,       ":/img/OpenFileIcon"},
+        {_newFileAction,        ":/img/NewFileIcon"},
+        {_saveFileAction,       ":/img/SaveFileIcon"},
+        {_saveAllAction,        ":/img/SaveAllIcon"},
+        {_propertiesAction,     ":/img/PropertiesIcon"},
+        {_printAction,          ":/img/PrintIcon"},
+        {_quitAction,           ":/img/ExitIcon"},
+        {_undoAction,           ":/img/UndoIcon"},
+        {_redoAction,           ":/img/RedoIcon"},
+        {_cutAction,            ":/img/CutIcon"},
+        {_copyAction,           ":/img/CopyIcon"},
+        {_pasteAction,          ":/img/PasteIcon"},
+        {_findAction,           ":/img/FindIcon"},
+        {_bookmarkNextAction,   ":/img/BookmarkNextIcon"},
+        {_bookmarkPrevAction,   ":/img/BookmarkPrevIcon"},
+        {_bookmarkToggleAction, ":/img/BookmarkIcon"},
+        {_bookmarkAllAction,    ":/img/BookmarkToggleIcon"},
+        {_runAction,            ":/img/RunIcon"},
+        {_buildAction,          ":/img/MakeIcon"},
+        {_rebuildAction,        ":/img/RebuildIcon"},
+        {_breakAction,          ":/img/BreakIcon"},
+    };
+    for (const auto& [action, path] : icons) {
+        action->setIcon(QIcon(path));
+    }
 }
 
 /********************************************************************
@@ -120,12 +300,10 @@ void MainWindow::createMenu() {
     bar->addMenu(createToolsMenu());
     bar->addMenu(createProjectMenu());
 
-    if (auto action = bar->addMenu(new QMenu(MenuDebugger)); action) {
-
-    }
-    if (auto action = bar->addMenu(new QMenu(MenuDocuments)); action) {
-
-    }
+    bar->addMenu(createDebuggerMenu());
+    debuggerStateChanged(_project->dlvClient()->state());
+    bar->addMenu(createDocumentsMenu());
+    bar->addMenu(createDeveloperMenu());
     if (auto action = bar->addMenu(new QMenu(MenuHelp)); action) {
 
     }
@@ -141,6 +319,11 @@ QMenu* MainWindow::createFileMenu() const {
         connect(_openFileAction, &QAction::triggered, this, &MainWindow::openFileHandler);
         menu->addAction(_openFileAction);
     }
+    {
+        _quickOpenAction->setShortcut(Qt::CTRL | Qt::ALT | Qt::Key_O);
+        connect(_quickOpenAction, &QAction::triggered, this, &MainWindow::quickOpenHandler);
+        menu->addAction(_quickOpenAction);
+    }
     {
         _newFileAction->setShortcut(QKeySequence::New);
         connect(_newFileAction, &QAction::triggered, this, &MainWindow::newFileHandler);
@@ -161,8 +344,18 @@ QMenu* MainWindow::createFileMenu() const {
         menu->addAction(_saveAllAction);
     }
     menu->addSeparator();
-    menu->addMenu(_lastOpenedFilesMenu);
-    menu->addMenu(_lastOpenedProjectsMenu);
+    {
+        connect(_lastOpenedFilesMenu, &QMenu::aboutToShow, this, [this] {
+            fillRecentMenu(_lastOpenedFilesMenu, _recentFiles, &MainWindow::lastOpenedFilesHandler);
+        });
+        menu->addMenu(_lastOpenedFilesMenu);
+    }
+    {
+        connect(_lastOpenedProjectsMenu, &QMenu::aboutToShow, this, [this] {
+            fillRecentMenu(_lastOpenedProjectsMenu, _recentProjects, &MainWindow::lastOpenedProjectsHandler);
+        });
+        menu->addMenu(_lastOpenedProjectsMenu);
+    }
     menu->addSeparator();
     {
         _propertiesAction->setShortcut(QKeySequence::Preferences);
@@ -175,6 +368,10 @@ QMenu* MainWindow::createFileMenu() const {
         connect(_printAction, &QAction::triggered, this, &MainWindow::printHandler);
         menu->addAction(_printAction);
     }
+    {
+        connect(_exportPdfAction, &QAction::triggered, this, &MainWindow::exportPdfHandler);
+        menu->addAction(_exportPdfAction);
+    }
     menu->addSeparator();
     {
         _quitAction->setShortcut(QKeySequence::Quit);
@@ -235,6 +432,100 @@ QMenu* MainWindow::createProjectMenu() const {
     return menu;
 }
 
+/********************************************************************
+*                        createDebuggerMenu                 private *
+*-------------------------------------------------------------------*
+* Shortcuts as in most debuggers. Stepping is enabled only while    *
+* the program is stopped (see debuggerStateChanged).                *
+********************************************************************/
+QMenu* MainWindow::createDebuggerMenu() const {
+    QMenu* menu = new QMenu(MenuDebugger);
+    {
+        _debugStartAction->setShortcut(Qt::Key_F5);
+        connect(_debugStartAction, &QAction::triggered, this, &MainWindow::debugStartHandler);
+        menu->addAction(_debugStartAction);
+    }
+    {
+        _debugStopAction->setShortcut(Qt::SHIFT | Qt::Key_F5);
+        connect(_debugStopAction, &QAction::triggered, this, &MainWindow::debugStopHandler);
+        menu->addAction(_debugStopAction);
+    }
+    menu->addSeparator();
+    {
+        _debugContinueAction->setShortcut(Qt::Key_F8);
+        connect(_debugContinueAction, &QAction::triggered, this, &MainWindow::debugContinueHandler);
+        menu->addAction(_debugContinueAction);
+    }
+    {
+        _debugStepOverAction->setShortcut(Qt::Key_F10);
+        connect(_debugStepOverAction, &QAction::triggered, this, &MainWindow::debugStepOverHandler);
+        menu->addAction(_debugStepOverAction);
+    }
+    {
+        _debugStepIntoAction->setShortcut(Qt::Key_F11);
+        connect(_debugStepIntoAction, &QAction::triggered, this, &MainWindow::debugStepIntoHandler);
+        menu->addAction(_debugStepIntoAction);
+    }
+    {
+        _debugStepOutAction->setShortcut(Qt::SHIFT | Qt::Key_F11);
+        connect(_debugStepOutAction, &QAction::triggered, this, &MainWindow::debugStepOutHandler);
+        menu->addAction(_debugStepOutAction);
+    }
+    {
+        connect(_debugPauseAction, &QAction::triggered, this, &MainWindow::debugPauseHandler);
+        menu->addAction(_debugPauseAction);
+    }
+    menu->addSeparator();
+    {
+        _breakpointToggleAction->setShortcut(Qt::Key_F9);
+        connect(_breakpointToggleAction, &QAction::triggered, this, &MainWindow::breakpointToggleHandler);
+        menu->addAction(_breakpointToggleAction);
+    }
+    return menu;
+}
+
+/********************************************************************
+*                        createDocumentsMenu                private *
+********************************************************************/
+QMenu* MainWindow::createDocumentsMenu() const {
+    QMenu* menu = new QMenu(MenuDocuments);
+    {
+        _docsAction->setShortcut(Qt::Key_F1);
+        connect(_docsAction, &QAction::triggered, this, &MainWindow::docsHandler);
+        menu->addAction(_docsAction);
+    }
+    {
+        connect(_updateDocsAction, &QAction::triggered, this, &MainWindow::updateDocsHandler);
+        menu->addAction(_updateDocsAction);
+    }
+    return menu;
+}
+
+/********************************************************************
+*                        createDeveloperMenu                private *
+*-------------------------------------------------------------------*
+* Tracing of the running application (see Trace). Recording starts  *
+* checked when GOEDIT_TRACE was set at startup.                     *
+********************************************************************/
+QMenu* MainWindow::createDeveloperMenu() const {
+    QMenu* menu = new QMenu(MenuDeveloper);
+    {
+        _traceAction->setCheckable(true);
+        _traceAction->setChecked(Trace::isEnabled());
+        connect(_traceAction, &QAction::triggered, this, &MainWindow::traceHandler);
+        menu->addAction(_traceAction);
+    }
+    {
+        connect(_saveTraceAction, &QAction::triggered, this, &MainWindow::saveTraceHandler);
+        menu->addAction(_saveTraceAction);
+    }
+    {
+        connect(_clearTraceAction, &QAction::triggered, this, &MainWindow::clearTraceHandler);
+        menu->addAction(_clearTraceAction);
+    }
+    return menu;
+}
+
 /********************************************************************
 *                           createEditMenu                  private *
 ********************************************************************/
@@ -276,6 +567,52 @@ QMenu* MainWindow::createEditMenu() const {
         connect(_selectAllAction, &QAction::triggered, this, &MainWindow::selectAllHandler);
         menu->addAction(_selectAllAction);
     }
+    {
+        _cursorAboveAction->setShortcut(Qt::ALT | Qt::SHIFT | Qt::Key_Up);
+        connect(_cursorAboveAction, &QAction::triggered, this, &MainWindow::cursorAboveHandler);
+        menu->addAction(_cursorAboveAction);
+    }
+    {
+        _cursorBelowAction->setShortcut(Qt::ALT | Qt::SHIFT | Qt::Key_Down);
+        connect(_cursorBelowAction, &QAction::triggered, this, &MainWindow::cursorBelowHandler);
+        menu->addAction(_cursorBelowAction);
+    }
+    {
+        _nextOccurrenceAction->setShortcut(Qt::CTRL | Qt::Key_D);
+        connect(_nextOccurrenceAction, &QAction::triggered, this, &MainWindow::nextOccurrenceHandler);
+        menu->addAction(_nextOccurrenceAction);
+    }
+    {
+        _allOccurrencesAction->setShortcut(Qt::CTRL | Qt::SHIFT | Qt::Key_L);
+        connect(_allOccurrencesAction, &QAction::triggered, this, &MainWindow::allOccurrencesHandler);
+        menu->addAction(_allOccurrencesAction);
+    }
+    menu->addSeparator();
+    {
+        _foldAction->setShortcut(Qt::CTRL | Qt::SHIFT | Qt::Key_BracketLeft);
+        connect(_foldAction, &QAction::triggered, this, &MainWindow::foldHandler);
+        menu->addAction(_foldAction);
+    }
+    {
+        _unfoldAction->setShortcut(Qt::CTRL | Qt::SHIFT | Qt::Key_BracketRight);
+        connect(_unfoldAction, &QAction::triggered, this, &MainWindow::unfoldHandler);
+        menu->addAction(_unfoldAction);
+    }
+    {
+        _foldAllAction->setShortcut(Qt::CTRL | Qt::ALT | Qt::Key_BracketLeft);
+        connect(_foldAllAction, &QAction::triggered, this, &MainWindow::foldAllHandler);
+        menu->addAction(_foldAllAction);
+    }
+    {
+        _unfoldAllAction->setShortcut(Qt::CTRL | Qt::ALT | Qt::Key_BracketRight);
+        connect(_unfoldAllAction, &QAction::triggered, this, &MainWindow::unfoldAllHandler);
+        menu->addAction(_unfoldAllAction);
+    }
+    {
+        _matchingBracketAction->setShortcut(Qt::CTRL | Qt::Key_M);
+        connect(_matchingBracketAction, &QAction::triggered, this, &MainWindow::matchingBracketHandler);
+        menu->addAction(_matchingBracketAction);
+    }
     return menu;
 }
 
@@ -316,6 +653,29 @@ QMenu* MainWindow::createToolsMenu() const {
         connect(_gotoLineAction, &QAction::triggered, this, &MainWindow::gotoLineHandler);
         menu->addAction(_gotoLineAction);
     }
+    {
+        _gotoSymbolAction->setShortcut(Qt::CTRL | Qt::ALT | Qt::Key_S);
+        connect(_gotoSymbolAction, &QAction::triggered, this, &MainWindow::gotoSymbolHandler);
+        menu->addAction(_gotoSymbolAction);
+    }
+    {
+        _findDeclarationAction->setShortcut(Qt::Key_F2);
+        connect(_findDeclarationAction, &QAction::triggered, this, &MainWindow::findDeclarationHandler);
+        menu->addAction(_findDeclarationAction);
+    }
+    menu->addSeparator();
+    {
+        connect(_compareSavedAction, &QAction::triggered, this, &MainWindow::compareSavedHandler);
+        menu->addAction(_compareSavedAction);
+    }
+    {
+        connect(_compareHeadAction, &QAction::triggered, this, &MainWindow::compareHeadHandler);
+        menu->addAction(_compareHeadAction);
+    }
+    {
+        connect(_compareFilesAction, &QAction::triggered, this, &MainWindow::compareFilesHandler);
+        menu->addAction(_compareFilesAction);
+    }
     return menu;
 }
 
@@ -342,14 +702,77 @@ void MainWindow::createStatusBar() {
     statusBar()->addPermanentWidget(_currentRowValue);
 }
 
+/********************************************************************
+*                           openLocation                    private *
+*-------------------------------------------------------------------*
+* Opens the file and moves the cursor to the place. Relative paths  *
+* are in the project.                                               *
+********************************************************************/
+void MainWindow::openLocation(const QString& path, const int line, const int column) {
+    const QString file = QFileInfo(path).isAbsolute() ? path : _project->root() + '/' + path;
+    if (Buffer* const buffer = _workspace->open(file); buffer) {
+        buffer->gotoPosition(line, column);
+    }
+}
+
+/********************************************************************
+*                        debuggerStateChanged               private *
+********************************************************************/
+void MainWindow::debuggerStateChanged(const int state) {
+    _debugStartAction->setEnabled(state == DlvClient::Idle);
+    _debugStopAction->setEnabled(state != DlvClient::Idle);
+    _debugContinueAction->setEnabled(state == DlvClient::Stopped);
+    _debugStepOverAction->setEnabled(state == DlvClient::Stopped);
+    _debugStepIntoAction->setEnabled(state == DlvClient::Stopped);
+    _debugStepOutAction->setEnabled(state == DlvClient::Stopped);
+    _debugPauseAction->setEnabled(state == DlvClient::Running);
+}
+
+/********************************************************************
+*                          debuggerStopped                  private *
+*-------------------------------------------------------------------*
+* Shows the place of the stop and the state of the goroutine.       *
+********************************************************************/
+void MainWindow::debuggerStopped(const QString& path, const int line, const qint64 goroutine) {
+    createDocks();
+    if (!path.isEmpty()) {
+        openLocation(path, line, 0);
+    }
+    _bottomkick->debugTab()->refresh(goroutine);
+    _bottomkick->showTab(_bottomkick->debugTab());
+}
+
+/********************************************************************
+*                          debuggerExited                   private *
+********************************************************************/
+void MainWindow::debuggerExited(const int status) {
+    if (_bottomkick) {
+        _bottomkick->debugTab()->clear();
+    }
+    statusBar()->showMessage(QString("Program exited with status %1").arg(status), 5000);
+}
+
+/********************************************************************
+*                          debuggerFailed                   private *
+*-------------------------------------------------------------------*
+* Delve refused to continue or step, the program is still stopped.  *
+********************************************************************/
+void MainWindow::debuggerFailed(const QString& message) {
+    statusBar()->showMessage(QString("Debugger: %1").arg(message), 5000);
+}
+
 /********************************************************************
 *                             showEvent                     private *
+*-------------------------------------------------------------------*
+* The geometry of the window is needed before the first paint, so   *
+* it's kept in QSettings (a small file) and not with the settings   *
+* in the global database, which is opened after the first paint.    *
 ********************************************************************/
 void MainWindow::showEvent(QShowEvent*) {
     QSettings settings;
 
     if (auto rect = settings.value("mainWindow/geometry", QRect()).toRect(); rect.isNull()) {
-         const int screenIndex = settings.value("mainWindow/screenIndex", -1).toInt();
+        const int screenIndex = settings.value("mainWindow/screenIndex", -1).toInt();
         Shared::resize(this, 75, 75, screenIndex);
         Shared::moveToCenter(this, screenIndex);
     } else {
@@ -357,38 +780,220 @@ void MainWindow::showEvent(QShowEvent*) {
     }
 }
 
+/********************************************************************
+*                            saveSession                    private *
+*-------------------------------------------------------------------*
+* Snapshot of the project session, written in the background.       *
+********************************************************************/
+void MainWindow::saveSession() {
+    if (!_project->isOpen()) {
+        return;
+    }
+    Session::Snapshot snapshot;
+    _workspace->snapshot(snapshot);
+    if (_sidekick) {
+        snapshot.windowState = saveState();
+        snapshot.expanded = _sidekick->projectTab()->expanded();
+    }
+    _project->session()->save(snapshot);
+}
+
+/********************************************************************
+*                           restoreSession                  private *
+********************************************************************/
+void MainWindow::restoreSession() {
+    Session::Snapshot snapshot;
+    if (!_project->session()->load(snapshot)) {
+        return;
+    }
+    createDocks();
+    if (!snapshot.windowState.isEmpty()) {
+        restoreState(snapshot.windowState);
+    }
+    _sidekick->projectTab()->setExpanded(snapshot.expanded);
+    _workspace->restore(snapshot);
+}
+
+/********************************************************************
+*                             loadRecent                    private *
+*-------------------------------------------------------------------*
+* Recent files and projects are read once, after the first paint.   *
+* Menus are filled later from memory only.                          *
+********************************************************************/
+void MainWindow::loadRecent() {
+    if (!GlobalDatabase::open()) {
+        return;
+    }
+    for (auto store : {_recentFiles, _recentProjects}) {
+        store->load();
+        store->prune();
+    }
+}
+
+/********************************************************************
+*                           fillRecentMenu                  private *
+********************************************************************/
+void MainWindow::fillRecentMenu(QMenu* menu, const RecentStore* store, void (MainWindow::*handler)()) const {
+    menu->clear();
+    for (const auto& path : store->first(MaxRecentItems)) {
+        QAction* const action = menu->addAction(QDir::toNativeSeparators(path));
+        action->setData(path);
+        connect(action, &QAction::triggered, this, handler);
+    }
+}
+
+/********************************************************************
+*                               print                       private *
+*-------------------------------------------------------------------*
+* Text of the buffer is taken here, pages are made in background.   *
+* The progress dialog is not modal, so editing goes on meanwhile.   *
+********************************************************************/
+void MainWindow::print(Buffer* buf, std::unique_ptr<QPagedPaintDevice> device, const QString& fileName, const int fromPage, const int toPage) {
+    const QString title = buf->isUntitled() ? QString("Untitled") : QFileInfo(buf->path()).fileName();
+    const PrintJob::Options options{
+        title,
+        buf->widget()->font(),
+        Settings::values().tabWidth,
+        buf->path().endsWith(".go"),
+        fromPage,
+        toPage
+    };
+    auto const job = new PrintJob(std::move(device), fileName, buf->text(), options, this);
+    auto const progress = new QProgressDialog(QString("Printing %1 ...").arg(title), "Cancel", 0, job->lineCount(), this);
+    progress->setWindowTitle(fileName.isEmpty() ? "Print" : "Export to PDF");
+    progress->setMinimumDuration(500);
+
+    connect(progress, &QProgressDialog::canceled, job, &PrintJob::cancel);
+    connect(job, &PrintJob::progress, progress, &QProgressDialog::setValue);
+    connect(job, &PrintJob::finished, this, [this, job, progress, title](const bool ok, const int pages) {
+        progress->reset();
+        progress->deleteLater();
+        job->deleteLater();
+        statusBar()->showMessage(ok ? QString("%1: %2 pages printed").arg(title).arg(pages)
+                                    : QString("%1: printing stopped").arg(title), 5000);
+    });
+    job->start();
+}
+
+/********************************************************************
+*                             paintEvent                    private *
+********************************************************************/
+void MainWindow::paintEvent(QPaintEvent* event) {
+    QMainWindow::paintEvent(event);
+    if (!_started) {
+        _started = true;
+        StartupTimer::mark(StartupTimer::FirstPaint);
+        QTimer::singleShot(0, this, &MainWindow::completeStartup);
+    }
+}
+
 /********************************************************************
 *                             closeEvent                    private *
 ********************************************************************/
 void MainWindow::closeEvent(QCloseEvent*) {
+    saveSession();
     QSettings settings;
     settings.setValue("mainWindow/screenIndex", Shared::currentScreenIndex(this));
     settings.setValue("mainWindow/geometry", geometry());
+    _settings->flush();
 }
 
 
 void MainWindow::newFileHandler() {
+    _workspace->create();
 }
 
 void MainWindow::openFileHandler() {
+    const QString path = QFileDialog::getOpenFileName(this, "Open File", _project->root());
+    if (!path.isEmpty()) {
+        _workspace->open(path);
+    }
+}
+
+void MainWindow::quickOpenHandler() {
+    if (!_project->isOpen()) {
+        return;
+    }
+    FileIndex* const index = _project->fileIndex();
+    FilterDialog dialog("Quick Open", [index](const QString& text) {
+        QVector<FilterDialog::Item> items;
+        for (const auto& match : index->match(text, 100)) {
+            items.append({match.path, QString(), match.path});
+        }
+        return items;
+    }, this);
+
+    if (dialog.exec() == QDialog::Accepted) {
+        if (const QString path = dialog.selected().toString(); !path.isEmpty()) {
+            _workspace->open(_project->root() + '/' + path);
+        }
+    }
 }
 
 void MainWindow::saveFileHandler() {
+    _workspace->save(_workspace->current());
 }
 
 void MainWindow::saveAsHandler() {
+    _workspace->saveAs(_workspace->current());
 }
 
 void MainWindow::saveAllHandler() {
+    _workspace->saveAll();
 }
 
 void MainWindow::printHandler() {
+    Buffer* const buf = _workspace->current();
+    if (!buf) {
+        return;
+    }
+    auto printer = std::make_unique<QPrinter>(QPrinter::HighResolution);
+    printer->setDocName(buf->isUntitled() ? QString("Untitled") : QFileInfo(buf->path()).fileName());
+    QPrintDialog dialog(printer.get(), this);
+    if (dialog.exec() == QDialog::Accepted) {
+        const int fromPage = printer->fromPage();
+        const int toPage = printer->toPage();
+        print(buf, std::move(printer), QString(), fromPage, toPage);
+    }
+}
+
+void MainWindow::exportPdfHandler() {
+    Buffer* const buf = _workspace->current();
+    if (!buf) {
+        return;
+    }
+    const QString base = buf->isUntitled() ? QDir(_project->root()).filePath("Untitled") : buf->path();
+    const QString path = QFileDialog::getSaveFileName(this, "Export to PDF", base + ".pdf", "PDF files (*.pdf)");
+    if (path.isEmpty()) {
+        return;
+    }
+    auto writer = std::make_unique<QPdfWriter>(path);
+    writer->setCreator("Goedit");
+    writer->setTitle(QFileInfo(base).fileName());
+    writer->setResolution(300);
+    writer->setPageSize(QPageSize(QPageSize::A4));
+    writer->setPageMargins(QMarginsF(15, 15, 15, 15), QPageLayout::Millimeter);
+    print(buf, std::move(writer), path, 0, 0);
 }
 
 void MainWindow::lastOpenedFilesHandler() {
+    if (auto const action = qobject_cast<QAction*>(sender()); action) {
+        const QString path = action->data().toString();
+        if (!_workspace->open(path)) {
+            _recentFiles->remove(path);
+        }
+    }
 }
 
 void MainWindow::lastOpenedProjectsHandler() {
+    if (auto const action = qobject_cast<QAction*>(sender()); action) {
+        const QString path = action->data().toString();
+        if (!QFileInfo(path).isDir()) {
+            _recentProjects->remove(path);
+            return;
+        }
+        _project->open(path);
+    }
 }
 
 void MainWindow::undoHandler() {}
@@ -398,11 +1003,89 @@ void MainWindow::copyHandler() {}
 void MainWindow::pasteHandler() {}
 void MainWindow::deleteHandler() {}
 void MainWindow::selectAllHandler() {}
-void MainWindow::propertiesHandler() {}
+
+void MainWindow::cursorAboveHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->addCursorAbove();
+    }
+}
+
+void MainWindow::cursorBelowHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->addCursorBelow();
+    }
+}
+
+void MainWindow::nextOccurrenceHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->addNextOccurrence();
+    }
+}
+
+void MainWindow::allOccurrencesHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        if (const int count = editor->selectAllOccurrences(); count > 1) {
+            statusBar()->showMessage(QString("%1 cursors").arg(count), 3000);
+        }
+    }
+}
+
+void MainWindow::foldHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->fold();
+    }
+}
+
+void MainWindow::unfoldHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->unfold();
+    }
+}
+
+void MainWindow::foldAllHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->foldAll();
+    }
+}
+
+void MainWindow::unfoldAllHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->unfoldAll();
+    }
+}
+
+void MainWindow::matchingBracketHandler() {
+    if (auto const editor = dynamic_cast<Editor*>(_workspace->current()); editor) {
+        editor->gotoMatchingBracket();
+    }
+}
+void MainWindow::propertiesHandler() {
+    SettingsDialog dialog(Settings::values(), this);
+    if (dialog.exec() == QDialog::Accepted) {
+        _settings->setValues(dialog.values());
+    }
+}
 
 // Tools menu subitems
 void MainWindow::findHandler() {
-    qDebug() << "MainWindow::findReplaceHandler";
+    if (!_project->isOpen()) {
+        return;
+    }
+    FindDialog dialog(this);
+    if (Buffer* const buffer = _workspace->current(); buffer) {
+        dialog.setText(buffer->wordUnderCursor());
+    }
+    if (dialog.exec() != QDialog::Accepted) {
+        return;
+    }
+
+    createDocks();
+    QElapsedTimer timer;
+    timer.start();
+    const TrigramIndex::Query query{dialog.text(), dialog.isRegex(), dialog.isCaseSensitive()};
+    const auto hits = _project->trigramIndex()->search(query, MaxSearchHits);
+    _bottomkick->searchTab()->setResults(query.text, hits, timer.elapsed());
+    _bottomkick->showTab(_bottomkick->searchTab());
 }
 void MainWindow::bookmarkNextHandler() {
     qDebug() << "MainWindow::bookmarkNextHandler";
@@ -420,8 +1103,98 @@ void MainWindow::gotoLineHandler() {
     qDebug() << "MainWindow::gotoLineHandler";
 }
 
-void MainWindow::openProjectHandler() {}
-void MainWindow::closeProjectHandler() {}
+static FilterDialog::Item symbolItem(const SymbolIndex::Symbol& symbol) {
+    const QString name = symbol.container.isEmpty() ? symbol.name : symbol.container + '.' + symbol.name;
+    const QString detail = QString("%1  %2:%3").arg(SymbolIndex::kindName(symbol.kind), symbol.path).arg(symbol.line + 1);
+    return {name, detail, QVariantList{symbol.path, symbol.line, symbol.column}};
+}
+
+void MainWindow::gotoSymbolHandler() {
+    if (!_project->isOpen()) {
+        return;
+    }
+    SymbolIndex* const index = _project->symbolIndex();
+    FilterDialog dialog("Go to Symbol", [index](const QString& text) {
+        QVector<FilterDialog::Item> items;
+        for (const auto& symbol : index->search(text, 100)) {
+            items.append(symbolItem(symbol));
+        }
+        return items;
+    }, this);
+
+    if (dialog.exec() == QDialog::Accepted) {
+        if (const auto location = dialog.selected().toList(); location.size() == 3) {
+            openLocation(location[0].toString(), location[1].toInt(), location[2].toInt());
+        }
+    }
+}
+
+void MainWindow::findDeclarationHandler() {
+    Buffer* const buffer = _workspace->current();
+    if (!_project->isOpen() || !buffer) {
+        return;
+    }
+    const QString word = buffer->wordUnderCursor();
+    if (word.isEmpty()) {
+        return;
+    }
+
+    const auto symbols = _project->symbolIndex()->find(word);
+    if (symbols.isEmpty()) {
+        statusBar()->showMessage(QString("No declaration of '%1'").arg(word), 3000);
+        return;
+    }
+    if (symbols.size() == 1) {
+        openLocation(symbols[0].path, symbols[0].line, symbols[0].column);
+        return;
+    }
+
+    // More candidates (methods of many types, ...): the user picks one.
+    FilterDialog dialog("Find Declaration", [symbols](const QString& text) {
+        QVector<FilterDialog::Item> items;
+        for (const auto& symbol : symbols) {
+            auto item = symbolItem(symbol);
+            if (item.text.contains(text, Qt::CaseInsensitive) || item.detail.contains(text, Qt::CaseInsensitive)) {
+                items.append(item);
+            }
+        }
+        return items;
+    }, this);
+
+    if (dialog.exec() == QDialog::Accepted) {
+        if (const auto location = dialog.selected().toList(); location.size() == 3) {
+            openLocation(location[0].toString(), location[1].toInt(), location[2].toInt());
+        }
+    }
+}
+
+void MainWindow::compareSavedHandler() {
+    if (!_workspace->compareWithSaved(_workspace->current())) {
+        statusBar()->showMessage("Nothing to compare: the document has no saved file", 3000);
+    }
+}
+
+void MainWindow::compareHeadHandler() {
+    if (!_workspace->compareWithHead(_workspace->current())) {
+        statusBar()->showMessage("Nothing to compare: the document is not tracked by git", 3000);
+    }
+}
+
+void MainWindow::compareFilesHandler() {
+    _workspace->compareFiles();
+}
+
+void MainWindow::openProjectHandler() {
+    const QString dir = QFileDialog::getExistingDirectory(this, "Open project", _project->root());
+    if (!dir.isEmpty()) {
+        _project->open(dir);
+    }
+}
+
+void MainWindow::closeProjectHandler() {
+    _project->close();
+}
+
 void MainWindow::newProjectHandler() {}
 void MainWindow::runHandler() {}
 void MainWindow::buildHandler() {}
@@ -429,3 +1202,96 @@ void MainWindow::testHandler() {}
 void MainWindow::rebuildHandler() {}
 void MainWindow::breakHandler() {}
 
+void MainWindow::debugStartHandler() {
+    if (_project->isOpen()) {
+        _workspace->saveAll();
+        _project->dlvClient()->start(_project->root());
+    }
+}
+
+void MainWindow::debugStopHandler() {
+    _project->dlvClient()->stop();
+    if (_bottomkick) {
+        _bottomkick->debugTab()->clear();
+    }
+}
+
+void MainWindow::debugContinueHandler() {
+    _project->dlvClient()->resume();
+}
+
+void MainWindow::debugStepOverHandler() {
+    _project->dlvClient()->next();
+}
+
+void MainWindow::debugStepIntoHandler() {
+    _project->dlvClient()->step();
+}
+
+void MainWindow::debugStepOutHandler() {
+    _project->dlvClient()->stepOut();
+}
+
+void MainWindow::debugPauseHandler() {
+    _project->dlvClient()->halt();
+}
+
+// The editor has no breakpoint markers yet, so the change is reported.
+void MainWindow::breakpointToggleHandler() {
+    Buffer* const buffer = _workspace->current();
+    if (!buffer || buffer->isUntitled()) {
+        return;
+    }
+    const int line = buffer->cursorLine();
+    const bool set = _project->dlvClient()->toggleBreakpoint(buffer->path(), line);
+    statusBar()->showMessage(QString("Breakpoint %1 at line %2").arg(set ? "set" : "removed").arg(line + 1), 3000);
+}
+
+// Documentation of the word under the cursor. The index is opened
+// (built the first time) only when the documentation is asked for.
+void MainWindow::docsHandler() {
+    if (!_docIndex->open()) {
+        statusBar()->showMessage("Can't open the documentation index", 3000);
+        return;
+    }
+    if (!_docsDialog) {
+        _docsDialog = new DocsDialog(_docIndex, this);
+        connect(_docsDialog, &DocsDialog::locationActivated, this, &MainWindow::openLocation);
+    }
+    if (Buffer* const buffer = _workspace->current(); buffer) {
+        _docsDialog->setText(buffer->wordUnderCursor());
+    }
+    _docsDialog->show();
+    _docsDialog->raise();
+    _docsDialog->activateWindow();
+}
+
+void MainWindow::updateDocsHandler() {
+    _docIndex->update();
+}
+
+void MainWindow::traceHandler() {
+    Trace::setEnabled(_traceAction->isChecked());
+}
+
+void MainWindow::saveTraceHandler() {
+    const QString path = QFileDialog::getSaveFileName(this, "Save Trace", "goedit-trace.json", "Trace (*.json)");
+    if (path.isEmpty()) {
+        return;
+    }
+    if (!Trace::write(QFile::encodeName(path).toStdString())) {
+        qWarning() << "MainWindow: can't write the trace" << path;
+        return;
+    }
+    if (const size_t dropped = Trace::dropped(); dropped > 0) {
+        statusBar()->showMessage(QString("Trace saved, %1 oldest events overwritten").arg(dropped));
+    }
+}
+
+void MainWindow::clearTraceHandler() {
+    const bool enabled = Trace::isEnabled();
+    Trace::setEnabled(false);
+    Trace::clear();
+    Trace::setEnabled(enabled);
+}
+
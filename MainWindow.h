@@ -4,6 +4,7 @@
 /*------- include files:
 -------------------------------------------------------------------*/
 #include <QMainWindow>
+#include <memory>
 
 /*------- forward declarations:
 -------------------------------------------------------------------*/
@@ -11,9 +12,16 @@ class QMenu;
 class QAction;
 class QToolBar;
 class QLabel;
+class QPagedPaintDevice;
 class Workspace;
+class Buffer;
 class Sidekick;
 class Bottomkick;
+class Project;
+class RecentStore;
+class Settings;
+class DocIndex;
+class DocsDialog;
 
 /********************************************************************
 *                            MainWindow                             *
@@ -29,13 +37,18 @@ class MainWindow : public QMainWindow {
     static const char* const MenuProject;
     static const char* const MenuDebugger;
     static const char* const MenuDocuments;
+    static const char* const MenuDeveloper;
     static const char* const MenuHelp;
+    // Limits
+    static constexpr int MaxSearchHits = 2000;
+    static constexpr int MaxRecentItems = 20;
     // Toolbars
     // File menu subitems
 
 // members
     // File menu subitems
     QAction* const _openFileAction;
+    QAction* const _quickOpenAction;
     QAction* const _newFileAction;
     QAction* const _saveFileAction;
     QAction* const _saveAsAction;
@@ -44,6 +57,7 @@ class MainWindow : public QMainWindow {
     QMenu* const _lastOpenedProjectsMenu;
     QAction* const _propertiesAction;
     QAction* const _printAction;
+    QAction* const _exportPdfAction;
     QAction* const _quitAction;
     // Edit menu subitems
     QAction* const _undoAction;
@@ -53,6 +67,15 @@ class MainWindow : public QMainWindow {
     QAction* const _pasteAction;
     QAction* const _deleteAction;
     QAction* const _selectAllAction;
+    QAction* const _cursorAboveAction;
+    QAction* const _cursorBelowAction;
+    QAction* const _nextOccurrenceAction;
+    QAction* const _allOccurrencesAction;
+    QAction* const _foldAction;
+    QAction* const _unfoldAction;
+    QAction* const _foldAllAction;
+    QAction* const _unfoldAllAction;
+    QAction* const _matchingBracketAction;
     // Tool menu subitems
     QAction* const _findAction;
     QAction* const _bookmarkNextAction;
@@ -60,6 +83,11 @@ class MainWindow : public QMainWindow {
     QAction* const _bookmarkToggleAction;
     QAction* const _bookmarkAllAction;
     QAction* const _gotoLineAction;
+    QAction* const _gotoSymbolAction;
+    QAction* const _findDeclarationAction;
+    QAction* const _compareSavedAction;
+    QAction* const _compareHeadAction;
+    QAction* const _compareFilesAction;
     // Project menu subitems
     QAction* const _openProjectAction;
     QAction* const _closeProjectAction;
@@ -69,6 +97,22 @@ class MainWindow : public QMainWindow {
     QAction* const _testAction;
     QAction* const _rebuildAction;
     QAction* const _breakAction;
+    // Debugger menu subitems
+    QAction* const _debugStartAction;
+    QAction* const _debugStopAction;
+    QAction* const _debugContinueAction;
+    QAction* const _debugStepOverAction;
+    QAction* const _debugStepIntoAction;
+    QAction* const _debugStepOutAction;
+    QAction* const _debugPauseAction;
+    QAction* const _breakpointToggleAction;
+    // Documents menu subitems
+    QAction* const _docsAction;
+    QAction* const _updateDocsAction;
+    // Developer menu subitems
+    QAction* const _traceAction;
+    QAction* const _saveTraceAction;
+    QAction* const _clearTraceAction;
     // Toolbars
 
     // Status Bar items
@@ -76,28 +120,54 @@ class MainWindow : public QMainWindow {
     QLabel* const _currentRowValue;
     // Working widgets
     Workspace*  const _workspace;
-    Sidekick*   const _sidekick;
-    Bottomkick* const _bottomkick;
+    Sidekick*   _sidekick;
+    Bottomkick* _bottomkick;
+    DocsDialog* _docsDialog;
+    // Services
+    Settings* const _settings;
+    Project* const _project;
+    RecentStore* const _recentFiles;
+    RecentStore* const _recentProjects;
+    DocIndex* const _docIndex;
+    bool _started;
 
 public:
     MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
 private:
+    void completeStartup();
+    void createDocks();
+    void applyIcons();
     void createMenu();
     QMenu* createFileMenu() const;
     QMenu* createEditMenu() const;
     QMenu* createToolsMenu() const;
     QMenu* createProjectMenu() const;
+    QMenu* createDebuggerMenu() const;
+    QMenu* createDocumentsMenu() const;
+    QMenu* createDeveloperMenu() const;
     void createToolbars();
     void createStatusBar();
+    void openLocation(const QString&, const int, const int);
+    void debuggerStateChanged(const int);
+    void debuggerStopped(const QString&, const int, const qint64);
+    void debuggerExited(const int);
+    void debuggerFailed(const QString&);
+    void saveSession();
+    void restoreSession();
+    void loadRecent();
+    void fillRecentMenu(QMenu*, const RecentStore*, void (MainWindow::*)()) const;
+    void print(Buffer*, std::unique_ptr<QPagedPaintDevice>, const QString&, const int, const int);
 
     void showEvent(QShowEvent*) override;
+    void paintEvent(QPaintEvent*) override;
     void closeEvent(QCloseEvent*) override;
 private slots:
     // File menu subitems handlers
     void newFileHandler();
     void openFileHandler();
+    void quickOpenHandler();
     void saveFileHandler();
     void saveAsHandler();
     void saveAllHandler();
@@ -105,6 +175,7 @@ private slots:
     void lastOpenedProjectsHandler();
     void propertiesHandler();
     void printHandler();
+    void exportPdfHandler();
     // Edit menu subitems handlers
     void undoHandler();
     void redoHandler();
@@ -113,6 +184,15 @@ private slots:
     void pasteHandler();
     void deleteHandler();
     void selectAllHandler();
+    void cursorAboveHandler();
+    void cursorBelowHandler();
+    void nextOccurrenceHandler();
+    void allOccurrencesHandler();
+    void foldHandler();
+    void unfoldHandler();
+    void foldAllHandler();
+    void unfoldAllHandler();
+    void matchingBracketHandler();
     // Tools menu subitems
     void findHandler();
     void bookmarkNextHandler();
@@ -120,6 +200,11 @@ private slots:
     void bookmarkToggleHandler();
     void bookmarkAllHandler();
     void gotoLineHandler();
+    void gotoSymbolHandler();
+    void findDeclarationHandler();
+    void compareSavedHandler();
+    void compareHeadHandler();
+    void compareFilesHandler();
     // Project menu subitems handlers
     void openProjectHandler();
     void closeProjectHandler();
@@ -129,6 +214,22 @@ private slots:
     void testHandler();
     void rebuildHandler();
     void breakHandler();
+    // Debugger menu subitems handlers
+    void debugStartHandler();
+    void debugStopHandler();
+    void debugContinueHandler();
+    void debugStepOverHandler();
+    void debugStepIntoHandler();
+    void debugStepOutHandler();
+    void debugPauseHandler();
+    void breakpointToggleHandler();
+    // Documents menu subitems handlers
+    void docsHandler();
+    void updateDocsHandler();
+    // Developer menu subitems handlers
+    void traceHandler();
+    void saveTraceHandler();
+    void clearTraceHandler();
 };
 
 #endif // GOEDIT_MAIN_WINDOW_H
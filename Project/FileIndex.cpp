@@ -0,0 +1,398 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FileIndex.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QSet>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
+#include <unordered_set>
+#include "FileIndex.h"
+#include "FileWatcher.h"
+#include "ProjectWalker.h"
+#include "Shared/Fuzzy.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int BatchSize = 512;        // directories posted at once
+static constexpr size_t MinChunk = 4096;     // entries scored by one task
+
+//*******************************************************************
+//                             FileIndex                        CTOR
+//*******************************************************************
+FileIndex::FileIndex(QObject* parent)
+    : QObject(parent)
+    , _epoch(0)
+    , _generation(0)
+    , _lastGeneration(0)
+{
+    // One thread, so updates are applied in the order they came.
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                            ~FileIndex                        dtor *
+********************************************************************/
+FileIndex::~FileIndex() {
+    ++_epoch;
+    _pool.clear();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                               reset                        public *
+*-------------------------------------------------------------------*
+* Indexes the project from scratch. The walk runs in background     *
+* and delivers directories in batches.                              *
+********************************************************************/
+void FileIndex::reset(const QString& root) {
+    clear();
+    _root = root;
+    const quint32 epoch = _epoch;
+
+    QtConcurrent::run(&_pool, [this, root, epoch] {
+        QVector<DirFiles> batch;
+        ProjectWalker::walk(root, [&](const QString& relDir, const QVector<FileSystem::Entry>& files) {
+            if (epoch != _epoch) {
+                return false;
+            }
+            batch.append({relDir, files});
+            if (batch.size() >= BatchSize) {
+                post(epoch, std::move(batch));
+                batch.clear();
+            }
+            return true;
+        });
+        post(epoch, std::move(batch));
+    });
+}
+
+/********************************************************************
+*                               clear                        public *
+********************************************************************/
+void FileIndex::clear() {
+    ++_epoch;
+    _root.clear();
+    _dirs.clear();
+    _names.clear();
+    _dirMasks.clear();
+    _entries.clear();
+    _free.clear();
+    _byDir.clear();
+    _survivors.clear();
+    _lastPattern.clear();
+    ++_generation;
+}
+
+/********************************************************************
+*                               update                       public *
+*-------------------------------------------------------------------*
+* Reads again only directories reported by the watcher. Indexed     *
+* subdirectories which are gone are dropped with all below them,    *
+* new ones are walked whole (their content may not be reported).    *
+********************************************************************/
+void FileIndex::update(const FileChanges& changes) {
+    if (_root.isEmpty()) {
+        return;
+    }
+    if (changes.overflow) {
+        reset(_root);
+        return;
+    }
+
+    QHash<QString, QSet<QString>> dirs;     // reported directory -> its indexed subdirectories
+    for (const auto& dir : changes.directories) {
+        if (const QString rel = ProjectWalker::relativePath(_root, dir); !rel.isNull()) {
+            dirs.insert(rel, {});
+        }
+    }
+    if (dirs.isEmpty()) {
+        return;
+    }
+    for (const auto& item : _byDir) {
+        const auto view = _dirs[item.first];
+        const QString indexed = QFile::decodeName(QByteArray(view.data(), int(view.size())));
+        for (auto it = dirs.begin(); it != dirs.end(); ++it) {
+            const QString& rel = it.key();
+            if (rel.isEmpty() ? !indexed.isEmpty() : indexed.startsWith(rel + '/')) {
+                it.value().insert(indexed.mid(rel.isEmpty() ? 0 : rel.size() + 1).section('/', 0, 0));
+            }
+        }
+    }
+
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, root = _root, dirs, epoch] {
+        QVector<DirFiles> batch;
+        auto join = [](const QString& rel, const QString& name) {
+            return rel.isEmpty() ? name : rel + '/' + name;
+        };
+        for (auto it = dirs.cbegin(); it != dirs.cend(); ++it) {
+            const QString& rel = it.key();
+            if (!QFileInfo(root + '/' + rel).isDir()) {
+                batch.append({rel, {}, true});
+                continue;
+            }
+            QVector<FileSystem::Entry> files;
+            QSet<QString> children;
+            for (auto& entry : ProjectWalker::entries(root, rel)) {
+                if (entry.dir) {
+                    children.insert(QFile::decodeName(entry.name));
+                } else {
+                    files.append(std::move(entry));
+                }
+            }
+            batch.append({rel, files});
+
+            for (const auto& child : it.value()) {
+                if (!children.contains(child)) {
+                    batch.append({join(rel, child), {}, true});
+                }
+            }
+            for (const auto& child : children) {
+                if (it.value().contains(child)) {
+                    continue;
+                }
+                ProjectWalker::walk(root, [&](const QString& relDir, const QVector<FileSystem::Entry>& files) {
+                    if (epoch != _epoch) {
+                        return false;
+                    }
+                    batch.append({relDir, files});
+                    if (batch.size() >= BatchSize) {
+                        post(epoch, std::move(batch));
+                        batch.clear();
+                    }
+                    return true;
+                }, join(rel, child));
+            }
+        }
+        post(epoch, std::move(batch));
+    });
+}
+
+/********************************************************************
+*                               match                        public *
+*-------------------------------------------------------------------*
+* Returns 'limit' best matches of the query. Entries are split into *
+* chunks scored in parallel. When the query extends the previous    *
+* one (the user typed another character), only the previous matches *
+* are scored.                                                       *
+********************************************************************/
+QVector<FileIndex::Match> FileIndex::match(const QString& query, const int limit) {
+    std::string pattern;
+    for (const char c : query.toUtf8()) {
+        if (c != ' ') {
+            pattern += Fuzzy::lower(c);
+        }
+    }
+    if (pattern.empty()) {
+        _lastPattern.clear();
+        return {};
+    }
+
+    const uint64_t qmask = Fuzzy::mask(pattern);
+    const bool narrow = !_lastPattern.empty()
+                        && _lastGeneration == _generation
+                        && pattern.compare(0, _lastPattern.size(), _lastPattern) == 0;
+    const size_t total = narrow ? _survivors.size() : _entries.size();
+
+    struct Chunk {
+        size_t begin;
+        size_t end;
+        std::vector<std::pair<int, uint32_t>> hits;
+    };
+    const size_t count = std::max<size_t>(1, std::min<size_t>(total / MinChunk, size_t(QThread::idealThreadCount()) * 4));
+    std::vector<Chunk> chunks(count);
+    for (size_t i = 0; i < count; i++) {
+        chunks[i].begin = total * i / count;
+        chunks[i].end = total * (i + 1) / count;
+    }
+
+    auto score = [&](Chunk& chunk) {
+        std::string text;
+        for (size_t k = chunk.begin; k < chunk.end; k++) {
+            const uint32_t idx = narrow ? _survivors[k] : uint32_t(k);
+            const Entry& entry = _entries[idx];
+            if ((entry.mask & qmask) != qmask) {
+                continue;
+            }
+            const auto dir = _dirs[entry.dir];
+            text.assign(dir.data(), dir.size());
+            if (!dir.empty()) {
+                text += '/';
+            }
+            const size_t nameStart = text.size();
+            const auto name = _names[entry.name];
+            text.append(name.data(), name.size());
+            if (const int s = Fuzzy::score(pattern, text, nameStart); s != Fuzzy::NoMatch) {
+                chunk.hits.emplace_back(s, idx);
+            }
+        }
+    };
+    if (chunks.size() == 1) {
+        score(chunks[0]);
+    } else {
+        QtConcurrent::blockingMap(chunks, score);
+    }
+
+    std::vector<std::pair<int, uint32_t>> hits;
+    std::vector<uint32_t> survivors;
+    for (const auto& chunk : chunks) {
+        for (const auto& hit : chunk.hits) {
+            hits.push_back(hit);
+            survivors.push_back(hit.second);
+        }
+    }
+    _survivors.swap(survivors);
+    _lastPattern = pattern;
+    _lastGeneration = _generation;
+
+    const size_t n = std::min(hits.size(), size_t(limit));
+    std::partial_sort(hits.begin(), hits.begin() + long(n), hits.end(), [](const auto& a, const auto& b) {
+        return (a.first != b.first) ? a.first > b.first : a.second < b.second;
+    });
+
+    QVector<Match> result;
+    result.reserve(int(n));
+    for (size_t i = 0; i < n; i++) {
+        result.append({path(hits[i].second), hits[i].first});
+    }
+    return result;
+}
+
+/********************************************************************
+*                                post                       private *
+*-------------------------------------------------------------------*
+* Called from the worker, passes the batch to the GUI thread.       *
+********************************************************************/
+void FileIndex::post(const quint32 epoch, QVector<DirFiles> batch) {
+    if (batch.isEmpty()) {
+        return;
+    }
+    QMetaObject::invokeMethod(this, [this, epoch, batch] {
+        if (epoch == _epoch) {
+            for (const auto& dir : batch) {
+                if (dir.removed) {
+                    removeTree(dir.relDir);
+                } else {
+                    setDir(dir.relDir, dir.files);
+                }
+            }
+        }
+    }, Qt::QueuedConnection);
+}
+
+/********************************************************************
+*                               setDir                      private *
+*-------------------------------------------------------------------*
+* Sets the current list of files of the directory. Entries of       *
+* removed files are only marked dead and reused later.              *
+********************************************************************/
+void FileIndex::setDir(const QString& relDir, const QVector<FileSystem::Entry>& files) {
+    const QByteArray dirName = QFile::encodeName(relDir);
+    const uint32_t dir = _dirs.intern({dirName.constData(), size_t(dirName.size())});
+    if (dir >= _dirMasks.size()) {
+        // the path joins the directory and the name with '/'
+        const uint64_t slash = dirName.isEmpty() ? 0 : Fuzzy::bit('/');
+        _dirMasks.push_back(Fuzzy::mask({dirName.constData(), size_t(dirName.size())}) | slash);
+    }
+
+    std::unordered_set<uint32_t> wanted;
+    for (const auto& file : files) {
+        wanted.insert(_names.intern({file.name.constData(), size_t(file.name.size())}));
+    }
+
+    auto& list = _byDir[dir];
+    list.erase(std::remove_if(list.begin(), list.end(), [&](const uint32_t idx) {
+        if (wanted.erase(_entries[idx].name)) {
+            return false;
+        }
+        _entries[idx] = {0, 0, 0};
+        _free.push_back(idx);
+        return true;
+    }), list.end());
+
+    for (const uint32_t name : wanted) {
+        const Entry entry{dir, name, _dirMasks[dir] | Fuzzy::mask(_names[name])};
+        if (!_free.empty()) {
+            list.push_back(_free.back());
+            _entries[_free.back()] = entry;
+            _free.pop_back();
+        } else {
+            list.push_back(uint32_t(_entries.size()));
+            _entries.push_back(entry);
+        }
+    }
+    if (list.empty()) {
+        _byDir.erase(dir);
+    }
+    ++_generation;
+}
+
+/********************************************************************
+*                             removeTree                    private *
+*-------------------------------------------------------------------*
+* The directory was removed or moved away: entries of it and of all *
+* directories below it are marked dead.                             *
+********************************************************************/
+void FileIndex::removeTree(const QString& relDir) {
+    const QByteArray top = QFile::encodeName(relDir);
+    const std::string_view prefix(top.constData(), size_t(top.size()));
+    for (auto it = _byDir.begin(); it != _byDir.end();) {
+        const auto dir = _dirs[it->first];
+        const bool below = prefix.empty()
+                           || dir == prefix
+                           || (dir.size() > prefix.size() && dir[prefix.size()] == '/' && dir.compare(0, prefix.size(), prefix) == 0);
+        if (!below) {
+            ++it;
+            continue;
+        }
+        for (const uint32_t idx : it->second) {
+            _entries[idx] = {0, 0, 0};
+            _free.push_back(idx);
+        }
+        it = _byDir.erase(it);
+    }
+    ++_generation;
+}
+
+/********************************************************************
+*                                path                       private *
+********************************************************************/
+QString FileIndex::path(const uint32_t idx) const {
+    const Entry& entry = _entries[idx];
+    const auto dir = _dirs[entry.dir];
+    const auto name = _names[entry.name];
+    QByteArray path;
+    path.reserve(int(dir.size() + name.size() + 1));
+    if (!dir.empty()) {
+        path.append(dir.data(), int(dir.size())).append('/');
+    }
+    path.append(name.data(), int(name.size()));
+    return QFile::decodeName(path);
+}
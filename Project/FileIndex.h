@@ -0,0 +1,107 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FileIndex.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FILE_INDEX_H
+#define GOEDIT_FILE_INDEX_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QVector>
+#include <QThreadPool>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "Shared/StringPool.h"
+#include "Project/FileSystem.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+struct FileChanges;
+
+/********************************************************************
+*                             FileIndex                             *
+*-------------------------------------------------------------------*
+* All file paths of the project for the fuzzy "quick open".         *
+* A path is a pair of interned components (directory, name) plus    *
+* the character mask of the whole path for fast rejection.          *
+* The index is filled in background and then kept up to date with   *
+* directory changes reported by the watcher.                        *
+* Not thread safe: updates and queries happen in the GUI thread,    *
+* the query only borrows other threads for scoring.                 *
+********************************************************************/
+class FileIndex : public QObject {
+    Q_OBJECT
+
+    struct Entry {
+        uint32_t dir;
+        uint32_t name;
+        uint64_t mask;      // 0 for removed entry
+    };
+    struct DirFiles {
+        QString relDir;
+        QVector<FileSystem::Entry> files;
+        bool removed = false;   // the whole subtree is gone
+    };
+public:
+    struct Match {
+        QString path;       // relative to the project root
+        int score;
+    };
+private:
+    QString _root;
+    StringPool _dirs;
+    StringPool _names;
+    std::vector<uint64_t> _dirMasks;
+    std::vector<Entry> _entries;
+    std::vector<uint32_t> _free;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> _byDir;
+    std::atomic<quint32> _epoch;
+    quint64 _generation;
+    // state of the last query (to narrow the next one)
+    std::string _lastPattern;
+    quint64 _lastGeneration;
+    std::vector<uint32_t> _survivors;
+    QThreadPool _pool;
+public:
+    explicit FileIndex(QObject* = nullptr);
+    ~FileIndex() override;
+
+    void reset(const QString&);
+    void clear();
+    void update(const FileChanges&);
+    QVector<Match> match(const QString&, const int);
+    size_t size() const {
+        return _entries.size() - _free.size();
+    }
+
+private:
+    void post(const quint32, QVector<DirFiles>);
+    void setDir(const QString&, const QVector<FileSystem::Entry>&);
+    void removeTree(const QString&);
+    QString path(const uint32_t) const;
+};
+
+#endif // GOEDIT_FILE_INDEX_H
@@ -0,0 +1,71 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FileSystem.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include "FileSystem.h"
+
+/********************************************************************
+*                              entries                public static *
+*-------------------------------------------------------------------*
+* Lists directory. Type of entry is taken from d_type, stat is      *
+* called only for symbolic links and file systems without d_type.   *
+********************************************************************/
+QVector<FileSystem::Entry> FileSystem::entries(const QByteArray& path) {
+    QVector<Entry> result;
+
+    if (DIR* const dir = opendir(path.constData()); dir) {
+        while (const dirent* const entry = readdir(dir)) {
+            const char* const name = entry->d_name;
+            if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+                continue;
+            }
+            bool isDir = (entry->d_type == DT_DIR);
+            if (entry->d_type == DT_LNK || entry->d_type == DT_UNKNOWN) {
+                struct stat st;
+                const QByteArray fpath = path + '/' + name;
+                isDir = (stat(fpath.constData(), &st) == 0) && S_ISDIR(st.st_mode);
+            }
+            result.append({QByteArray(name), isDir});
+        }
+        closedir(dir);
+    }
+    return result;
+}
+
+/********************************************************************
+*                                id                   public static *
+********************************************************************/
+bool FileSystem::id(const QByteArray& path, Id& id) {
+    struct stat st;
+    if (stat(path.constData(), &st) != 0) {
+        return false;
+    }
+    id = {quint64(st.st_dev), quint64(st.st_ino)};
+    return true;
+}
@@ -0,0 +1,69 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FileSystem.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FILE_SYSTEM_H
+#define GOEDIT_FILE_SYSTEM_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QByteArray>
+#include <QVector>
+#include <QHash>
+
+/********************************************************************
+*                            FileSystem                             *
+*-------------------------------------------------------------------*
+* Thin wrappers around POSIX calls. Paths are in the local 8-bit    *
+* encoding (QFile::encodeName), no QFileInfo/stat per entry.        *
+********************************************************************/
+class FileSystem {
+public:
+    struct Entry {
+        QByteArray name;
+        bool dir;
+    };
+    // Identity of a file (symbolic links followed).
+    struct Id {
+        quint64 device;
+        quint64 inode;
+
+        bool operator==(const Id& other) const {
+            return device == other.device && inode == other.inode;
+        }
+    };
+
+    FileSystem() = delete;
+    ~FileSystem() = delete;
+    FileSystem(const FileSystem&) = delete;
+    FileSystem(const FileSystem&&) = delete;
+
+    static QVector<Entry> entries(const QByteArray&);
+    static bool id(const QByteArray&, Id&);
+};
+
+inline uint qHash(const FileSystem::Id& id, const uint seed = 0) {
+    return ::qHash(id.inode ^ (id.device << 32), seed);
+}
+
+#endif // GOEDIT_FILE_SYSTEM_H
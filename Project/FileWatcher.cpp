@@ -0,0 +1,321 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FileWatcher.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <QSocketNotifier>
+#include <QTimer>
+#include <QFile>
+#include <QDebug>
+#include <vector>
+#include "FileWatcher.h"
+#include "FileSystem.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr uint32_t WatchMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE
+                                    | IN_MOVED_FROM | IN_MOVED_TO
+                                    | IN_DELETE_SELF | IN_MOVE_SELF
+                                    | IN_ONLYDIR | IN_DONT_FOLLOW;
+
+//*******************************************************************
+//                           FileWatcher                        CTOR
+//*******************************************************************
+FileWatcher::FileWatcher(QObject* parent)
+    : QObject(parent)
+    , _fd(-1)
+    , _notifier(nullptr)
+    , _timer(new QTimer(this))
+    , _overflow(false)
+    , _limitReached(false)
+{
+    qRegisterMetaType<FileChanges>();
+    _timer->setSingleShot(true);
+    connect(_timer, &QTimer::timeout, this, &FileWatcher::flush);
+}
+
+/********************************************************************
+*                           ~FileWatcher                       dtor *
+********************************************************************/
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Must be called in the thread of the watcher. The initial walk     *
+* over the tree is done here too, events arriving meanwhile wait    *
+* in the inotify queue.                                             *
+********************************************************************/
+void FileWatcher::start(const QString& root) {
+    stop();
+
+    _fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_fd < 0) {
+        qWarning() << "FileWatcher: inotify_init1 failed:" << strerror(errno);
+        return;
+    }
+    _root = QFile::encodeName(root);
+    _notifier = new QSocketNotifier(_fd, QSocketNotifier::Read, this);
+    // QSocketNotifier::activated is overloaded since Qt 5.15
+    connect(_notifier, SIGNAL(activated(int)), this, SLOT(readEvents()));
+
+    addTree(_root, nullptr, false);
+}
+
+/********************************************************************
+*                               stop                         public *
+********************************************************************/
+void FileWatcher::stop() {
+    _timer->stop();
+    delete _notifier;
+    _notifier = nullptr;
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+    _root.clear();
+    _paths.clear();
+    _watches.clear();
+    _rules.clear();
+    _dirs.clear();
+    _files.clear();
+    _pendingSince.invalidate();
+    _overflow = false;
+    _limitReached = false;
+}
+
+/********************************************************************
+*                             readEvents                    private *
+*-------------------------------------------------------------------*
+* Drains the inotify queue completely. Nothing is emitted here,     *
+* events only land in the pending sets.                             *
+********************************************************************/
+void FileWatcher::readEvents() {
+    alignas(inotify_event) char buffer[64 * 1024];
+
+    for (;;) {
+        const ssize_t n = read(_fd, buffer, sizeof(buffer));
+        if (n <= 0) {
+            break;
+        }
+        for (const char* ptr = buffer; ptr < buffer + n; ) {
+            const auto event = reinterpret_cast<const inotify_event*>(ptr);
+            handle(event);
+            ptr += sizeof(inotify_event) + event->len;
+        }
+    }
+    schedule();
+}
+
+/********************************************************************
+*                               handle                      private *
+********************************************************************/
+void FileWatcher::handle(const inotify_event* event) {
+    if (event->mask & IN_Q_OVERFLOW) {
+        _overflow = true;
+        return;
+    }
+    const auto it = _paths.find(event->wd);
+    if (it == _paths.end()) {
+        return;
+    }
+    const QByteArray dir = it.value();
+
+    if (event->mask & IN_IGNORED) {
+        _watches.remove(dir);
+        _rules.remove(event->wd);
+        _paths.erase(it);
+        return;
+    }
+    if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+        if (event->mask & IN_MOVE_SELF) {
+            inotify_rm_watch(_fd, event->wd);
+        }
+        return;
+    }
+    if (event->len == 0) {
+        return;
+    }
+
+    const QByteArray path = dir + '/' + event->name;
+    const bool isDir = event->mask & IN_ISDIR;
+    if (isDir && (qstrcmp(event->name, ".git") == 0 || qstrcmp(event->name, ".goedit") == 0)) {
+        return;
+    }
+    const IgnoreRules::Ptr rules = _rules.value(event->wd);
+    if (rules && rules->isIgnored(relativePath(path), isDir)) {
+        return;
+    }
+
+    if (event->mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO)) {
+        _dirs.insert(QFile::decodeName(dir));
+    }
+    if (isDir) {
+        if (event->mask & IN_MOVED_FROM) {
+            removeTree(path);
+        }
+        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+            addTree(path, rules, true);
+        }
+    } else {
+        _files.insert(QFile::decodeName(path));
+    }
+}
+
+/********************************************************************
+*                              addTree                      private *
+*-------------------------------------------------------------------*
+* Adds watches for the directory and all its subdirectories.        *
+* When the tree appeared while we are running ('report' is true)    *
+* its content is reported too, because files could have been        *
+* created before the watch was in place.                            *
+********************************************************************/
+void FileWatcher::addTree(const QByteArray& top, const IgnoreRules::Ptr& inherited, const bool report) {
+    struct Item {
+        QByteArray path;
+        IgnoreRules::Ptr rules;
+    };
+    std::vector<Item> stack{{top, inherited}};
+
+    while (!stack.empty() && !_limitReached) {
+        Item item = std::move(stack.back());
+        stack.pop_back();
+
+        const QString relDir = relativePath(item.path);
+        const auto rules = IgnoreRules::load(QFile::decodeName(item.path), relDir, item.rules);
+        if (!addWatch(item.path, rules)) {
+            continue;
+        }
+        if (report) {
+            _dirs.insert(QFile::decodeName(item.path));
+        }
+
+        for (const auto& entry : FileSystem::entries(item.path)) {
+            if (entry.dir && (entry.name == ".git" || entry.name == ".goedit")) {
+                continue;
+            }
+            if (rules) {
+                const QString name = QFile::decodeName(entry.name);
+                if (rules->isIgnored(relDir.isEmpty() ? name : relDir + '/' + name, entry.dir)) {
+                    continue;
+                }
+            }
+            const QByteArray path = item.path + '/' + entry.name;
+            if (entry.dir) {
+                stack.push_back({path, rules});
+            } else if (report) {
+                _files.insert(QFile::decodeName(path));
+            }
+        }
+    }
+}
+
+/********************************************************************
+*                              addWatch                     private *
+********************************************************************/
+bool FileWatcher::addWatch(const QByteArray& path, const IgnoreRules::Ptr& rules) {
+    const int wd = inotify_add_watch(_fd, path.constData(), WatchMask);
+    if (wd < 0) {
+        if (errno == ENOSPC) {
+            qWarning() << "FileWatcher: inotify watch limit reached,"
+                       << "raise fs.inotify.max_user_watches";
+            _limitReached = true;
+        }
+        return false;
+    }
+    _paths.insert(wd, path);
+    _watches.insert(path, wd);
+    _rules.insert(wd, rules);
+    return true;
+}
+
+/********************************************************************
+*                             removeTree                    private *
+*-------------------------------------------------------------------*
+* A directory was moved away. Its subdirectories will not get any   *
+* 'self' event, so their watches are removed here by path prefix.   *
+********************************************************************/
+void FileWatcher::removeTree(const QByteArray& top) {
+    const QByteArray prefix = top + '/';
+    for (auto it = _watches.cbegin(); it != _watches.cend(); ++it) {
+        if (it.key() == top || it.key().startsWith(prefix)) {
+            inotify_rm_watch(_fd, it.value());
+        }
+    }
+}
+
+/********************************************************************
+*                            relativePath                   private *
+********************************************************************/
+QString FileWatcher::relativePath(const QByteArray& path) const {
+    if (path.size() <= _root.size()) {
+        return QString();
+    }
+    return QFile::decodeName(path.mid(_root.size() + 1));
+}
+
+/********************************************************************
+*                              schedule                     private *
+********************************************************************/
+void FileWatcher::schedule() {
+    if (_dirs.isEmpty() && _files.isEmpty() && !_overflow) {
+        return;
+    }
+    if (!_pendingSince.isValid()) {
+        _pendingSince.start();
+    }
+    const qint64 left = MaxDelayMs - _pendingSince.elapsed();
+    if (left <= 0) {
+        flush();
+        return;
+    }
+    _timer->start(int(qMin<qint64>(CoalesceMs, left)));
+}
+
+/********************************************************************
+*                               flush                       private *
+********************************************************************/
+void FileWatcher::flush() {
+    _timer->stop();
+    _pendingSince.invalidate();
+
+    FileChanges changes;
+    changes.directories = _dirs.values();
+    changes.files = _files.values();
+    changes.overflow = _overflow;
+    _dirs.clear();
+    _files.clear();
+    _overflow = false;
+
+    if (!changes.isEmpty()) {
+        emit changed(changes);
+    }
+}
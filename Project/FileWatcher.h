@@ -0,0 +1,105 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : FileWatcher.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FILE_WATCHER_H
+#define GOEDIT_FILE_WATCHER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QElapsedTimer>
+#include <QMetaType>
+#include "Project/IgnoreRules.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QSocketNotifier;
+class QTimer;
+struct inotify_event;
+
+/*------- types:
+-------------------------------------------------------------------*/
+struct FileChanges {
+    QStringList directories;    // directories with added/removed entries
+    QStringList files;          // created, written, removed or moved files
+    bool overflow = false;      // events were lost, everything must be checked
+
+    bool isEmpty() const {
+        return directories.isEmpty() && files.isEmpty() && !overflow;
+    }
+};
+Q_DECLARE_METATYPE(FileChanges)
+
+/********************************************************************
+*                            FileWatcher                            *
+*-------------------------------------------------------------------*
+* Watches the whole project tree with inotify. Lives in its own     *
+* thread. Events are collected into sets and emitted as one batch   *
+* when nothing happened for CoalesceMs, but not later than          *
+* MaxDelayMs after the first event of the batch.                    *
+********************************************************************/
+class FileWatcher : public QObject {
+    Q_OBJECT
+
+    static constexpr int CoalesceMs = 150;
+    static constexpr int MaxDelayMs = 1000;
+
+    int _fd;
+    QSocketNotifier* _notifier;
+    QTimer* const _timer;
+    QElapsedTimer _pendingSince;
+    QByteArray _root;
+    QHash<int, QByteArray> _paths;
+    QHash<QByteArray, int> _watches;
+    QHash<int, IgnoreRules::Ptr> _rules;
+    QSet<QString> _dirs;
+    QSet<QString> _files;
+    bool _overflow;
+    bool _limitReached;
+public:
+    explicit FileWatcher(QObject* = nullptr);
+    ~FileWatcher() override;
+
+    void start(const QString&);
+    void stop();
+
+signals:
+    void changed(const FileChanges&);
+
+private slots:
+    void readEvents();
+private:
+    void handle(const inotify_event*);
+    void addTree(const QByteArray&, const IgnoreRules::Ptr&, const bool);
+    bool addWatch(const QByteArray&, const IgnoreRules::Ptr&);
+    void removeTree(const QByteArray&);
+    QString relativePath(const QByteArray&) const;
+    void schedule();
+    void flush();
+};
+
+#endif // GOEDIT_FILE_WATCHER_H
@@ -0,0 +1,200 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : IgnoreRules.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QTextStream>
+#include "IgnoreRules.h"
+
+//*******************************************************************
+//                           IgnoreRules                        CTOR
+//*******************************************************************
+IgnoreRules::IgnoreRules(const QString& base, Ptr parent)
+    : _parent(std::move(parent))
+    , _base(base)
+{}
+
+/********************************************************************
+*                               load                  public static *
+*-------------------------------------------------------------------*
+* Reads .gitignore from the directory 'dir' (its path relative to   *
+* the project root is 'relDir'). When the directory has no rules,   *
+* the parent rules are returned unchanged.                          *
+********************************************************************/
+IgnoreRules::Ptr IgnoreRules::load(const QString& dir, const QString& relDir, const Ptr& parent) {
+    QFile file(dir + "/.gitignore");
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return parent;
+    }
+
+    auto rules = std::make_shared<IgnoreRules>(relDir, parent);
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        rules->addPattern(in.readLine());
+    }
+    if (rules->isEmpty()) {
+        return parent;
+    }
+    return rules;
+}
+
+/********************************************************************
+*                               chain                 public static *
+*-------------------------------------------------------------------*
+* Rules in effect inside the directory 'relDir' of the project      *
+* 'root': .gitignore files from the root down to the directory.     *
+********************************************************************/
+IgnoreRules::Ptr IgnoreRules::chain(const QString& root, const QString& relDir) {
+    Ptr rules = load(root, QString(), nullptr);
+    QString rel;
+    for (const auto& part : relDir.split('/', Qt::SkipEmptyParts)) {
+        rel = rel.isEmpty() ? part : rel + '/' + part;
+        rules = load(root + '/' + rel, rel, rules);
+    }
+    return rules;
+}
+
+/********************************************************************
+*                             isIgnored                      public *
+*-------------------------------------------------------------------*
+* 'path' is relative to the project root. Patterns are checked from *
+* the last one, as in git the last matching pattern decides.        *
+********************************************************************/
+bool IgnoreRules::isIgnored(const QString& path, const bool isDir) const {
+    for (auto rules = this; rules; rules = rules->_parent.get()) {
+        const QString& base = rules->_base;
+        if (!base.isEmpty() && !path.startsWith(base + '/')) {
+            continue;
+        }
+        const QString sub = base.isEmpty() ? path : path.mid(base.size() + 1);
+        for (auto it = rules->_patterns.rbegin(); it != rules->_patterns.rend(); ++it) {
+            if (it->dirOnly && !isDir) {
+                continue;
+            }
+            if (it->regex.match(sub).hasMatch()) {
+                return !it->negate;
+            }
+        }
+    }
+    return false;
+}
+
+/********************************************************************
+*                             addPattern                    private *
+********************************************************************/
+void IgnoreRules::addPattern(QString line) {
+    while (line.endsWith(' ') && !line.endsWith("\\ ")) {
+        line.chop(1);
+    }
+    if (line.isEmpty() || line.startsWith('#')) {
+        return;
+    }
+
+    bool negate = false;
+    if (line.startsWith('!')) {
+        negate = true;
+        line.remove(0, 1);
+    } else if (line.startsWith("\\!") || line.startsWith("\\#")) {
+        line.remove(0, 1);
+    }
+
+    bool dirOnly = false;
+    if (line.endsWith('/')) {
+        dirOnly = true;
+        line.chop(1);
+    }
+    if (line.isEmpty()) {
+        return;
+    }
+
+    // Pattern without a slash matches a name at any depth,
+    // otherwise it is anchored to the directory of .gitignore.
+    QString regex;
+    if (line.contains('/')) {
+        if (line.startsWith('/')) {
+            line.remove(0, 1);
+        }
+        regex = regexFromGlob(line);
+    } else {
+        regex = "(?:.*/)?" + regexFromGlob(line);
+    }
+
+    QRegularExpression re(QRegularExpression::anchoredPattern(regex));
+    if (re.isValid()) {
+        re.optimize();
+        _patterns.push_back({re, negate, dirOnly});
+    }
+}
+
+/********************************************************************
+*                           regexFromGlob            private static *
+********************************************************************/
+QString IgnoreRules::regexFromGlob(const QString& glob) {
+    QString regex;
+    const int n = glob.size();
+
+    for (int i = 0; i < n; i++) {
+        const QChar c = glob[i];
+        if (c == '*') {
+            if (i + 1 < n && glob[i + 1] == '*') {
+                const bool atStart = (i == 0) || glob[i - 1] == '/';
+                if (atStart && i + 2 < n && glob[i + 2] == '/') {
+                    regex += "(?:.*/)?";     // "**/"
+                    i += 2;
+                    continue;
+                }
+                if (atStart && i + 2 == n) {
+                    regex += ".*";           // "/**"
+                    i += 1;
+                    continue;
+                }
+                regex += "[^/]*";
+                i += 1;
+                continue;
+            }
+            regex += "[^/]*";
+        } else if (c == '?') {
+            regex += "[^/]";
+        } else if (c == '[') {
+            const int end = glob.indexOf(']', i + 1);
+            if (end < 0) {
+                regex += "\\[";
+                continue;
+            }
+            QString set = glob.mid(i + 1, end - i - 1);
+            if (set.startsWith('!')) {
+                set[0] = '^';
+            }
+            regex += '[' + set.replace("\\", "\\\\") + ']';
+            i = end;
+        } else if (c == '\\' && i + 1 < n) {
+            regex += QRegularExpression::escape(glob.mid(++i, 1));
+        } else {
+            regex += QRegularExpression::escape(QString(c));
+        }
+    }
+    return regex;
+}
@@ -0,0 +1,68 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : IgnoreRules.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_IGNORE_RULES_H
+#define GOEDIT_IGNORE_RULES_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <QRegularExpression>
+#include <memory>
+#include <vector>
+
+/********************************************************************
+*                           IgnoreRules                             *
+*-------------------------------------------------------------------*
+* Patterns of one .gitignore file. Rules of nested directories are  *
+* chained to the rules of their parent, the innermost file wins.    *
+* Instances are immutable, so they can be shared between threads.   *
+********************************************************************/
+class IgnoreRules {
+    struct Pattern {
+        QRegularExpression regex;
+        bool negate;
+        bool dirOnly;
+    };
+
+    const std::shared_ptr<const IgnoreRules> _parent;
+    const QString _base;
+    std::vector<Pattern> _patterns;
+public:
+    using Ptr = std::shared_ptr<const IgnoreRules>;
+
+    IgnoreRules(const QString&, Ptr);
+
+    static Ptr load(const QString&, const QString&, const Ptr&);
+    static Ptr chain(const QString&, const QString&);
+    bool isIgnored(const QString&, const bool) const;
+    bool isEmpty() const {
+        return _patterns.empty();
+    }
+private:
+    void addPattern(QString);
+    static QString regexFromGlob(const QString&);
+};
+
+#endif // GOEDIT_IGNORE_RULES_H
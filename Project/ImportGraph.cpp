@@ -0,0 +1,432 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ImportGraph.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QTextStream>
+#include <QtConcurrent>
+#include <algorithm>
+#include <functional>
+#include "ImportGraph.h"
+#include "FileWatcher.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- namespaces:
+-------------------------------------------------------------------*/
+using namespace beesoft::sqlite;
+
+/*------- local types:
+-------------------------------------------------------------------*/
+namespace {
+    using Edges = std::vector<std::pair<int, int>>;
+}
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+
+static QString parentDir(const QString& path) {
+    const int slash = path.lastIndexOf('/');
+    return (slash < 0) ? QString() : path.left(slash);
+}
+
+// Packages of the standard library have no dot in the first element.
+static bool isStandard(const QString& path) {
+    const int slash = path.indexOf('/');
+    return !(slash < 0 ? path : path.left(slash)).contains('.');
+}
+
+// Module path and required modules of a go.mod file ('replace' and
+// 'exclude' directives don't change what is imported, so are skipped).
+static bool readModule(const QString& fpath, QString& module, QVector<ImportGraph::Module>& required) {
+    QFile file(fpath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    bool inRequire = false;
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        QString line = in.readLine();
+        const int comment = line.indexOf("//");
+        const bool indirect = comment >= 0 && line.mid(comment + 2).trimmed() == "indirect";
+        if (comment >= 0) {
+            line.truncate(comment);
+        }
+        QStringList words = line.simplified().split(' ', Qt::SkipEmptyParts);
+        if (words.isEmpty()) {
+            continue;
+        }
+        if (inRequire) {
+            if (words[0] == ")") {
+                inRequire = false;
+                continue;
+            }
+        } else if (words[0] == "module" && words.size() > 1) {
+            module = words[1].remove('"');
+            continue;
+        } else if (words[0] == "require") {
+            if (words.size() > 1 && words[1] == "(") {
+                inRequire = true;
+                continue;
+            }
+            words.removeFirst();
+        } else {
+            continue;
+        }
+        if (words.size() > 1) {
+            required.append({words[0].remove('"'), words[1], QString(), indirect});
+        }
+    }
+    return !module.isEmpty();
+}
+
+// Sorted (from, to) pairs as offsets (one per package + 1) and targets.
+static void toArrays(Edges& edges, const int count, std::vector<int>& offsets, std::vector<int>& targets) {
+    std::sort(edges.begin(), edges.end());
+    offsets.assign(size_t(count) + 1, 0);
+    targets.clear();
+    targets.reserve(edges.size());
+    for (const auto& [from, to] : edges) {
+        offsets[size_t(from) + 1]++;
+        targets.push_back(to);
+    }
+    for (size_t i = 1; i < offsets.size(); i++) {
+        offsets[i] += offsets[i - 1];
+    }
+}
+
+static QVector<int> neighbours(const std::vector<int>& offsets, const std::vector<int>& targets, const int id) {
+    if (id < 0 || size_t(id) + 1 >= offsets.size()) {
+        return {};
+    }
+    QVector<int> result;
+    result.reserve(offsets[size_t(id) + 1] - offsets[size_t(id)]);
+    for (int i = offsets[size_t(id)]; i < offsets[size_t(id) + 1]; i++) {
+        result.append(targets[size_t(i)]);
+    }
+    return result;
+}
+
+//*******************************************************************
+//                            ImportGraph                       CTOR
+//*******************************************************************
+ImportGraph::ImportGraph(QObject* parent)
+    : QObject(parent)
+    , _graph(std::make_shared<Graph>())
+    , _epoch(0)
+{
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                           ~ImportGraph                       dtor *
+********************************************************************/
+ImportGraph::~ImportGraph() {
+    clear();
+}
+
+/********************************************************************
+*                               reset                        public *
+*-------------------------------------------------------------------*
+* The graph is built when the symbol index reports its first pass.  *
+********************************************************************/
+void ImportGraph::reset(const QString& root) {
+    clear();
+    _root = root;
+}
+
+/********************************************************************
+*                               clear                        public *
+*-------------------------------------------------------------------*
+* Waits for the build in progress, the database may be closed then. *
+********************************************************************/
+void ImportGraph::clear() {
+    ++_epoch;
+    _root.clear();
+    _pool.clear();
+    _pool.waitForDone();
+    _graph = std::make_shared<Graph>();
+}
+
+/********************************************************************
+*                              rebuild                       public *
+*-------------------------------------------------------------------*
+* Builds the graph again from imports stored in the database. A     *
+* request waiting in the queue is replaced by the newer one.        *
+********************************************************************/
+void ImportGraph::rebuild() {
+    if (_root.isEmpty()) {
+        return;
+    }
+    const quint32 epoch = ++_epoch;
+    _pool.clear();
+    QtConcurrent::run(&_pool, [this, root = _root, epoch] {
+        if (epoch != _epoch) {
+            return;
+        }
+        auto graph = build(root);
+        QMetaObject::invokeMethod(this, [this, graph = std::move(graph), epoch] {
+            if (epoch == _epoch) {
+                _graph = graph;
+                emit updated();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               update                       public *
+*-------------------------------------------------------------------*
+* Changes of .go files come through the symbol index, here only     *
+* go.mod files matter.                                              *
+********************************************************************/
+void ImportGraph::update(const FileChanges& changes) {
+    const bool modules = changes.overflow || std::any_of(changes.files.cbegin(), changes.files.cend(), [](const QString& file) {
+        return file.endsWith("/go.mod");
+    });
+    if (modules) {
+        rebuild();
+    }
+}
+
+/********************************************************************
+*                               find                         public *
+*-------------------------------------------------------------------*
+* Id of the package with the import path or -1.                     *
+********************************************************************/
+int ImportGraph::find(const QString& path) const {
+    return _graph->ids.value(path, -1);
+}
+
+/********************************************************************
+*                              imports                       public *
+********************************************************************/
+QVector<int> ImportGraph::imports(const int id) const {
+    return neighbours(_graph->forwardOffsets, _graph->forwardTargets, id);
+}
+
+/********************************************************************
+*                             importedBy                     public *
+********************************************************************/
+QVector<int> ImportGraph::importedBy(const int id) const {
+    return neighbours(_graph->reverseOffsets, _graph->reverseTargets, id);
+}
+
+/********************************************************************
+*                             dependents                     public *
+*-------------------------------------------------------------------*
+* All packages importing the package, directly or not (what must be *
+* built again when it changes).                                     *
+********************************************************************/
+QVector<int> ImportGraph::dependents(const int id) const {
+    return dependents(QVector<int>{id});
+}
+
+QVector<int> ImportGraph::dependents(const QVector<int>& ids) const {
+    const auto& offsets = _graph->reverseOffsets;
+    const auto& targets = _graph->reverseTargets;
+    std::vector<char> seen(size_t(_graph->packages.size()), 0);
+    std::vector<int> queue;
+    for (const int id : ids) {
+        if (id >= 0 && id < _graph->packages.size() && !seen[size_t(id)]) {
+            seen[size_t(id)] = 1;
+            queue.push_back(id);
+        }
+    }
+
+    QVector<int> result;
+    for (size_t head = 0; head < queue.size(); head++) {
+        const auto id = size_t(queue[head]);
+        for (int i = offsets[id]; i < offsets[id + 1]; i++) {
+            const int next = targets[size_t(i)];
+            if (!seen[size_t(next)]) {
+                seen[size_t(next)] = 1;
+                queue.push_back(next);
+                result.append(next);
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/********************************************************************
+*                            shortestPath                    public *
+*-------------------------------------------------------------------*
+* Chain of imports leading from the package 'from' to the package   *
+* 'to' (both included), empty when 'from' does not depend on 'to'.  *
+********************************************************************/
+QVector<int> ImportGraph::shortestPath(const int from, const int to) const {
+    const int count = _graph->packages.size();
+    if (from < 0 || to < 0 || from >= count || to >= count) {
+        return {};
+    }
+
+    const auto& offsets = _graph->forwardOffsets;
+    const auto& targets = _graph->forwardTargets;
+    std::vector<int> previous(size_t(count), -1);
+    std::vector<int> queue{from};
+    previous[size_t(from)] = from;
+    for (size_t head = 0; head < queue.size() && previous[size_t(to)] < 0; head++) {
+        const auto id = size_t(queue[head]);
+        for (int i = offsets[id]; i < offsets[id + 1]; i++) {
+            const int next = targets[size_t(i)];
+            if (previous[size_t(next)] < 0) {
+                previous[size_t(next)] = int(id);
+                queue.push_back(next);
+            }
+        }
+    }
+    if (previous[size_t(to)] < 0) {
+        return {};
+    }
+
+    QVector<int> path{to};
+    for (int id = to; id != from; id = previous[size_t(id)]) {
+        path.prepend(previous[size_t(id)]);
+    }
+    return path;
+}
+
+/********************************************************************
+*                               build                private static *
+*-------------------------------------------------------------------*
+* Runs in the pool thread. A local package is a directory with .go  *
+* files (tests are left out, their imports would only add noise and *
+* cycles); its import path is the path of the module of the nearest *
+* go.mod plus the directory relative to it. Imported packages which *
+* are not local are attributed to the required module with the      *
+* longest matching path.                                            *
+********************************************************************/
+std::shared_ptr<const ImportGraph::Graph> ImportGraph::build(const QString& root) {
+    auto graph = std::make_shared<Graph>();
+    auto& db = SQLite::shared();
+    if (!db.isOpen()) {
+        return graph;
+    }
+    const auto rows = db.select("SELECT f.path, f.package, i.path FROM files f"
+                                " LEFT JOIN imports i ON i.file = f.id"
+                                " ORDER BY f.path");
+
+    QVector<Module> required;
+    QHash<QString, int> moduleOfDir;
+    std::function<int(const QString&)> moduleOf = [&](const QString& dir) {
+        if (auto it = moduleOfDir.constFind(dir); it != moduleOfDir.cend()) {
+            return *it;
+        }
+        int index = -1;
+        QString path;
+        if (readModule(root + (dir.isEmpty() ? QString() : '/' + dir) + "/go.mod", path, required)) {
+            index = graph->modules.size();
+            graph->modules.append({path, QString(), dir, false});
+        } else if (!dir.isEmpty()) {
+            index = moduleOf(parentDir(dir));
+        }
+        moduleOfDir.insert(dir, index);
+        return index;
+    };
+
+    QHash<QString, int> dirs;
+    std::vector<std::pair<int, QString>> imports;
+    for (const auto& row : rows) {
+        const QString file = QString::fromStdString(row[0].as_text());
+        if (file.endsWith("_test.go")) {
+            continue;
+        }
+        const QString dir = parentDir(file);
+        int id = dirs.value(dir, -1);
+        if (id < 0) {
+            id = graph->packages.size();
+            dirs.insert(dir, id);
+            graph->packages.append({QString(), QString(), dir, file, Local, moduleOf(dir)});
+        }
+        auto& package = graph->packages[id];
+        if (package.name.isEmpty() && row[1].type() == Type::Text) {
+            package.name = QString::fromStdString(row[1].as_text());
+        }
+        if (row[2].type() == Type::Text) {
+            imports.emplace_back(id, QString::fromStdString(row[2].as_text()));
+        }
+    }
+
+    for (int id = 0; id < graph->packages.size(); id++) {
+        auto& package = graph->packages[id];
+        if (package.module < 0) {
+            package.path = package.dir.isEmpty() ? package.name : package.dir;
+        } else {
+            const auto& module = graph->modules[package.module];
+            const QString rel = (package.dir == module.dir) ? QString()
+                                : module.dir.isEmpty() ? package.dir
+                                : package.dir.mid(module.dir.size() + 1);
+            package.path = rel.isEmpty() ? module.path : module.path + '/' + rel;
+        }
+        graph->ids.insert(package.path, id);
+    }
+    graph->localCount = graph->packages.size();
+
+    for (const auto& module : required) {
+        const bool known = std::any_of(graph->modules.cbegin(), graph->modules.cend(), [&module](const Module& other) {
+            return other.path == module.path;
+        });
+        if (!known) {
+            graph->modules.append(module);
+        }
+    }
+
+    Edges edges;
+    edges.reserve(imports.size());
+    for (const auto& [from, path] : imports) {
+        int to = graph->ids.value(path, -1);
+        if (to < 0) {
+            int module = -1;
+            int length = -1;
+            for (int i = 0; i < graph->modules.size(); i++) {
+                const QString& prefix = graph->modules[i].path;
+                if (prefix.size() > length && (path == prefix || path.startsWith(prefix + '/'))) {
+                    module = i;
+                    length = prefix.size();
+                }
+            }
+            to = graph->packages.size();
+            graph->ids.insert(path, to);
+            graph->packages.append({path, QString(), QString(), QString(), isStandard(path) ? Standard : External, module});
+        }
+        if (to != from) {
+            edges.emplace_back(from, to);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    const int count = graph->packages.size();
+    toArrays(edges, count, graph->forwardOffsets, graph->forwardTargets);
+    for (auto& [from, to] : edges) {
+        std::swap(from, to);
+    }
+    toArrays(edges, count, graph->reverseOffsets, graph->reverseTargets);
+    return graph;
+}
@@ -0,0 +1,132 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ImportGraph.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_IMPORT_GRAPH_H
+#define GOEDIT_IMPORT_GRAPH_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <QHash>
+#include <QThreadPool>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+struct FileChanges;
+
+/********************************************************************
+*                            ImportGraph                            *
+*-------------------------------------------------------------------*
+* Packages of the project with their imports and the modules they   *
+* come from (go.mod files). Imports are parsed by the symbol index  *
+* together with declarations and cached in the project database     *
+* with the file hash, so the graph is only assembled here, in the   *
+* background, after every pass of the index. Edges are kept in flat *
+* offset/target arrays in both directions, the queries (reverse     *
+* dependencies, shortest import path) are plain walks over them.    *
+********************************************************************/
+class ImportGraph : public QObject {
+    Q_OBJECT
+public:
+    enum Kind {
+        Local,
+        Standard,
+        External
+    };
+
+    struct Package {
+        QString path;           // import path
+        QString name;           // package clause (local packages)
+        QString dir;            // relative to the project root (local packages)
+        QString file;           // first file of the package (local packages)
+        Kind kind;
+        int module;             // index in modules() or -1
+    };
+
+    struct Module {
+        QString path;
+        QString version;        // empty for modules of the project
+        QString dir;            // directory of go.mod (modules of the project)
+        bool indirect;
+    };
+private:
+    struct Graph {
+        QVector<Package> packages;      // local packages first
+        QVector<Module> modules;        // modules of the project first
+        QHash<QString, int> ids;
+        int localCount = 0;
+        std::vector<int> forwardOffsets;
+        std::vector<int> forwardTargets;
+        std::vector<int> reverseOffsets;
+        std::vector<int> reverseTargets;
+    };
+
+    QString _root;
+    std::shared_ptr<const Graph> _graph;
+    std::atomic<quint32> _epoch;
+    QThreadPool _pool;
+public:
+    explicit ImportGraph(QObject* = nullptr);
+    ~ImportGraph() override;
+
+    void reset(const QString&);
+    void clear();
+    void rebuild();
+    void update(const FileChanges&);
+
+    bool isEmpty() const {
+        return _graph->packages.isEmpty();
+    }
+    int packageCount() const {
+        return _graph->packages.size();
+    }
+    int localCount() const {
+        return _graph->localCount;
+    }
+    const Package& package(const int id) const {
+        return _graph->packages[id];
+    }
+    const QVector<Module>& modules() const {
+        return _graph->modules;
+    }
+    int find(const QString&) const;
+    QVector<int> imports(const int) const;
+    QVector<int> importedBy(const int) const;
+    QVector<int> dependents(const int) const;
+    QVector<int> dependents(const QVector<int>&) const;
+    QVector<int> shortestPath(const int, const int) const;
+
+private:
+    static std::shared_ptr<const Graph> build(const QString&);
+
+signals:
+    void updated();
+};
+
+#endif // GOEDIT_IMPORT_GRAPH_H
@@ -0,0 +1,175 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Project.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFileInfo>
+#include "Project.h"
+#include "ProjectModel.h"
+#include "FileIndex.h"
+#include "SymbolIndex.h"
+#include "ImportGraph.h"
+#include "TrigramIndex.h"
+#include "Session.h"
+#include "Lsp/LspClient.h"
+#include "Debugger/DlvClient.h"
+#include "Vcs/GitClient.h"
+#include "ProjectDatabase.h"
+#include "ProjectWalker.h"
+
+//*******************************************************************
+//                             Project                          CTOR
+//*******************************************************************
+Project::Project(QObject* parent)
+    : QObject(parent)
+    , _model(new ProjectModel(this))
+    , _fileIndex(new FileIndex(this))
+    , _symbolIndex(new SymbolIndex(this))
+    , _importGraph(new ImportGraph(this))
+    , _trigramIndex(new TrigramIndex(this))
+    , _session(new Session(this))
+    , _lspClient(new LspClient(this))
+    , _dlvClient(new DlvClient(this))
+    , _gitClient(new GitClient(this))
+    , _watcher(new FileWatcher)
+{
+    _watcher->moveToThread(&_watcherThread);
+    connect(&_watcherThread, &QThread::finished, _watcher, &QObject::deleteLater);
+    connect(_watcher, &FileWatcher::changed, this, &Project::filesystemChanged);
+    connect(_symbolIndex, &SymbolIndex::updated, _importGraph, &ImportGraph::rebuild);
+    _watcherThread.setObjectName("FileWatcher");
+    _watcherThread.start();
+}
+
+/********************************************************************
+*                             ~Project                         dtor *
+********************************************************************/
+Project::~Project() {
+    _symbolIndex->clear();
+    _importGraph->clear();
+    _trigramIndex->clear();
+    _session->wait();
+    _gitClient->cancel();
+    ProjectDatabase::close();
+    _watcherThread.quit();
+    _watcherThread.wait();
+}
+
+/********************************************************************
+*                               open                         public *
+*-------------------------------------------------------------------*
+* Only the top level of the project is read here (in background),   *
+* so opening does not depend on the size of the project.            *
+********************************************************************/
+bool Project::open(const QString& path) {
+    const QFileInfo info(path);
+    if (!info.isDir() || !info.isReadable()) {
+        return false;
+    }
+    if (isOpen()) {
+        close();
+    }
+
+    _root = info.absoluteFilePath();
+    _model->setRoot(_root);
+    _fileIndex->reset(_root);
+    if (ProjectDatabase::open(_root)) {
+        _symbolIndex->reset(_root);
+        _importGraph->reset(_root);
+    }
+    _trigramIndex->reset(_root);
+    _lspClient->start(_root);
+    _gitClient->start(_root);
+    QMetaObject::invokeMethod(_watcher, [watcher = _watcher, root = _root] {
+        watcher->start(root);
+    });
+    emit opened(_root);
+    return true;
+}
+
+/********************************************************************
+*                               close                        public *
+********************************************************************/
+void Project::close() {
+    if (isOpen()) {
+        // Last chance to save the session of the project.
+        emit aboutToClose();
+        _root.clear();
+        _model->clear();
+        _fileIndex->clear();
+        _symbolIndex->clear();
+        _importGraph->clear();
+        _trigramIndex->clear();
+        _lspClient->stop();
+        _dlvClient->stop();
+        _gitClient->stop();
+        _session->wait();
+        ProjectDatabase::close();
+        QMetaObject::invokeMethod(_watcher, [watcher = _watcher] {
+            watcher->stop();
+        });
+        emit closed();
+    }
+}
+
+/********************************************************************
+*                             fileSaved                      public *
+*-------------------------------------------------------------------*
+* Indexes see our own writes at once, without waiting for the       *
+* watcher (which will report them again, but the files will be      *
+* found unchanged then).                                            *
+********************************************************************/
+void Project::fileSaved(const QString& path) {
+    if (!isOpen() || ProjectWalker::relativePath(_root, path).isNull()) {
+        return;
+    }
+    FileChanges changes;
+    changes.files.append(path);
+    _symbolIndex->update(changes);
+    _trigramIndex->update(changes);
+    _lspClient->saveDocument(path);
+}
+
+/********************************************************************
+*                         filesystemChanged                 private *
+*-------------------------------------------------------------------*
+* Batch of changes from the watcher. Only directories already       *
+* loaded in the tree are listed again.                              *
+********************************************************************/
+void Project::filesystemChanged(const FileChanges& changes) {
+    if (!isOpen()) {
+        return;
+    }
+    if (changes.overflow) {
+        _model->refreshAll();
+    } else {
+        _model->refresh(changes.directories);
+    }
+    _fileIndex->update(changes);
+    _symbolIndex->update(changes);
+    _importGraph->update(changes);
+    _trigramIndex->update(changes);
+    emit filesChanged(changes);
+}
@@ -0,0 +1,120 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Project.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_PROJECT_H
+#define GOEDIT_PROJECT_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QString>
+#include <QThread>
+#include "Project/FileWatcher.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class ProjectModel;
+class FileIndex;
+class SymbolIndex;
+class ImportGraph;
+class TrigramIndex;
+class Session;
+class LspClient;
+class DlvClient;
+class GitClient;
+
+/********************************************************************
+*                              Project                              *
+*-------------------------------------------------------------------*
+* Currently opened project (a directory with Go sources) and the    *
+* services working on it. External changes of files are reported   *
+* by the watcher running in its own thread.                         *
+********************************************************************/
+class Project : public QObject {
+    Q_OBJECT
+
+    QString _root;
+    ProjectModel* const _model;
+    FileIndex* const _fileIndex;
+    SymbolIndex* const _symbolIndex;
+    ImportGraph* const _importGraph;
+    TrigramIndex* const _trigramIndex;
+    Session* const _session;
+    LspClient* const _lspClient;
+    DlvClient* const _dlvClient;
+    GitClient* const _gitClient;
+    FileWatcher* const _watcher;
+    QThread _watcherThread;
+public:
+    explicit Project(QObject* = nullptr);
+    ~Project() override;
+
+    bool open(const QString&);
+    void close();
+    bool isOpen() const {
+        return !_root.isEmpty();
+    }
+    QString root() const {
+        return _root;
+    }
+    ProjectModel* model() const {
+        return _model;
+    }
+    FileIndex* fileIndex() const {
+        return _fileIndex;
+    }
+    SymbolIndex* symbolIndex() const {
+        return _symbolIndex;
+    }
+    ImportGraph* importGraph() const {
+        return _importGraph;
+    }
+    TrigramIndex* trigramIndex() const {
+        return _trigramIndex;
+    }
+    Session* session() const {
+        return _session;
+    }
+    LspClient* lspClient() const {
+        return _lspClient;
+    }
+    DlvClient* dlvClient() const {
+        return _dlvClient;
+    }
+    GitClient* gitClient() const {
+        return _gitClient;
+    }
+    void fileSaved(const QString&);
+
+private:
+    void filesystemChanged(const FileChanges&);
+
+signals:
+    void opened(const QString&);
+    void aboutToClose();
+    void closed();
+    void filesChanged(const FileChanges&);
+};
+
+#endif // GOEDIT_PROJECT_H
@@ -0,0 +1,141 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectDatabase.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDir>
+#include <QFile>
+#include <QDebug>
+#include "ProjectDatabase.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+const char* const ProjectDatabase::Dir = ".goedit";
+
+static const char* const Schema = R"(
+CREATE TABLE files (
+    id      INTEGER PRIMARY KEY,
+    path    TEXT NOT NULL UNIQUE,
+    mtime   INTEGER NOT NULL,
+    size    INTEGER NOT NULL,
+    hash    INTEGER NOT NULL,
+    package TEXT
+);
+CREATE TABLE symbols (
+    id        INTEGER PRIMARY KEY,
+    file      INTEGER NOT NULL,
+    name      TEXT NOT NULL,
+    kind      INTEGER NOT NULL,
+    container TEXT,
+    line      INTEGER NOT NULL,
+    col       INTEGER NOT NULL
+);
+CREATE INDEX symbols_name ON symbols (name COLLATE NOCASE);
+CREATE INDEX symbols_file ON symbols (file);
+CREATE TABLE imports (
+    file INTEGER NOT NULL,
+    path TEXT NOT NULL
+);
+CREATE INDEX imports_file ON imports (file);
+CREATE TABLE session (
+    id   INTEGER PRIMARY KEY,
+    data BLOB NOT NULL
+);
+CREATE TABLE blame (
+    id       INTEGER PRIMARY KEY,
+    path     TEXT NOT NULL,
+    revision TEXT NOT NULL,
+    data     BLOB NOT NULL,
+    UNIQUE (path, revision)
+);
+)";
+
+using namespace beesoft::sqlite;
+
+/********************************************************************
+*                               open                  public static *
+*-------------------------------------------------------------------*
+* Opens the database of the project 'root', creating it if needed.  *
+********************************************************************/
+bool ProjectDatabase::open(const QString& root) {
+    if (!QDir(root).mkpath(Dir)) {
+        qWarning() << "ProjectDatabase: can't create" << root + '/' + Dir;
+        return false;
+    }
+
+    auto& db = SQLite::shared();
+    db.close();
+
+    const std::string fpath = QFile::encodeName(path(root)).toStdString();
+    if (db.open(fpath)) {
+        const auto rows = db.select("PRAGMA user_version");
+        if (!rows.empty() && rows[0][0].as_i64() == Version) {
+            db.exec("PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL");
+            return true;
+        }
+        db.close();
+    }
+    return create(fpath);
+}
+
+/********************************************************************
+*                               close                 public static *
+********************************************************************/
+void ProjectDatabase::close() {
+    SQLite::shared().close();
+}
+
+/********************************************************************
+*                               path                  public static *
+********************************************************************/
+QString ProjectDatabase::path(const QString& root) {
+    return root + '/' + Dir + "/project.db";
+}
+
+/********************************************************************
+*                              create                private static *
+*-------------------------------------------------------------------*
+* (Re)creates the database. Files of WAL journal of the old one are *
+* removed too, otherwise SQLite would apply them to the new file.   *
+********************************************************************/
+bool ProjectDatabase::create(const std::string& fpath) {
+    for (const char* suffix : {"-wal", "-shm"}) {
+        QFile::remove(QFile::decodeName(fpath + suffix));
+    }
+
+    auto& db = SQLite::shared();
+    const bool ok = db.create(fpath, [](SQLite& db) {
+        return db.exec(Schema)
+               && db.exec("PRAGMA user_version=" + std::to_string(Version))
+               && db.exec("PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL");
+    }, true);
+    if (!ok) {
+        qWarning() << "ProjectDatabase: can't create" << QFile::decodeName(fpath);
+        db.close();
+    }
+    return ok;
+}
@@ -0,0 +1,58 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectDatabase.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_PROJECT_DATABASE_H
+#define GOEDIT_PROJECT_DATABASE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <string>
+
+/********************************************************************
+*                          ProjectDatabase                          *
+*-------------------------------------------------------------------*
+* SQLite database of the project: <root>/.goedit/project.db.        *
+* It holds only data which can be computed again (indexes, caches)  *
+* or lost without harm (session), so a database of another version  *
+* is simply created anew.                                           *
+********************************************************************/
+class ProjectDatabase {
+public:
+    static constexpr int Version = 4;
+    static const char* const Dir;
+
+    ProjectDatabase() = delete;
+    ~ProjectDatabase() = delete;
+    ProjectDatabase(const ProjectDatabase&) = delete;
+    ProjectDatabase(const ProjectDatabase&&) = delete;
+
+    static bool open(const QString&);
+    static void close();
+    static QString path(const QString&);
+private:
+    static bool create(const std::string&);
+};
+
+#endif // GOEDIT_PROJECT_DATABASE_H
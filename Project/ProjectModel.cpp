@@ -0,0 +1,583 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectModel.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QFileInfo>
+#include <QFileIconProvider>
+#include <QtConcurrent>
+#include <algorithm>
+#include <cctype>
+#include "ProjectModel.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static const char* const VendorDir = "vendor";
+
+//*******************************************************************
+//                          ProjectModel                        CTOR
+//*******************************************************************
+ProjectModel::ProjectModel(QObject* parent)
+    : QAbstractItemModel(parent)
+    , _epoch(0)
+    , _tickets(0)
+    , _showVendor(false)
+    , _dirIcon(QFileIconProvider().icon(QFileIconProvider::Folder))
+    , _fileIcon(QFileIconProvider().icon(QFileIconProvider::File))
+{
+    _pool.setMaxThreadCount(2);
+}
+
+/********************************************************************
+*                          ~ProjectModel                       dtor *
+********************************************************************/
+ProjectModel::~ProjectModel() {
+    _pool.clear();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                              setRoot                       public *
+*-------------------------------------------------------------------*
+* Only the root node is created here. Listing of the root starts    *
+* immediately, everything deeper is loaded when the user expands.   *
+********************************************************************/
+void ProjectModel::setRoot(const QString& path) {
+    beginResetModel();
+    _names.clear();
+    _nodes.clear();
+    _dirs.clear();
+    _freeNodes.clear();
+    _freeDirs.clear();
+    ++_epoch;
+
+    _root = QFileInfo(path).absoluteFilePath();
+    _encodedRoot = QFile::encodeName(_root);
+    const QByteArray name = QFile::encodeName(QFileInfo(_root).fileName());
+    _dirs.push_back({{}, nullptr, 0});
+    _nodes.push_back({NoNode, _names.intern({name.constData(), size_t(name.size())}), 0, 0, Directory});
+    endResetModel();
+
+    requestListing(0);
+}
+
+/********************************************************************
+*                               clear                        public *
+********************************************************************/
+void ProjectModel::clear() {
+    beginResetModel();
+    _names.clear();
+    _nodes.clear();
+    _dirs.clear();
+    _freeNodes.clear();
+    _freeDirs.clear();
+    _root.clear();
+    _encodedRoot.clear();
+    ++_epoch;
+    endResetModel();
+}
+
+/********************************************************************
+*                           setShowVendor                    public *
+*-------------------------------------------------------------------*
+* Every loaded directory is listed again, vendor directories are    *
+* then added or removed by the ordinary merge.                      *
+********************************************************************/
+void ProjectModel::setShowVendor(const bool state) {
+    if (_showVendor == state) return;
+
+    _showVendor = state;
+    refreshAll();
+}
+
+/********************************************************************
+*                              refresh                       public *
+*-------------------------------------------------------------------*
+* Lists again given directories (absolute paths). Directories not   *
+* loaded yet are skipped, they will be read when expanded.          *
+********************************************************************/
+void ProjectModel::refresh(const QStringList& dirs) {
+    for (const QString& dir : dirs) {
+        if (const quint32 id = find(dir); id != NoNode) {
+            if ((_nodes[id].flags & Directory) && (_nodes[id].flags & (Loaded | Loading))) {
+                requestListing(id);
+            }
+        }
+    }
+}
+
+/********************************************************************
+*                             refreshAll                     public *
+********************************************************************/
+void ProjectModel::refreshAll() {
+    for (quint32 i = 0; i < _nodes.size(); i++) {
+        if ((_nodes[i].flags & Directory) && (_nodes[i].flags & (Loaded | Loading))) {
+            requestListing(i);
+        }
+    }
+}
+
+/********************************************************************
+*                              filePath                      public *
+********************************************************************/
+QString ProjectModel::filePath(const QModelIndex& index) const {
+    if (!index.isValid()) return QString();
+    return absolutePath(quint32(index.internalId()));
+}
+
+/********************************************************************
+*                                                                   *
+*                 Q A b s t r a c t I t e m M o d e l               *
+*                                                                   *
+********************************************************************/
+
+QModelIndex ProjectModel::index(int row, int column, const QModelIndex& parent) const {
+    if (column != 0 || row < 0 || _nodes.empty()) {
+        return QModelIndex();
+    }
+    if (!parent.isValid()) {
+        return (row == 0) ? createIndex(0, 0, quintptr(0)) : QModelIndex();
+    }
+    const Node& node = _nodes[parent.internalId()];
+    if (node.dir == NoNode) {
+        return QModelIndex();
+    }
+    const auto& children = _dirs[node.dir].children;
+    if (size_t(row) >= children.size()) {
+        return QModelIndex();
+    }
+    return createIndex(row, 0, quintptr(children[row]));
+}
+
+QModelIndex ProjectModel::parent(const QModelIndex& child) const {
+    if (!child.isValid() || child.internalId() == 0) {
+        return QModelIndex();
+    }
+    return indexOf(_nodes[child.internalId()].parent);
+}
+
+int ProjectModel::rowCount(const QModelIndex& parent) const {
+    if (!parent.isValid()) {
+        return _nodes.empty() ? 0 : 1;
+    }
+    if (parent.column() > 0) {
+        return 0;
+    }
+    const Node& node = _nodes[parent.internalId()];
+    return (node.dir == NoNode) ? 0 : int(_dirs[node.dir].children.size());
+}
+
+int ProjectModel::columnCount(const QModelIndex&) const {
+    return 1;
+}
+
+bool ProjectModel::hasChildren(const QModelIndex& parent) const {
+    if (!parent.isValid()) {
+        return !_nodes.empty();
+    }
+    const Node& node = _nodes[parent.internalId()];
+    if (node.dir == NoNode) {
+        return false;
+    }
+    return !(node.flags & Loaded) || !_dirs[node.dir].children.empty();
+}
+
+bool ProjectModel::canFetchMore(const QModelIndex& parent) const {
+    if (!parent.isValid()) {
+        return false;
+    }
+    const Node& node = _nodes[parent.internalId()];
+    return (node.flags & Directory) && !(node.flags & (Loaded | Loading));
+}
+
+void ProjectModel::fetchMore(const QModelIndex& parent) {
+    if (canFetchMore(parent)) {
+        requestListing(quint32(parent.internalId()));
+    }
+}
+
+QVariant ProjectModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid()) {
+        return QVariant();
+    }
+    const auto id = quint32(index.internalId());
+    switch (role) {
+    case Qt::DisplayRole:
+        return displayName(id);
+    case Qt::DecorationRole:
+        return (_nodes[id].flags & Directory) ? _dirIcon : _fileIcon;
+    case Qt::ToolTipRole:
+    case PathRole:
+        return absolutePath(id);
+    case IsDirRole:
+        return bool(_nodes[id].flags & Directory);
+    }
+    return QVariant();
+}
+
+Qt::ItemFlags ProjectModel::flags(const QModelIndex& index) const {
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+/********************************************************************
+*                                                                   *
+*                          H E L P E R S                            *
+*                                                                   *
+********************************************************************/
+
+QModelIndex ProjectModel::indexOf(const quint32 id) const {
+    if (id == NoNode) {
+        return QModelIndex();
+    }
+    return createIndex(int(_nodes[id].row), 0, quintptr(id));
+}
+
+/********************************************************************
+*                                find                       private *
+*-------------------------------------------------------------------*
+* Node of the absolute path. Names are compared as interned ids.    *
+********************************************************************/
+quint32 ProjectModel::find(const QString& path) const {
+    if (_nodes.empty() || !path.startsWith(_root)) {
+        return NoNode;
+    }
+    if (path.size() == _root.size()) {
+        return 0;
+    }
+    if (path[_root.size()] != '/') {
+        return NoNode;
+    }
+
+    quint32 id = 0;
+    const auto parts = path.midRef(_root.size() + 1).split('/', Qt::SkipEmptyParts);
+    for (const auto& part : parts) {
+        const QByteArray name = QFile::encodeName(part.toString());
+        const quint32 nameId = _names.find({name.constData(), size_t(name.size())});
+        if (nameId == StringPool::None || _nodes[id].dir == NoNode) {
+            return NoNode;
+        }
+        const auto& children = _dirs[_nodes[id].dir].children;
+        const auto it = std::find_if(children.begin(), children.end(), [this, nameId](const quint32 child) {
+            return _nodes[child].name == nameId;
+        });
+        if (it == children.end()) {
+            return NoNode;
+        }
+        id = *it;
+    }
+    return id;
+}
+
+QString ProjectModel::displayName(const quint32 id) const {
+    const auto name = _names[_nodes[id].name];
+    return QFile::decodeName(QByteArray::fromRawData(name.data(), int(name.size())));
+}
+
+QString ProjectModel::relativePath(quint32 id) const {
+    QStringList parts;
+    for (; id != 0 && id != NoNode; id = _nodes[id].parent) {
+        parts.prepend(displayName(id));
+    }
+    return parts.join('/');
+}
+
+QString ProjectModel::absolutePath(const quint32 id) const {
+    return (id == 0) ? _root : _root + '/' + relativePath(id);
+}
+
+/********************************************************************
+*                          requestListing                   private *
+*-------------------------------------------------------------------*
+* Starts listing of the directory in the model's thread pool.       *
+* Every request gets a ticket, result with an outdated ticket (the  *
+* node was released or listed again) is simply dropped.             *
+********************************************************************/
+void ProjectModel::requestListing(const quint32 id) {
+    if (_nodes[id].flags & Loading) {
+        _nodes[id].flags |= Reload;
+        return;
+    }
+    _nodes[id].flags |= Loading;
+
+    Dir& dir = _dirs[_nodes[id].dir];
+    dir.ticket = ++_tickets;
+
+    const quint32 parent = _nodes[id].parent;
+    const IgnoreRules::Ptr inherited = (parent == NoNode) ? nullptr : _dirs[_nodes[parent].dir].rules;
+    const QByteArray path = QFile::encodeName(absolutePath(id));
+    const QString relPath = relativePath(id);
+    const bool showVendor = _showVendor;
+    const Listing request{id, dir.ticket, _epoch, {}, nullptr};
+
+    QtConcurrent::run(&_pool, [this, request, path, relPath, inherited, showVendor] {
+        const Listing listing = list(request, path, relPath, inherited, showVendor);
+        QMetaObject::invokeMethod(this, [this, listing] {
+            apply(listing);
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                                list                private static *
+*-------------------------------------------------------------------*
+* Runs in a worker thread. Reads the directory, applies ignore      *
+* rules and sorts entries (directories first).                      *
+********************************************************************/
+ProjectModel::Listing ProjectModel::list(Listing listing,
+                                         const QByteArray& path,
+                                         const QString& relPath,
+                                         const IgnoreRules::Ptr& inherited,
+                                         const bool showVendor)
+{
+    listing.rules = IgnoreRules::load(QFile::decodeName(path), relPath, inherited);
+
+    const auto entries = FileSystem::entries(path);
+    listing.entries.reserve(entries.size());
+    for (const auto& entry : entries) {
+        if (isHidden(entry, showVendor)) {
+            continue;
+        }
+        if (listing.rules) {
+            const QString name = QFile::decodeName(entry.name);
+            if (listing.rules->isIgnored(relPath.isEmpty() ? name : relPath + '/' + name, entry.dir)) {
+                continue;
+            }
+        }
+        listing.entries.append(entry);
+    }
+
+    std::sort(listing.entries.begin(), listing.entries.end(),
+              [](const FileSystem::Entry& a, const FileSystem::Entry& b) {
+        return compare(a.dir, {a.name.constData(), size_t(a.name.size())},
+                       b.dir, {b.name.constData(), size_t(b.name.size())}) < 0;
+    });
+    return listing;
+}
+
+/********************************************************************
+*                               apply                       private *
+********************************************************************/
+void ProjectModel::apply(const Listing& listing) {
+    if (listing.epoch != _epoch || listing.node >= _nodes.size()) {
+        return;
+    }
+    const Node& node = _nodes[listing.node];
+    if (node.dir == NoNode || _dirs[node.dir].ticket != listing.ticket) {
+        return;
+    }
+    _dirs[node.dir].rules = listing.rules;
+    merge(listing.node, listing.entries);
+
+    quint8& flags = _nodes[listing.node].flags;
+    flags = (flags & ~Loading) | Loaded;
+    if (flags & Reload) {
+        flags &= ~Reload;
+        requestListing(listing.node);
+    }
+}
+
+/********************************************************************
+*                               merge                       private *
+*-------------------------------------------------------------------*
+* Children and entries are sorted the same way, so one pass finds   *
+* what disappeared and what is new. Changes are reported to views   *
+* as contiguous row ranges.                                         *
+********************************************************************/
+void ProjectModel::merge(const quint32 id, const QVector<FileSystem::Entry>& entries) {
+    const QModelIndex parentIndex = indexOf(id);
+    const quint32 dir = _nodes[id].dir;
+
+    // removed rows
+    {
+        auto& children = _dirs[dir].children;
+        std::vector<bool> keep(children.size(), false);
+        for (size_t i = 0, j = 0; i < children.size() && j < size_t(entries.size()); ) {
+            const int cmp = compare(children[i], entries[int(j)]);
+            if (cmp == 0) {
+                keep[i++] = true;
+                ++j;
+            } else if (cmp < 0) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        for (int last = int(children.size()) - 1; last >= 0; ) {
+            if (keep[size_t(last)]) {
+                --last;
+                continue;
+            }
+            int first = last;
+            while (first > 0 && !keep[size_t(first - 1)]) {
+                --first;
+            }
+            beginRemoveRows(parentIndex, first, last);
+            for (int i = first; i <= last; i++) {
+                release(children[size_t(i)]);
+            }
+            children.erase(children.begin() + first, children.begin() + last + 1);
+            renumber(dir, size_t(first));
+            endRemoveRows();
+            last = first - 1;
+        }
+    }
+
+    // inserted rows
+    size_t k = 0;
+    for (int j = 0; j < entries.size(); ) {
+        if (k < _dirs[dir].children.size() && compare(_dirs[dir].children[k], entries[j]) == 0) {
+            ++k;
+            ++j;
+            continue;
+        }
+        int end = j;
+        while (end < entries.size()
+               && (k >= _dirs[dir].children.size() || compare(_dirs[dir].children[k], entries[end]) > 0))
+        {
+            ++end;
+        }
+
+        beginInsertRows(parentIndex, int(k), int(k) + (end - j) - 1);
+        std::vector<quint32> created;
+        created.reserve(size_t(end - j));
+        for (int i = j; i < end; i++) {
+            created.push_back(allocate(id, entries[i]));
+        }
+        auto& children = _dirs[dir].children;
+        children.insert(children.begin() + long(k), created.begin(), created.end());
+        renumber(dir, k);
+        endInsertRows();
+
+        k += created.size();
+        j = end;
+    }
+}
+
+/********************************************************************
+*                              allocate                     private *
+********************************************************************/
+quint32 ProjectModel::allocate(const quint32 parent, const FileSystem::Entry& entry) {
+    quint32 dir = NoNode;
+    if (entry.dir) {
+        if (!_freeDirs.empty()) {
+            dir = _freeDirs.back();
+            _freeDirs.pop_back();
+        } else {
+            dir = quint32(_dirs.size());
+            _dirs.push_back({{}, nullptr, 0});
+        }
+    }
+
+    const Node node{parent,
+                    _names.intern({entry.name.constData(), size_t(entry.name.size())}),
+                    0,
+                    dir,
+                    quint8(entry.dir ? Directory : 0)};
+    if (!_freeNodes.empty()) {
+        const quint32 id = _freeNodes.back();
+        _freeNodes.pop_back();
+        _nodes[id] = node;
+        return id;
+    }
+    _nodes.push_back(node);
+    return quint32(_nodes.size() - 1);
+}
+
+/********************************************************************
+*                              release                      private *
+*-------------------------------------------------------------------*
+* Returns the node and its whole subtree to the free lists.         *
+********************************************************************/
+void ProjectModel::release(const quint32 id) {
+    if (const quint32 dir = _nodes[id].dir; dir != NoNode) {
+        for (const quint32 child : _dirs[dir].children) {
+            release(child);
+        }
+        _dirs[dir] = {{}, nullptr, 0};
+        _freeDirs.push_back(dir);
+    }
+    _nodes[id] = {NoNode, 0, 0, NoNode, 0};
+    _freeNodes.push_back(id);
+}
+
+/********************************************************************
+*                              renumber                     private *
+********************************************************************/
+void ProjectModel::renumber(const quint32 dir, const size_t from) {
+    const auto& children = _dirs[dir].children;
+    for (size_t i = from; i < children.size(); i++) {
+        _nodes[children[i]].row = quint32(i);
+    }
+}
+
+/********************************************************************
+*                              compare                      private *
+********************************************************************/
+int ProjectModel::compare(const quint32 id, const FileSystem::Entry& entry) const {
+    const Node& node = _nodes[id];
+    return compare(node.flags & Directory, _names[node.name],
+                   entry.dir, {entry.name.constData(), size_t(entry.name.size())});
+}
+
+/********************************************************************
+*                              isHidden              private static *
+********************************************************************/
+bool ProjectModel::isHidden(const FileSystem::Entry& entry, const bool showVendor) {
+    if (entry.dir) {
+        if (entry.name == ".git") return true;
+        if (entry.name == ".goedit") return true;
+        if (!showVendor && entry.name == VendorDir) return true;
+    }
+    return false;
+}
+
+/********************************************************************
+*                              compare               private static *
+*-------------------------------------------------------------------*
+* Directories first, then names without regard to ASCII case.       *
+********************************************************************/
+int ProjectModel::compare(const bool aDir, const std::string_view& a,
+                          const bool bDir, const std::string_view& b)
+{
+    if (aDir != bDir) {
+        return aDir ? -1 : 1;
+    }
+    const size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; i++) {
+        const int ca = tolower(static_cast<unsigned char>(a[i]));
+        const int cb = tolower(static_cast<unsigned char>(b[i]));
+        if (ca != cb) {
+            return ca - cb;
+        }
+    }
+    if (a.size() != b.size()) {
+        return (a.size() < b.size()) ? -1 : 1;
+    }
+    return a.compare(b);
+}
@@ -0,0 +1,141 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectModel.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_PROJECT_MODEL_H
+#define GOEDIT_PROJECT_MODEL_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QAbstractItemModel>
+#include <QThreadPool>
+#include <QIcon>
+#include <vector>
+#include "Shared/StringPool.h"
+#include "Project/FileSystem.h"
+#include "Project/IgnoreRules.h"
+
+/********************************************************************
+*                           ProjectModel                            *
+*-------------------------------------------------------------------*
+* Tree of project files. Nodes live in one flat arena, they keep    *
+* the index of the parent and the id of the interned name only.     *
+* Directories are listed lazily (fetchMore) in a background thread  *
+* and the result is merged into the tree, so the same code path is  *
+* used for the first load and for every later refresh.              *
+********************************************************************/
+class ProjectModel : public QAbstractItemModel {
+    Q_OBJECT
+public:
+    enum Roles {
+        PathRole = Qt::UserRole + 1,
+        IsDirRole
+    };
+private:
+    static constexpr quint32 NoNode = UINT32_MAX;
+    enum Flags : quint8 {
+        Directory = 0x01,
+        Loaded    = 0x02,
+        Loading   = 0x04,
+        Reload    = 0x08
+    };
+    struct Node {
+        quint32 parent;
+        quint32 name;
+        quint32 row;
+        quint32 dir;      // index in _dirs, NoNode for files
+        quint8  flags;
+    };
+    struct Dir {
+        std::vector<quint32> children;
+        IgnoreRules::Ptr rules;
+        quint32 ticket;
+    };
+    struct Listing {
+        quint32 node;
+        quint32 ticket;
+        quint32 epoch;
+        QVector<FileSystem::Entry> entries;
+        IgnoreRules::Ptr rules;
+    };
+
+    QString _root;
+    QByteArray _encodedRoot;
+    StringPool _names;
+    std::vector<Node> _nodes;
+    std::vector<Dir> _dirs;
+    std::vector<quint32> _freeNodes;
+    std::vector<quint32> _freeDirs;
+    quint32 _epoch;
+    quint32 _tickets;
+    bool _showVendor;
+    const QIcon _dirIcon;
+    const QIcon _fileIcon;
+    QThreadPool _pool;
+public:
+    explicit ProjectModel(QObject* = nullptr);
+    ~ProjectModel() override;
+
+    void setRoot(const QString&);
+    void clear();
+    QString root() const {
+        return _root;
+    }
+    bool showVendor() const {
+        return _showVendor;
+    }
+    void setShowVendor(const bool);
+    void refresh(const QStringList&);
+    void refreshAll();
+    QString filePath(const QModelIndex&) const;
+
+    QModelIndex index(int, int, const QModelIndex& = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex&) const override;
+    int rowCount(const QModelIndex& = QModelIndex()) const override;
+    int columnCount(const QModelIndex& = QModelIndex()) const override;
+    bool hasChildren(const QModelIndex& = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex&) const override;
+    void fetchMore(const QModelIndex&) override;
+    QVariant data(const QModelIndex&, int = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex&) const override;
+
+private:
+    QModelIndex indexOf(const quint32) const;
+    quint32 find(const QString&) const;
+    QString relativePath(const quint32) const;
+    QString absolutePath(const quint32) const;
+    QString displayName(const quint32) const;
+    void requestListing(const quint32);
+    void apply(const Listing&);
+    void merge(const quint32, const QVector<FileSystem::Entry>&);
+    quint32 allocate(const quint32, const FileSystem::Entry&);
+    void release(const quint32);
+    void renumber(const quint32, const size_t);
+    int compare(const quint32, const FileSystem::Entry&) const;
+
+    static Listing list(Listing, const QByteArray&, const QString&, const IgnoreRules::Ptr&, const bool);
+    static bool isHidden(const FileSystem::Entry&, const bool);
+    static int compare(const bool, const std::string_view&, const bool, const std::string_view&);
+};
+
+#endif // GOEDIT_PROJECT_MODEL_H
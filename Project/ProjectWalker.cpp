@@ -0,0 +1,135 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectWalker.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QSet>
+#include <vector>
+#include <algorithm>
+#include "ProjectWalker.h"
+#include "IgnoreRules.h"
+
+/********************************************************************
+*                               list                          local *
+*-------------------------------------------------------------------*
+* Entries of one directory without hidden and ignored ones.         *
+********************************************************************/
+static QVector<FileSystem::Entry> list(const QString& root, const QString& relDir, const IgnoreRules::Ptr& rules) {
+    const QString dir = relDir.isEmpty() ? root : root + '/' + relDir;
+    auto entries = FileSystem::entries(QFile::encodeName(dir));
+
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const FileSystem::Entry& entry) {
+        if (entry.dir && (entry.name == ".git" || entry.name == ".goedit")) {
+            return true;
+        }
+        if (rules) {
+            const QString name = QFile::decodeName(entry.name);
+            return rules->isIgnored(relDir.isEmpty() ? name : relDir + '/' + name, entry.dir);
+        }
+        return false;
+    }), entries.end());
+    return entries;
+}
+
+/********************************************************************
+*                               walk                  public static *
+*-------------------------------------------------------------------*
+* Symbolic links to directories are followed, but every directory   *
+* is visited once, so links pointing back up the tree don't loop.   *
+* A non-empty 'top' walks only that subtree of the project.         *
+********************************************************************/
+void ProjectWalker::walk(const QString& root, const Visitor& visit, const QString& top) {
+    struct Item {
+        QString relDir;
+        IgnoreRules::Ptr rules;
+    };
+    const auto inherited = top.isEmpty() ? nullptr : IgnoreRules::chain(root, top.section('/', 0, -2));
+    std::vector<Item> stack{{top, inherited}};
+    QSet<FileSystem::Id> visited;
+
+    while (!stack.empty()) {
+        const Item item = stack.back();
+        stack.pop_back();
+
+        const QString dir = item.relDir.isEmpty() ? root : root + '/' + item.relDir;
+        FileSystem::Id id;
+        if (!FileSystem::id(QFile::encodeName(dir), id) || visited.contains(id)) {
+            continue;
+        }
+        visited.insert(id);
+        const auto rules = IgnoreRules::load(dir, item.relDir, item.rules);
+
+        QVector<FileSystem::Entry> files;
+        for (auto& entry : list(root, item.relDir, rules)) {
+            if (entry.dir) {
+                const QString name = QFile::decodeName(entry.name);
+                stack.push_back({item.relDir.isEmpty() ? name : item.relDir + '/' + name, rules});
+            } else {
+                files.append(std::move(entry));
+            }
+        }
+        if (!visit(item.relDir, files)) {
+            return;
+        }
+    }
+}
+
+/********************************************************************
+*                              entries                public static *
+*-------------------------------------------------------------------*
+* Files and subdirectories of one directory.                        *
+********************************************************************/
+QVector<FileSystem::Entry> ProjectWalker::entries(const QString& root, const QString& relDir) {
+    return list(root, relDir, IgnoreRules::chain(root, relDir));
+}
+
+/********************************************************************
+*                               files                 public static *
+*-------------------------------------------------------------------*
+* Files of one directory, e.g. after the watcher reported a change. *
+********************************************************************/
+QVector<FileSystem::Entry> ProjectWalker::files(const QString& root, const QString& relDir) {
+    auto entries = ProjectWalker::entries(root, relDir);
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const FileSystem::Entry& entry) {
+        return entry.dir;
+    }), entries.end());
+    return entries;
+}
+
+/********************************************************************
+*                            relativePath             public static *
+*-------------------------------------------------------------------*
+* Path relative to the project root, null string for outside paths. *
+********************************************************************/
+QString ProjectWalker::relativePath(const QString& root, const QString& path) {
+    if (path == root) {
+        return QString("");
+    }
+    if (path.startsWith(root) && path.size() > root.size() && path[root.size()] == '/') {
+        return path.mid(root.size() + 1);
+    }
+    return QString();
+}
@@ -0,0 +1,58 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectWalker.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_PROJECT_WALKER_H
+#define GOEDIT_PROJECT_WALKER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <functional>
+#include "Project/FileSystem.h"
+
+/********************************************************************
+*                           ProjectWalker                           *
+*-------------------------------------------------------------------*
+* Walks the project the way the tree shows it: without .git and     *
+* without paths ignored by .gitignore files. Used by background     *
+* indexers, so nothing here touches GUI objects.                    *
+********************************************************************/
+class ProjectWalker {
+public:
+    // Gets relative path of a directory and its (files only) entries.
+    // Returning false stops the walk.
+    using Visitor = std::function<bool(const QString&, const QVector<FileSystem::Entry>&)>;
+
+    ProjectWalker() = delete;
+    ~ProjectWalker() = delete;
+    ProjectWalker(const ProjectWalker&) = delete;
+    ProjectWalker(const ProjectWalker&&) = delete;
+
+    static void walk(const QString&, const Visitor&, const QString& = QString());
+    static QVector<FileSystem::Entry> entries(const QString&, const QString&);
+    static QVector<FileSystem::Entry> files(const QString&, const QString&);
+    static QString relativePath(const QString&, const QString&);
+};
+
+#endif // GOEDIT_PROJECT_WALKER_H
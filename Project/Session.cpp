@@ -0,0 +1,158 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Session.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDataStream>
+#include <QtConcurrent>
+#include <QDebug>
+#include "Session.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+using namespace beesoft::sqlite;
+
+//*******************************************************************
+//                              Session                         CTOR
+//*******************************************************************
+Session::Session(QObject* parent)
+    : QObject(parent)
+{
+    // One thread: the last snapshot written is the last one saved.
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                             ~Session                         dtor *
+********************************************************************/
+Session::~Session() {
+    wait();
+}
+
+/********************************************************************
+*                               save                         public *
+*-------------------------------------------------------------------*
+* Snapshot is encoded here (it's small), the database is written in *
+* the background. Snapshots still waiting are replaced by this one. *
+********************************************************************/
+void Session::save(const Snapshot& snapshot) {
+    const QByteArray data = encode(snapshot);
+    _pool.clear();
+    QtConcurrent::run(&_pool, [data] {
+        auto& db = SQLite::shared();
+        if (!db.isOpen()) {
+            return;
+        }
+        const bool ok = db.exec("INSERT OR REPLACE INTO session (id, data) VALUES (1, :data)",
+                                {Field("data", data.constData(), data.size())});
+        if (!ok) {
+            qWarning() << "Session: can't save the snapshot";
+        }
+    });
+}
+
+/********************************************************************
+*                               load                         public *
+*-------------------------------------------------------------------*
+* Reads the last saved snapshot. Returns false when there is none   *
+* or it can't be decoded.                                           *
+********************************************************************/
+bool Session::load(Snapshot& snapshot) {
+    wait();
+    auto& db = SQLite::shared();
+    if (!db.isOpen()) {
+        return false;
+    }
+    const auto rows = db.select("SELECT data FROM session WHERE id=1");
+    if (rows.empty() || rows[0][0].type() != Type::Blob || rows[0][0].size() == 0) {
+        return false;
+    }
+    const auto blob = rows[0][0].as_vector();
+    return decode(QByteArray(blob.data(), int(blob.size())), snapshot);
+}
+
+/********************************************************************
+*                               wait                         public *
+*-------------------------------------------------------------------*
+* Waits until the snapshot is written, so the database may be       *
+* closed after that.                                                *
+********************************************************************/
+void Session::wait() {
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                              encode                 public static *
+********************************************************************/
+QByteArray Session::encode(const Snapshot& snapshot) {
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_12);
+
+    out << Magic << Version;
+    out << qint32(snapshot.documents.size());
+    for (const auto& doc : snapshot.documents) {
+        out << doc.path << doc.line << doc.column << doc.scroll;
+    }
+    out << snapshot.current << snapshot.expanded;
+    // Window state is a blob of Qt, it's worth compressing.
+    out << qCompress(snapshot.windowState);
+    return data;
+}
+
+/********************************************************************
+*                              decode                 public static *
+********************************************************************/
+bool Session::decode(const QByteArray& data, Snapshot& snapshot) {
+    QDataStream in(data);
+    in.setVersion(QDataStream::Qt_5_12);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    in >> magic >> version;
+    if (magic != Magic || version != Version) {
+        return false;
+    }
+
+    qint32 count = 0;
+    in >> count;
+    if (count < 0 || in.status() != QDataStream::Ok) {
+        return false;
+    }
+    Snapshot result;
+    for (qint32 i = 0; i < count && in.status() == QDataStream::Ok; i++) {
+        Document doc;
+        in >> doc.path >> doc.line >> doc.column >> doc.scroll;
+        result.documents.append(doc);
+    }
+    QByteArray windowState;
+    in >> result.current >> result.expanded >> windowState;
+    if (in.status() != QDataStream::Ok) {
+        return false;
+    }
+    result.windowState = qUncompress(windowState);
+    snapshot = result;
+    return true;
+}
@@ -0,0 +1,77 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Session.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_SESSION_H
+#define GOEDIT_SESSION_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+#include <QByteArray>
+#include <QThreadPool>
+
+/********************************************************************
+*                              Session                              *
+*-------------------------------------------------------------------*
+* State of the user interface of the project: open documents with   *
+* their cursors and scroll positions, layout of the docks and the   *
+* expanded directories of the project tree. Snapshot is kept in the *
+* project database in a compact binary form and is written by       *
+* a background thread, so saving never blocks the user interface.   *
+********************************************************************/
+class Session : public QObject {
+    Q_OBJECT
+
+    static constexpr quint32 Magic = 0x47534553;   // "GSES"
+    static constexpr quint16 Version = 1;
+public:
+    struct Document {
+        QString path;
+        qint32 line;        // cursor, 0-based
+        qint32 column;
+        qint32 scroll;      // first visible line
+    };
+    struct Snapshot {
+        QVector<Document> documents;
+        qint32 current = -1;
+        QByteArray windowState;     // QMainWindow::saveState
+        QStringList expanded;       // relative paths of directories
+    };
+private:
+    QThreadPool _pool;
+public:
+    explicit Session(QObject* = nullptr);
+    ~Session() override;
+
+    void save(const Snapshot&);
+    bool load(Snapshot&);
+    void wait();
+
+    static QByteArray encode(const Snapshot&);
+    static bool decode(const QByteArray&, Snapshot&);
+};
+
+#endif // GOEDIT_SESSION_H
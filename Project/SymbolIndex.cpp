@@ -0,0 +1,489 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : SymbolIndex.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
+#include <QSet>
+#include <QtConcurrent>
+#include "SymbolIndex.h"
+#include "FileWatcher.h"
+#include "ProjectWalker.h"
+#include "Go/GoParser.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- namespaces:
+-------------------------------------------------------------------*/
+using namespace beesoft::sqlite;
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int BatchSize = 256;        // files parsed and stored at once
+
+/*------- local types:
+-------------------------------------------------------------------*/
+namespace {
+    struct Known {
+        qint64 id = 0;
+        qint64 mtime = 0;
+        qint64 size = 0;
+        qint64 hash = 0;
+    };
+
+    struct File {
+        enum State {
+            Unchanged,
+            Touched,        // only time or size changed, content is the same
+            Changed,
+            Removed
+        };
+
+        QString path;
+        Known known;
+        qint64 mtime = 0;
+        qint64 size = 0;
+        qint64 hash = 0;
+        State state = Unchanged;
+        std::string package;
+        std::vector<GoSymbol> symbols;
+        std::vector<std::string> imports;
+    };
+}
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+
+// FNV-1a, good enough to tell whether content changed.
+static qint64 hash64(const QByteArray& data) {
+    quint64 hash = 14695981039346656037ULL;
+    for (const char c : data) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return qint64(hash);
+}
+
+// Files stored in the database, all or under the directory 'dir'.
+static QHash<QString, Known> knownFiles(const QString& dir) {
+    auto& db = SQLite::shared();
+    Result rows;
+    if (dir.isEmpty()) {
+        rows = db.select("SELECT id, path, mtime, size, hash FROM files");
+    } else {
+        // '0' follows '/' in ASCII, so this is the range of paths "dir/..."
+        rows = db.select("SELECT id, path, mtime, size, hash FROM files WHERE path >= :lo AND path < :hi",
+                         {Field("lo", (dir + '/').toStdString()), Field("hi", (dir + '0').toStdString())});
+    }
+
+    QHash<QString, Known> known;
+    known.reserve(int(rows.size()));
+    for (const auto& row : rows) {
+        known.insert(QString::fromStdString(row[1].as_text()),
+                     {row[0].as_i64(), row[2].as_i64(), row[3].as_i64(), row[4].as_i64()});
+    }
+    return known;
+}
+
+static Known knownFile(const QString& path) {
+    const auto rows = SQLite::shared().select("SELECT id, mtime, size, hash FROM files WHERE path = :path",
+                                              {Field("path", path.toStdString())});
+    if (rows.empty()) {
+        return {};
+    }
+    return {rows[0][0].as_i64(), rows[0][1].as_i64(), rows[0][2].as_i64(), rows[0][3].as_i64()};
+}
+
+// Decides what happened with the file, parses it when needed.
+// Called in parallel for files of a batch.
+static void check(const QString& root, File& file) {
+    const QFileInfo info(root + '/' + file.path);
+    if (!info.isFile()) {
+        file.state = file.known.id ? File::Removed : File::Unchanged;
+        return;
+    }
+    file.mtime = info.lastModified().toMSecsSinceEpoch();
+    file.size = info.size();
+    if (file.known.id && file.mtime == file.known.mtime && file.size == file.known.size) {
+        file.state = File::Unchanged;
+        return;
+    }
+
+    QFile f(info.filePath());
+    if (!f.open(QIODevice::ReadOnly)) {
+        file.state = File::Unchanged;
+        return;
+    }
+    const QByteArray data = f.readAll();
+    file.hash = hash64(data);
+    if (file.known.id && file.hash == file.known.hash) {
+        file.state = File::Touched;
+        return;
+    }
+
+    GoParser parser({data.constData(), size_t(data.size())});
+    file.symbols = parser.parse();
+    file.package = parser.package();
+    file.imports = parser.imports();
+    file.state = File::Changed;
+}
+
+// Writes results of a batch in one transaction.
+static bool store(const QVector<File>& files) {
+    return SQLite::shared().transaction([&files](SQLite& db) {
+        for (const auto& file : files) {
+            const Field id("id", i64(file.known.id));
+            switch (file.state) {
+            case File::Unchanged:
+                break;
+            case File::Touched:
+                if (!db.update("files", {id, Field("mtime", i64(file.mtime)), Field("size", i64(file.size))})) {
+                    return false;
+                }
+                break;
+            case File::Removed:
+                if (!db.exec("DELETE FROM symbols WHERE file = :id", {id})
+                    || !db.exec("DELETE FROM imports WHERE file = :id", {id})
+                    || !db.exec("DELETE FROM files WHERE id = :id", {id})) {
+                    return false;
+                }
+                break;
+            case File::Changed: {
+                i64 fileId = file.known.id;
+                const std::vector<Field> fields{
+                    Field("mtime", i64(file.mtime)),
+                    Field("size", i64(file.size)),
+                    Field("hash", i64(file.hash)),
+                    Field("package", file.package)
+                };
+                if (fileId) {
+                    std::vector<Field> values{id};
+                    values.insert(values.end(), fields.begin(), fields.end());
+                    if (!db.exec("DELETE FROM symbols WHERE file = :id", {id})
+                        || !db.exec("DELETE FROM imports WHERE file = :id", {id})
+                        || !db.update("files", values)) {
+                        return false;
+                    }
+                } else {
+                    std::vector<Field> values{Field("path", file.path.toStdString())};
+                    values.insert(values.end(), fields.begin(), fields.end());
+                    if ((fileId = db.insert("files", values)) < 0) {
+                        return false;
+                    }
+                }
+
+                std::vector<Row> rows;
+                rows.reserve(file.symbols.size());
+                for (const auto& symbol : file.symbols) {
+                    rows.push_back({
+                        Field("file", fileId),
+                        Field("name", symbol.name),
+                        Field("kind", i64(symbol.kind)),
+                        Field("container", symbol.container),
+                        Field("line", i64(symbol.line)),
+                        Field("col", i64(symbol.column))
+                    });
+                }
+                if (!db.insert("symbols", rows)) {
+                    return false;
+                }
+
+                rows.clear();
+                for (const auto& path : file.imports) {
+                    rows.push_back({Field("file", fileId), Field("path", path)});
+                }
+                if (!db.insert("imports", rows)) {
+                    return false;
+                }
+                break; }
+            }
+        }
+        return true;
+    });
+}
+
+static QVector<SymbolIndex::Symbol> symbols(const Result& rows) {
+    QVector<SymbolIndex::Symbol> result;
+    result.reserve(int(rows.size()));
+    for (const auto& row : rows) {
+        result.append({
+            QString::fromStdString(row[0].as_text()),
+            QString::fromStdString(row[1].as_text()),
+            int(row[2].as_i64()),
+            QString::fromStdString(row[3].as_text()),
+            int(row[4].as_i64()),
+            int(row[5].as_i64())
+        });
+    }
+    return result;
+}
+
+// Pattern for LIKE (with ESCAPE '\') matching names starting with 'text'.
+static std::string prefixPattern(const QString& text) {
+    std::string pattern;
+    for (const char c : text.toStdString()) {
+        if (c == '%' || c == '_' || c == '\\') {
+            pattern += '\\';
+        }
+        pattern += c;
+    }
+    return pattern + '%';
+}
+
+//*******************************************************************
+//                            SymbolIndex                       CTOR
+//*******************************************************************
+SymbolIndex::SymbolIndex(QObject* parent)
+    : QObject(parent)
+    , _epoch(0)
+{
+    // One thread: passes are applied in order and only one writes.
+    // Parsing itself runs on the global pool.
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                           ~SymbolIndex                       dtor *
+********************************************************************/
+SymbolIndex::~SymbolIndex() {
+    clear();
+}
+
+/********************************************************************
+*                               reset                        public *
+*-------------------------------------------------------------------*
+* Brings the index of the project up to date. The database must be  *
+* already opened. Files not changed since the last session are not  *
+* even read.                                                        *
+********************************************************************/
+void SymbolIndex::reset(const QString& root) {
+    clear();
+    _root = root;
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, root, epoch] {
+        sync(root, {{}, {}, true}, epoch);
+    });
+}
+
+/********************************************************************
+*                               clear                        public *
+*-------------------------------------------------------------------*
+* Stops the work in progress and waits for it, so the database can  *
+* be closed after that. Passes check the epoch often, it's short.   *
+********************************************************************/
+void SymbolIndex::clear() {
+    ++_epoch;
+    _root.clear();
+    _pool.clear();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                               update                       public *
+********************************************************************/
+void SymbolIndex::update(const FileChanges& changes) {
+    if (_root.isEmpty()) {
+        return;
+    }
+    Pass pass{{}, {}, changes.overflow};
+    if (!pass.full) {
+        for (const auto& file : changes.files) {
+            if (file.endsWith(".go")) {
+                if (const QString rel = ProjectWalker::relativePath(_root, file); !rel.isNull()) {
+                    pass.files.append(rel);
+                }
+            }
+        }
+        for (const auto& dir : changes.directories) {
+            if (const QString rel = ProjectWalker::relativePath(_root, dir); !rel.isNull()) {
+                pass.dirs.append(rel);
+            }
+        }
+        if (pass.files.isEmpty() && pass.dirs.isEmpty()) {
+            return;
+        }
+    }
+
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, root = _root, pass, epoch] {
+        sync(root, pass, epoch);
+    });
+}
+
+/********************************************************************
+*                               find                         public *
+*-------------------------------------------------------------------*
+* Declarations of the name (for "find declaration").                *
+********************************************************************/
+QVector<SymbolIndex::Symbol> SymbolIndex::find(const QString& name) const {
+    auto& db = SQLite::shared();
+    if (_root.isEmpty() || !db.isOpen()) {
+        return {};
+    }
+    return symbols(db.select(
+        "SELECT s.name, s.container, s.kind, f.path, s.line, s.col"
+        " FROM symbols s JOIN files f ON f.id = s.file"
+        " WHERE s.name = :name COLLATE NOCASE AND s.name = :name"
+        " ORDER BY s.kind, f.path",
+        {Field("name", name.toStdString())}));
+}
+
+/********************************************************************
+*                              search                        public *
+*-------------------------------------------------------------------*
+* Symbols whose names start with the text (case insensitive), exact *
+* matches and short names first. "Type.prefix" searches members of  *
+* types whose names start with "Type".                              *
+********************************************************************/
+QVector<SymbolIndex::Symbol> SymbolIndex::search(const QString& text, const int limit) const {
+    auto& db = SQLite::shared();
+    const QString query = text.trimmed();
+    if (_root.isEmpty() || query.isEmpty() || !db.isOpen()) {
+        return {};
+    }
+
+    const int dot = query.lastIndexOf('.');
+    const QString name = (dot < 0) ? query : query.mid(dot + 1);
+    std::vector<Field> binds{
+        Field("name", prefixPattern(name)),
+        Field("exact", name.toStdString()),
+        Field("limit", i64(limit))
+    };
+    std::string where = " WHERE s.name LIKE :name ESCAPE '\\'";
+    if (dot >= 0) {
+        where += " AND s.container LIKE :container ESCAPE '\\'";
+        binds.emplace_back("container", prefixPattern(query.left(dot)));
+    }
+
+    return symbols(db.select(
+        "SELECT s.name, s.container, s.kind, f.path, s.line, s.col"
+        " FROM symbols s JOIN files f ON f.id = s.file"
+        + where +
+        " ORDER BY s.name = :exact DESC, length(s.name), s.name, f.path"
+        " LIMIT :limit",
+        binds));
+}
+
+/********************************************************************
+*                             kindName                public static *
+********************************************************************/
+QString SymbolIndex::kindName(const int kind) {
+    switch (kind) {
+    case GoSymbol::Function: return "func";
+    case GoSymbol::Method:   return "method";
+    case GoSymbol::Type:     return "type";
+    case GoSymbol::Field:    return "field";
+    case GoSymbol::Constant: return "const";
+    case GoSymbol::Variable: return "var";
+    }
+    return QString();
+}
+
+/********************************************************************
+*                               sync                        private *
+*-------------------------------------------------------------------*
+* Runs in the pool thread. Collects files to check: all .go files   *
+* of the project (full pass) or changed ones, plus stored files     *
+* from directories which disappeared (moved away) under changed     *
+* directories. Files are then checked and stored in batches.        *
+********************************************************************/
+void SymbolIndex::sync(const QString& root, const Pass& pass, const quint32 epoch) {
+    if (!SQLite::shared().isOpen()) {
+        return;
+    }
+
+    QVector<File> files;
+    if (pass.full) {
+        QHash<QString, Known> known = knownFiles(QString());
+        ProjectWalker::walk(root, [&](const QString& relDir, const QVector<FileSystem::Entry>& entries) {
+            if (epoch != _epoch) {
+                return false;
+            }
+            for (const auto& entry : entries) {
+                if (entry.name.endsWith(".go")) {
+                    const QString name = QFile::decodeName(entry.name);
+                    File file;
+                    file.path = relDir.isEmpty() ? name : relDir + '/' + name;
+                    file.known = known.take(file.path);
+                    files.append(std::move(file));
+                }
+            }
+            return true;
+        });
+        if (epoch != _epoch) {
+            return;
+        }
+        for (auto it = known.cbegin(); it != known.cend(); ++it) {
+            File file;
+            file.path = it.key();
+            file.known = it.value();
+            file.state = File::Removed;
+            files.append(std::move(file));
+        }
+    } else {
+        QSet<QString> paths(pass.files.cbegin(), pass.files.cend());
+        for (const auto& dir : pass.dirs) {
+            const auto known = knownFiles(dir);
+            QHash<QString, bool> exists;
+            for (auto it = known.cbegin(); it != known.cend(); ++it) {
+                const QString parent = it.key().section('/', 0, -2);
+                auto found = exists.find(parent);
+                if (found == exists.end()) {
+                    found = exists.insert(parent, QFileInfo(root + '/' + parent).isDir());
+                }
+                if (!found.value()) {
+                    paths.insert(it.key());
+                }
+            }
+        }
+        for (const auto& path : paths) {
+            File file;
+            file.path = path;
+            file.known = knownFile(path);
+            files.append(std::move(file));
+        }
+    }
+
+    for (int i = 0; i < files.size(); i += BatchSize) {
+        QVector<File> batch = files.mid(i, BatchSize);
+        QtConcurrent::blockingMap(batch, [&](File& file) {
+            if (file.state != File::Removed && epoch == _epoch) {
+                check(root, file);
+            }
+        });
+        if (epoch != _epoch || !store(batch)) {
+            return;
+        }
+    }
+
+    QMetaObject::invokeMethod(this, [this, epoch] {
+        if (epoch == _epoch) {
+            emit updated();
+        }
+    }, Qt::QueuedConnection);
+}
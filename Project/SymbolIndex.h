@@ -0,0 +1,89 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : SymbolIndex.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_SYMBOL_INDEX_H
+#define GOEDIT_SYMBOL_INDEX_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+#include <QThreadPool>
+#include <atomic>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+struct FileChanges;
+
+/********************************************************************
+*                            SymbolIndex                            *
+*-------------------------------------------------------------------*
+* Package level declarations of all .go files of the project, kept  *
+* in the project database. Only files whose size or modification    *
+* time changed are read, and only files whose content hash changed  *
+* are parsed again (on all cores). Writing to the database and      *
+* ordering of the passes is done by a single background thread.     *
+* Queries are answered by the database directly.                    *
+********************************************************************/
+class SymbolIndex : public QObject {
+    Q_OBJECT
+public:
+    struct Symbol {
+        QString name;
+        QString container;      // receiver of a method, owner of a field
+        int kind;               // GoSymbol::Kind
+        QString path;           // relative to the project root
+        int line;               // 0-based
+        int column;
+    };
+private:
+    struct Pass {
+        QStringList files;      // relative paths of changed .go files
+        QStringList dirs;       // relative paths of changed directories
+        bool full;              // walk the whole project
+    };
+
+    QString _root;
+    std::atomic<quint32> _epoch;
+    QThreadPool _pool;
+public:
+    explicit SymbolIndex(QObject* = nullptr);
+    ~SymbolIndex() override;
+
+    void reset(const QString&);
+    void clear();
+    void update(const FileChanges&);
+    QVector<Symbol> find(const QString&) const;
+    QVector<Symbol> search(const QString&, const int) const;
+    static QString kindName(const int);
+
+private:
+    void sync(const QString&, const Pass&, const quint32);
+
+signals:
+    void updated();
+};
+
+#endif // GOEDIT_SYMBOL_INDEX_H
@@ -0,0 +1,644 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TrigramIndex.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSet>
+#include <QRegularExpression>
+#include <QtConcurrent>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include "TrigramIndex.h"
+#include "FileWatcher.h"
+#include "ProjectWalker.h"
+#include "ProjectDatabase.h"
+#include "Shared/Trigram.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr qint64 MaxFileSize = 16 * 1024 * 1024;    // bigger files are not sources
+static constexpr size_t BinaryProbe = 8192;                 // NUL in that many bytes: binary
+static constexpr int BatchSize = 256;                       // files read at once
+static constexpr int MinStale = 1024;                       // delta/dead files before a rebuild
+static constexpr int MaxLineLength = 500;                   // of the text shown for a hit
+
+/*------- local types:
+-------------------------------------------------------------------*/
+namespace {
+    struct Scan {
+        enum State {
+            Unchanged,
+            Changed,
+            Removed
+        };
+
+        QString path;
+        qint64 knownMtime = -1;
+        qint64 knownSize = -1;
+        qint64 mtime = 0;
+        qint64 size = 0;
+        State state = Unchanged;
+        std::vector<uint32_t> trigrams;
+    };
+
+    struct FileHits {
+        QString path;
+        QVector<TrigramIndex::Hit> hits;
+    };
+}
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+
+static bool isBinary(std::string_view text) {
+    return text.substr(0, BinaryProbe).find('\0') != std::string_view::npos;
+}
+
+// Stats the file and reads its trigrams when it changed.
+// Binary and too big files are indexed without trigrams.
+static void scan(const QString& root, Scan& s) {
+    const QFileInfo info(root + '/' + s.path);
+    if (!info.isFile()) {
+        s.state = Scan::Removed;
+        return;
+    }
+    s.mtime = info.lastModified().toMSecsSinceEpoch();
+    s.size = info.size();
+    if (s.mtime == s.knownMtime && s.size == s.knownSize) {
+        s.state = Scan::Unchanged;
+        return;
+    }
+    s.state = Scan::Changed;
+    if (s.size == 0 || s.size > MaxFileSize) {
+        return;
+    }
+
+    QFile file(info.filePath());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    if (const uchar* const data = file.map(0, s.size); data) {
+        const std::string_view text(reinterpret_cast<const char*>(data), size_t(s.size));
+        if (!isBinary(text)) {
+            Trigram::extract(text, s.trigrams);
+        }
+    }
+}
+
+static std::vector<QVector<Scan>> batches(QVector<Scan>& all) {
+    std::vector<QVector<Scan>> result;
+    for (int i = 0; i < all.size(); i += BatchSize) {
+        result.push_back(all.mid(i, BatchSize));
+    }
+    all.clear();
+    return result;
+}
+
+// Hit for the match [begin, end) (bytes) on the line [lineBegin, lineEnd).
+static TrigramIndex::Hit hit(const QString& path, std::string_view text, const int line,
+                             const size_t lineBegin, const size_t lineEnd, const size_t begin, const size_t end)
+{
+    const char* const p = text.data();
+    return {
+        path,
+        line,
+        QString::fromUtf8(p + lineBegin, int(begin - lineBegin)).size(),
+        QString::fromUtf8(p + begin, int(end - begin)).size(),
+        QString::fromUtf8(p + lineBegin, int(std::min<size_t>(lineEnd - lineBegin, MaxLineLength)))
+    };
+}
+
+// At most one hit per line, at most 'limit' hits.
+// Without case sensitivity only ASCII letters are folded.
+static QVector<TrigramIndex::Hit> searchLiteral(const QString& path, std::string_view text,
+                                                const QByteArray& needle, const bool caseSensitive, const int limit)
+{
+    thread_local std::string folded;
+    std::string_view haystack = text;
+    std::string pattern(needle.constData(), size_t(needle.size()));
+    if (!caseSensitive) {
+        folded.resize(text.size());
+        std::transform(text.begin(), text.end(), folded.begin(), [](const char c) { return char(Trigram::fold(c)); });
+        std::transform(pattern.begin(), pattern.end(), pattern.begin(), [](const char c) { return char(Trigram::fold(c)); });
+        haystack = folded;
+    }
+    const std::boyer_moore_horspool_searcher searcher(pattern.begin(), pattern.end());
+
+    QVector<TrigramIndex::Hit> hits;
+    size_t pos = 0;
+    size_t counted = 0;
+    int line = 0;
+    while (pos < haystack.size() && hits.size() < limit) {
+        const auto it = std::search(haystack.begin() + pos, haystack.end(), searcher);
+        if (it == haystack.end()) {
+            break;
+        }
+        const size_t begin = size_t(it - haystack.begin());
+        line += int(std::count(text.begin() + counted, text.begin() + begin, '\n'));
+        counted = begin;
+
+        const size_t nl = text.rfind('\n', begin);
+        const size_t lineBegin = (nl == std::string_view::npos) ? 0 : nl + 1;
+        size_t lineEnd = text.find('\n', begin);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = text.size();
+        }
+        hits.append(hit(path, text, line, lineBegin, lineEnd, begin, begin + pattern.size()));
+        pos = lineEnd;
+    }
+    return hits;
+}
+
+static QVector<TrigramIndex::Hit> searchRegex(const QString& path, std::string_view text,
+                                              const QRegularExpression& regex, const int limit)
+{
+    const QString content = QString::fromUtf8(text.data(), int(text.size()));
+    QVector<TrigramIndex::Hit> hits;
+    int line = 0;
+    int counted = 0;
+    int lineEnd = -1;
+
+    auto it = regex.globalMatch(content);
+    while (it.hasNext() && hits.size() < limit) {
+        const auto match = it.next();
+        const int begin = match.capturedStart();
+        if (begin < lineEnd || match.capturedLength() == 0) {
+            continue;       // one hit per line
+        }
+        line += content.midRef(counted, begin - counted).count('\n');
+        counted = begin;
+
+        const int lineBegin = content.lastIndexOf('\n', begin - 1) + 1;
+        lineEnd = content.indexOf('\n', begin);
+        if (lineEnd < 0) {
+            lineEnd = content.size();
+        }
+        hits.append({path, line, begin - lineBegin, match.capturedLength(),
+                     content.mid(lineBegin, std::min(lineEnd - lineBegin, MaxLineLength))});
+    }
+    return hits;
+}
+
+//*******************************************************************
+//                           TrigramIndex                       CTOR
+//*******************************************************************
+TrigramIndex::TrigramIndex(QObject* parent)
+    : QObject(parent)
+    , _epoch(0)
+{
+    // One thread, so updates are applied in the order they came.
+    // Reading of files runs on the global pool.
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                          ~TrigramIndex                       dtor *
+********************************************************************/
+TrigramIndex::~TrigramIndex() {
+    clear();
+}
+
+/********************************************************************
+*                               reset                        public *
+*-------------------------------------------------------------------*
+* Opens the saved base and checks files of the project against it,  *
+* only changed files are read. Without a usable base a new one is   *
+* built from the whole project.                                     *
+********************************************************************/
+void TrigramIndex::reset(const QString& root) {
+    clear();
+    _root = root;
+    const quint32 epoch = _epoch;
+
+    QtConcurrent::run(&_pool, [this, root, epoch] {
+        auto base = std::make_shared<TrigramSegment>();
+        if (base->open(QFile::encodeName(segmentPath(root)).toStdString())) {
+            adopt(std::move(base));
+            sync(root, {{}, {}, true}, epoch);
+        } else {
+            rebuild(root, epoch);
+        }
+    });
+}
+
+/********************************************************************
+*                               clear                        public *
+********************************************************************/
+void TrigramIndex::clear() {
+    ++_epoch;
+    _root.clear();
+    _pool.clear();
+    _pool.waitForDone();
+
+    QWriteLocker locker(&_lock);
+    _base.reset();
+    _docs.clear();
+    _dead.clear();
+    _live.clear();
+    _delta.clear();
+}
+
+/********************************************************************
+*                               update                       public *
+*-------------------------------------------------------------------*
+* Changed files (from the watcher or saved by us) are read again,   *
+* files under directories moved away are dropped.                   *
+********************************************************************/
+void TrigramIndex::update(const FileChanges& changes) {
+    if (_root.isEmpty()) {
+        return;
+    }
+    Pass pass{{}, {}, changes.overflow};
+    if (!pass.full) {
+        for (const auto& file : changes.files) {
+            if (const QString rel = ProjectWalker::relativePath(_root, file); !rel.isEmpty()) {
+                pass.files.append(rel);
+            }
+        }
+        for (const auto& dir : changes.directories) {
+            if (const QString rel = ProjectWalker::relativePath(_root, dir); !rel.isNull()) {
+                pass.dirs.append(rel);
+            }
+        }
+        if (pass.files.isEmpty() && pass.dirs.isEmpty()) {
+            return;
+        }
+    }
+
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, root = _root, pass, epoch] {
+        sync(root, pass, epoch);
+    });
+}
+
+/********************************************************************
+*                               search                       public *
+*-------------------------------------------------------------------*
+* Trigrams required by the query give candidate files (a query      *
+* without them has all files as candidates), candidates are         *
+* searched in parallel. Hits are ordered by file.                   *
+********************************************************************/
+QVector<TrigramIndex::Hit> TrigramIndex::search(const Query& query, const int limit) const {
+    if (query.text.isEmpty() || limit <= 0) {
+        return {};
+    }
+    const QByteArray needle = query.text.toUtf8();
+
+    QRegularExpression regex;
+    std::vector<uint32_t> keys;
+    if (query.regex) {
+        auto options = QRegularExpression::MultilineOption | QRegularExpression::UseUnicodePropertiesOption;
+        if (!query.caseSensitive) {
+            options |= QRegularExpression::CaseInsensitiveOption;
+        }
+        regex = QRegularExpression(query.text, options);
+        if (!regex.isValid()) {
+            return {};
+        }
+        for (const auto& literal : Trigram::literals({needle.constData(), size_t(needle.size())})) {
+            const auto some = Trigram::query(literal, query.caseSensitive);
+            keys.insert(keys.end(), some.begin(), some.end());
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    } else {
+        keys = Trigram::query({needle.constData(), size_t(needle.size())}, query.caseSensitive);
+    }
+
+    QString root;
+    std::vector<FileHits> files;
+    {
+        QReadLocker locker(&_lock);
+        if (_docs.isEmpty()) {
+            return {};
+        }
+        root = _root;
+        for (const uint32_t n : candidates(keys)) {
+            files.push_back({_docs[int(n)].path, {}});
+        }
+    }
+
+    std::atomic<int> found(0);
+    QtConcurrent::blockingMap(files, [&](FileHits& file) {
+        if (found >= limit) {
+            return;
+        }
+        QFile f(root + '/' + file.path);
+        const qint64 size = f.size();
+        if (size == 0 || size > MaxFileSize || !f.open(QIODevice::ReadOnly)) {
+            return;
+        }
+        const uchar* const data = f.map(0, size);
+        if (!data) {
+            return;
+        }
+        const std::string_view text(reinterpret_cast<const char*>(data), size_t(size));
+        if (isBinary(text)) {
+            return;
+        }
+        file.hits = query.regex ? searchRegex(file.path, text, regex, limit)
+                                : searchLiteral(file.path, text, needle, query.caseSensitive, limit);
+        found += file.hits.size();
+    });
+
+    QVector<Hit> result;
+    for (const auto& file : files) {
+        for (const auto& h : file.hits) {
+            if (result.size() >= limit) {
+                return result;
+            }
+            result.append(h);
+        }
+    }
+    return result;
+}
+
+/********************************************************************
+*                               sync                        private *
+*-------------------------------------------------------------------*
+* Runs in the pool thread. Full pass walks the whole project, the   *
+* other one checks only given files and files under directories     *
+* which do not exist anymore. Results of every batch are applied at *
+* once, queries wait only for that.                                 *
+********************************************************************/
+void TrigramIndex::sync(const QString& root, const Pass& pass, const quint32 epoch) {
+    QHash<QString, Doc> known;
+    {
+        QReadLocker locker(&_lock);
+        for (auto it = _live.cbegin(); it != _live.cend(); ++it) {
+            known.insert(it.key(), _docs[int(it.value())]);
+        }
+    }
+    auto make = [&known](const QString& path) {
+        Scan s;
+        s.path = path;
+        if (auto it = known.constFind(path); it != known.cend()) {
+            s.knownMtime = it->mtime;
+            s.knownSize = it->size;
+        }
+        return s;
+    };
+
+    QVector<Scan> all;
+    if (pass.full) {
+        QSet<QString> seen;
+        ProjectWalker::walk(root, [&](const QString& relDir, const QVector<FileSystem::Entry>& entries) {
+            if (epoch != _epoch) {
+                return false;
+            }
+            for (const auto& entry : entries) {
+                const QString name = QFile::decodeName(entry.name);
+                const QString path = relDir.isEmpty() ? name : relDir + '/' + name;
+                all.append(make(path));
+                seen.insert(path);
+            }
+            return true;
+        });
+        for (auto it = known.cbegin(); it != known.cend(); ++it) {
+            if (!seen.contains(it.key())) {
+                all.append(make(it.key()));
+            }
+        }
+    } else {
+        QSet<QString> paths(pass.files.cbegin(), pass.files.cend());
+        QHash<QString, bool> exists;
+        for (auto it = known.cbegin(); it != known.cend(); ++it) {
+            const QString parent = it.key().section('/', 0, -2);
+            for (const auto& dir : pass.dirs) {
+                if (dir.isEmpty() || parent == dir || parent.startsWith(dir + '/')) {
+                    auto found = exists.find(parent);
+                    if (found == exists.end()) {
+                        found = exists.insert(parent, QFileInfo(root + '/' + parent).isDir());
+                    }
+                    if (!found.value()) {
+                        paths.insert(it.key());
+                    }
+                    break;
+                }
+            }
+        }
+        for (const auto& path : paths) {
+            all.append(make(path));
+        }
+    }
+
+    for (auto& batch : batches(all)) {
+        QtConcurrent::blockingMap(batch, [&](Scan& s) {
+            if (epoch == _epoch) {
+                scan(root, s);
+            }
+        });
+        if (epoch != _epoch) {
+            return;
+        }
+
+        QWriteLocker locker(&_lock);
+        for (auto& s : batch) {
+            if (s.state == Scan::Unchanged) {
+                continue;
+            }
+            if (const auto it = _live.find(s.path); it != _live.end()) {
+                _dead[it.value()] = true;
+                _live.erase(it);
+            }
+            if (s.state == Scan::Changed) {
+                const auto n = quint32(_docs.size());
+                _docs.append({s.path, s.mtime, s.size});
+                _dead.push_back(false);
+                _live.insert(s.path, n);
+                for (const uint32_t key : s.trigrams) {
+                    _delta[key].push_back(n);
+                }
+            }
+        }
+    }
+
+    bool stale;
+    {
+        QReadLocker locker(&_lock);
+        const int live = _live.size();
+        stale = !_base || (_docs.size() - live > std::max(MinStale, live / 4));
+    }
+    if (stale) {
+        rebuild(root, epoch);
+        return;
+    }
+    QMetaObject::invokeMethod(this, [this, epoch] {
+        if (epoch == _epoch) {
+            emit updated();
+        }
+    }, Qt::QueuedConnection);
+}
+
+/********************************************************************
+*                              rebuild                      private *
+*-------------------------------------------------------------------*
+* Builds a new base from the whole project and switches to it.      *
+* Until then queries use the current state.                         *
+********************************************************************/
+void TrigramIndex::rebuild(const QString& root, const quint32 epoch) {
+    QVector<Scan> all;
+    ProjectWalker::walk(root, [&](const QString& relDir, const QVector<FileSystem::Entry>& entries) {
+        if (epoch != _epoch) {
+            return false;
+        }
+        for (const auto& entry : entries) {
+            const QString name = QFile::decodeName(entry.name);
+            Scan s;
+            s.path = relDir.isEmpty() ? name : relDir + '/' + name;
+            all.append(std::move(s));
+        }
+        return true;
+    });
+
+    TrigramSegment::Builder builder;
+    for (auto& batch : batches(all)) {
+        QtConcurrent::blockingMap(batch, [&](Scan& s) {
+            if (epoch == _epoch) {
+                scan(root, s);
+            }
+        });
+        if (epoch != _epoch) {
+            return;
+        }
+        for (const auto& s : batch) {
+            if (s.state == Scan::Changed) {
+                builder.add({s.path.toStdString(), s.mtime, s.size}, s.trigrams);
+            }
+        }
+    }
+
+    QDir(root).mkpath(ProjectDatabase::Dir);
+    const std::string fpath = QFile::encodeName(segmentPath(root)).toStdString();
+    auto base = std::make_shared<TrigramSegment>();
+    if (epoch != _epoch || !builder.write(fpath) || !base->open(fpath)) {
+        return;
+    }
+    adopt(std::move(base));
+
+    QMetaObject::invokeMethod(this, [this, epoch] {
+        if (epoch == _epoch) {
+            emit updated();
+        }
+    }, Qt::QueuedConnection);
+}
+
+/********************************************************************
+*                               adopt                       private *
+*-------------------------------------------------------------------*
+* The segment becomes the base, the delta is dropped.               *
+********************************************************************/
+void TrigramIndex::adopt(std::shared_ptr<const TrigramSegment> base) {
+    const quint32 count = base->docCount();
+    QVector<Doc> docs;
+    QHash<QString, quint32> live;
+    docs.reserve(int(count));
+    live.reserve(int(count));
+    for (quint32 n = 0; n < count; n++) {
+        const auto doc = base->doc(n);
+        docs.append({QString::fromStdString(doc.path), doc.mtime, doc.size});
+        live.insert(docs.last().path, n);
+    }
+
+    QWriteLocker locker(&_lock);
+    _base = std::move(base);
+    _docs = std::move(docs);
+    _dead.assign(count, false);
+    _live = std::move(live);
+    _delta.clear();
+}
+
+/********************************************************************
+*                            candidates                     private *
+*-------------------------------------------------------------------*
+* Live documents containing all the trigrams (all live documents    *
+* for none). Lists are intersected from the shortest one, posting   *
+* lists of delta follow those of the base, so lists stay sorted.    *
+* Must be called with the lock held.                                *
+********************************************************************/
+std::vector<uint32_t> TrigramIndex::candidates(const std::vector<uint32_t>& keys) const {
+    std::vector<uint32_t> result;
+    if (keys.empty()) {
+        for (uint32_t n = 0; n < uint32_t(_dead.size()); n++) {
+            if (!_dead[n]) result.push_back(n);
+        }
+        return result;
+    }
+
+    auto deltaOf = [this](const uint32_t key) -> const std::vector<uint32_t>* {
+        const auto it = _delta.find(key);
+        return (it != _delta.end()) ? &it->second : nullptr;
+    };
+    std::vector<std::pair<size_t, uint32_t>> terms;
+    for (const uint32_t key : keys) {
+        size_t count = _base ? _base->count(key) : 0;
+        if (const auto delta = deltaOf(key); delta) {
+            count += delta->size();
+        }
+        if (count == 0) {
+            return {};
+        }
+        terms.emplace_back(count, key);
+    }
+    std::sort(terms.begin(), terms.end());
+
+    std::vector<uint32_t> list;
+    std::vector<uint32_t> both;
+    for (size_t i = 0; i < terms.size(); i++) {
+        list.clear();
+        if (_base) {
+            _base->postings(terms[i].second, list);
+        }
+        if (const auto delta = deltaOf(terms[i].second); delta) {
+            list.insert(list.end(), delta->begin(), delta->end());
+        }
+        if (i == 0) {
+            result.swap(list);
+        } else {
+            both.clear();
+            std::set_intersection(result.begin(), result.end(), list.begin(), list.end(), std::back_inserter(both));
+            result.swap(both);
+        }
+        if (result.empty()) {
+            return result;
+        }
+    }
+    result.erase(std::remove_if(result.begin(), result.end(), [this](const uint32_t n) {
+        return _dead[n];
+    }), result.end());
+    return result;
+}
+
+/********************************************************************
+*                            segmentPath             private static *
+********************************************************************/
+QString TrigramIndex::segmentPath(const QString& root) {
+    return root + '/' + ProjectDatabase::Dir + "/trigram.idx";
+}
@@ -0,0 +1,116 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TrigramIndex.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_TRIGRAM_INDEX_H
+#define GOEDIT_TRIGRAM_INDEX_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+#include <QThreadPool>
+#include <QReadWriteLock>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Project/TrigramSegment.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+struct FileChanges;
+
+/********************************************************************
+*                           TrigramIndex                            *
+*-------------------------------------------------------------------*
+* Full-text index of the project for Find in Files. Files of the    *
+* base segment (.goedit/trigram.idx, memory mapped) are numbered    *
+* first, files added or changed since then get next numbers and     *
+* their posting lists live in memory (delta). Removed or changed    *
+* files of the base are only marked dead. When the delta grows too  *
+* big, a new base is built in background.                           *
+* A query intersects posting lists of its trigrams, candidate files *
+* are then searched for real, in parallel.                          *
+* Updates run in one background thread, queries in any thread.      *
+********************************************************************/
+class TrigramIndex : public QObject {
+    Q_OBJECT
+public:
+    struct Query {
+        QString text;
+        bool regex;
+        bool caseSensitive;
+    };
+    struct Hit {
+        QString path;           // relative to the project root
+        int line;               // 0-based
+        int column;             // in characters
+        int length;
+        QString text;           // the line
+    };
+private:
+    struct Doc {
+        QString path;
+        qint64 mtime;
+        qint64 size;
+    };
+    struct Pass {
+        QStringList files;      // relative paths of changed files
+        QStringList dirs;       // relative paths of changed directories
+        bool full;
+    };
+
+    QString _root;
+    std::atomic<quint32> _epoch;
+    QThreadPool _pool;
+    // guarded by _lock
+    mutable QReadWriteLock _lock;
+    std::shared_ptr<const TrigramSegment> _base;
+    QVector<Doc> _docs;
+    std::vector<bool> _dead;
+    QHash<QString, quint32> _live;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> _delta;
+public:
+    explicit TrigramIndex(QObject* = nullptr);
+    ~TrigramIndex() override;
+
+    void reset(const QString&);
+    void clear();
+    void update(const FileChanges&);
+    QVector<Hit> search(const Query&, const int) const;
+
+private:
+    void sync(const QString&, const Pass&, const quint32);
+    void rebuild(const QString&, const quint32);
+    void adopt(std::shared_ptr<const TrigramSegment>);
+    std::vector<uint32_t> candidates(const std::vector<uint32_t>&) const;
+    static QString segmentPath(const QString&);
+
+signals:
+    void updated();
+};
+
+#endif // GOEDIT_TRIGRAM_INDEX_H
@@ -0,0 +1,315 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TrigramSegment.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "TrigramSegment.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+const char TrigramSegment::Magic[8] = {'G', 'O', 'E', 'D', 'T', 'R', 'I', 'G'};
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+static inline uint64_t align8(const uint64_t n) {
+    return (n + 7) & ~uint64_t(7);
+}
+
+static inline void putVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(uint8_t(value));
+}
+
+//*******************************************************************
+//                          TrigramSegment                      CTOR
+//*******************************************************************
+TrigramSegment::TrigramSegment()
+    : _data(nullptr)
+    , _size(0)
+    , _header(nullptr)
+    , _docs(nullptr)
+    , _entries(nullptr)
+{}
+
+/********************************************************************
+*                          ~TrigramSegment                     dtor *
+********************************************************************/
+TrigramSegment::~TrigramSegment() {
+    close();
+}
+
+/********************************************************************
+*                               open                         public *
+*-------------------------------------------------------------------*
+* Maps the file. A file that is not a valid segment of this version *
+* is refused, the caller builds a new one then.                     *
+********************************************************************/
+bool TrigramSegment::open(const std::string& fpath) {
+    close();
+
+    const int fd = ::open(fpath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+    void* const data = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    _data = static_cast<const uint8_t*>(data);
+    _size = size_t(st.st_size);
+    _header = reinterpret_cast<const Header*>(_data);
+    if (!validate()) {
+        std::cerr << "TrigramSegment: invalid file " << fpath << std::endl;
+        close();
+        return false;
+    }
+    _docs = reinterpret_cast<const DocRecord*>(_data + _header->docsOffset);
+    _entries = reinterpret_cast<const Entry*>(_data + _header->entriesOffset);
+    madvise(const_cast<uint8_t*>(_data), _size, MADV_RANDOM);
+    return true;
+}
+
+/********************************************************************
+*                               close                        public *
+********************************************************************/
+void TrigramSegment::close() {
+    if (_data) {
+        munmap(const_cast<uint8_t*>(_data), _size);
+    }
+    _data = nullptr;
+    _size = 0;
+    _header = nullptr;
+    _docs = nullptr;
+    _entries = nullptr;
+}
+
+/********************************************************************
+*                                doc                         public *
+********************************************************************/
+TrigramSegment::Doc TrigramSegment::doc(const uint32_t n) const {
+    const DocRecord& rec = _docs[n];
+    const char* const name = reinterpret_cast<const char*>(_data + _header->namesOffset + rec.nameOffset);
+    return {std::string(name, rec.nameLength), rec.mtime, rec.size};
+}
+
+/********************************************************************
+*                               count                        public *
+*-------------------------------------------------------------------*
+* Number of documents containing the trigram.                       *
+********************************************************************/
+uint32_t TrigramSegment::count(const uint32_t key) const {
+    const Entry* const entry = find(key);
+    return entry ? entry->count : 0;
+}
+
+/********************************************************************
+*                             postings                       public *
+*-------------------------------------------------------------------*
+* Appends (ascending) numbers of documents containing the trigram.  *
+********************************************************************/
+void TrigramSegment::postings(const uint32_t key, std::vector<uint32_t>& out) const {
+    const Entry* const entry = find(key);
+    if (!entry) {
+        return;
+    }
+    const uint8_t* p = _data + _header->postingsOffset + entry->offset;
+    const uint8_t* const end = p + entry->length;
+
+    out.reserve(out.size() + entry->count);
+    uint32_t doc = 0;
+    while (p < end) {
+        uint32_t delta = 0;
+        int shift = 0;
+        while (p < end) {
+            const uint8_t byte = *p++;
+            delta |= uint32_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) break;
+            shift += 7;
+        }
+        doc += delta;
+        out.push_back(doc);
+    }
+}
+
+/********************************************************************
+*                              validate                     private *
+*-------------------------------------------------------------------*
+* Sections must be inside the file, in order and not overlapping,   *
+* so a damaged file can't make us read outside the mapping.         *
+********************************************************************/
+bool TrigramSegment::validate() const {
+    const Header& h = *_header;
+    if (memcmp(h.magic, Magic, sizeof(Magic)) != 0 || h.version != Version || h.fileSize != _size) {
+        return false;
+    }
+    if (h.docsOffset != sizeof(Header)
+        || h.namesOffset != h.docsOffset + uint64_t(h.docCount) * sizeof(DocRecord)
+        || h.entriesOffset < h.namesOffset
+        || h.postingsOffset != h.entriesOffset + uint64_t(h.trigramCount) * sizeof(Entry)
+        || h.postingsOffset > _size
+        || h.entriesOffset % 8 != 0) {
+        return false;
+    }
+
+    const uint64_t namesSize = h.entriesOffset - h.namesOffset;
+    const auto docs = reinterpret_cast<const DocRecord*>(_data + h.docsOffset);
+    for (uint32_t i = 0; i < h.docCount; i++) {
+        if (docs[i].nameOffset + docs[i].nameLength > namesSize) {
+            return false;
+        }
+    }
+    const uint64_t postingsSize = _size - h.postingsOffset;
+    const auto entries = reinterpret_cast<const Entry*>(_data + h.entriesOffset);
+    for (uint32_t i = 0; i < h.trigramCount; i++) {
+        if (entries[i].offset + entries[i].length > postingsSize) {
+            return false;
+        }
+        if (i > 0 && entries[i - 1].key >= entries[i].key) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/********************************************************************
+*                               find                        private *
+********************************************************************/
+const TrigramSegment::Entry* TrigramSegment::find(const uint32_t key) const {
+    if (!_entries) {
+        return nullptr;
+    }
+    const Entry* const end = _entries + _header->trigramCount;
+    const Entry* const it = std::lower_bound(_entries, end, key, [](const Entry& e, const uint32_t k) {
+        return e.key < k;
+    });
+    return (it != end && it->key == key) ? it : nullptr;
+}
+
+/********************************************************************
+*                                add                         public *
+*-------------------------------------------------------------------*
+* Adds the document with its distinct trigrams, returns its number. *
+********************************************************************/
+uint32_t TrigramSegment::Builder::add(Doc doc, const std::vector<uint32_t>& trigrams) {
+    const auto n = uint32_t(_docs.size());
+    _docs.push_back(std::move(doc));
+
+    for (const uint32_t key : trigrams) {
+        List& list = _lists[key];
+        putVarint(list.bytes, list.count ? n - list.last : n);
+        list.last = n;
+        list.count++;
+    }
+    return n;
+}
+
+/********************************************************************
+*                               write                        public *
+*-------------------------------------------------------------------*
+* Writes into a temporary file renamed over the target at the end,  *
+* so a segment mapped by somebody else stays intact.                *
+********************************************************************/
+bool TrigramSegment::Builder::write(const std::string& fpath) const {
+    std::vector<uint32_t> keys;
+    keys.reserve(_lists.size());
+    for (const auto& item : _lists) {
+        keys.push_back(item.first);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    Header header{};
+    memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.docCount = uint32_t(_docs.size());
+    header.trigramCount = uint32_t(keys.size());
+
+    std::string names;
+    std::vector<DocRecord> docs;
+    docs.reserve(_docs.size());
+    for (const auto& doc : _docs) {
+        docs.push_back({uint64_t(names.size()), uint32_t(doc.path.size()), 0, doc.mtime, doc.size});
+        names += doc.path;
+    }
+    names.resize(size_t(align8(names.size())), '\0');
+
+    std::vector<Entry> entries;
+    entries.reserve(keys.size());
+    uint64_t offset = 0;
+    for (const uint32_t key : keys) {
+        const List& list = _lists.at(key);
+        entries.push_back({key, list.count, offset, uint64_t(list.bytes.size())});
+        offset += list.bytes.size();
+    }
+
+    header.docsOffset = sizeof(Header);
+    header.namesOffset = header.docsOffset + docs.size() * sizeof(DocRecord);
+    header.entriesOffset = header.namesOffset + names.size();
+    header.postingsOffset = header.entriesOffset + entries.size() * sizeof(Entry);
+    header.fileSize = header.postingsOffset + offset;
+
+    const std::string tmp = fpath + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(docs.data()), std::streamsize(docs.size() * sizeof(DocRecord)));
+        out.write(names.data(), std::streamsize(names.size()));
+        out.write(reinterpret_cast<const char*>(entries.data()), std::streamsize(entries.size() * sizeof(Entry)));
+        for (const uint32_t key : keys) {
+            const auto& bytes = _lists.at(key).bytes;
+            out.write(reinterpret_cast<const char*>(bytes.data()), std::streamsize(bytes.size()));
+        }
+        if (!out.flush()) {
+            std::cerr << "TrigramSegment: can't write " << tmp << std::endl;
+            std::remove(tmp.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp.c_str(), fpath.c_str()) != 0) {
+        std::cerr << "TrigramSegment: can't rename " << tmp << std::endl;
+        std::remove(tmp.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,137 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TrigramSegment.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_TRIGRAM_SEGMENT_H
+#define GOEDIT_TRIGRAM_SEGMENT_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/********************************************************************
+*                          TrigramSegment                           *
+*-------------------------------------------------------------------*
+* Immutable trigram index of a set of files, stored in a file and   *
+* memory mapped, so opening costs nothing and pages are read only   *
+* when a query touches them. Layout (all sections 8-byte aligned):  *
+*   Header                                                          *
+*   DocRecord[docCount]      path, mtime and size of every file     *
+*   names                    paths (UTF-8) referenced by documents  *
+*   Entry[trigramCount]      sorted by trigram                      *
+*   postings                 ascending document numbers, varint     *
+*                            coded differences                      *
+********************************************************************/
+class TrigramSegment {
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t docCount;
+        uint32_t trigramCount;
+        uint32_t reserved;
+        uint64_t docsOffset;
+        uint64_t namesOffset;
+        uint64_t entriesOffset;
+        uint64_t postingsOffset;
+        uint64_t fileSize;
+    };
+    struct DocRecord {
+        uint64_t nameOffset;
+        uint32_t nameLength;
+        uint32_t reserved;
+        int64_t mtime;
+        int64_t size;
+    };
+    struct Entry {
+        uint32_t key;
+        uint32_t count;
+        uint64_t offset;
+        uint64_t length;
+    };
+
+    static constexpr uint32_t Version = 1;
+    static const char Magic[8];
+
+    const uint8_t* _data;
+    size_t _size;
+    const Header* _header;
+    const DocRecord* _docs;
+    const Entry* _entries;
+public:
+    struct Doc {
+        std::string path;       // relative to the project root
+        int64_t mtime;
+        int64_t size;
+    };
+    class Builder;
+
+    TrigramSegment();
+    ~TrigramSegment();
+    TrigramSegment(const TrigramSegment&) = delete;
+    TrigramSegment& operator=(const TrigramSegment&) = delete;
+
+    bool open(const std::string&);
+    void close();
+    bool isOpen() const {
+        return _data != nullptr;
+    }
+    uint32_t docCount() const {
+        return _header ? _header->docCount : 0;
+    }
+    Doc doc(const uint32_t) const;
+    uint32_t count(const uint32_t) const;
+    void postings(const uint32_t, std::vector<uint32_t>&) const;
+
+private:
+    bool validate() const;
+    const Entry* find(const uint32_t) const;
+};
+
+/********************************************************************
+*                      TrigramSegment::Builder                      *
+*-------------------------------------------------------------------*
+* Collects documents (in the order of their numbers) with their     *
+* distinct trigrams and writes a segment file. Posting lists are    *
+* kept coded already, so memory stays close to the file size.       *
+********************************************************************/
+class TrigramSegment::Builder {
+    struct List {
+        uint32_t last;
+        uint32_t count;
+        std::vector<uint8_t> bytes;
+    };
+
+    std::vector<Doc> _docs;
+    std::unordered_map<uint32_t, List> _lists;
+public:
+    uint32_t add(Doc, const std::vector<uint32_t>&);
+    bool write(const std::string&) const;
+    size_t size() const {
+        return _docs.size();
+    }
+};
+
+#endif // GOEDIT_TRIGRAM_SEGMENT_H
@@ -0,0 +1,441 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Diff.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <unordered_map>
+#include "Diff.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int MinBisectCost = 256;   // steps of bisection before the heuristic split
+
+/*------- local types:
+-------------------------------------------------------------------*/
+namespace {
+    // Lines [x0, x1) of the old text against lines [y0, y1) of the new.
+    struct Range {
+        int x0;
+        int x1;
+        int y0;
+        int y1;
+        bool anchored;      // no patience anchors inside, bisect only
+    };
+}
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+
+// Lines occurring exactly once in both parts of the range, paired in
+// order: longest increasing subsequence of their new positions found
+// by patience sorting.
+static std::vector<std::pair<int, int>> anchors(const std::vector<int>& x, const std::vector<int>& y, const Range& r) {
+    struct Count {
+        int inX = 0;
+        int inY = 0;
+        int posY = 0;
+    };
+    std::unordered_map<int, Count> counts;
+    for (int i = r.x0; i < r.x1; i++) {
+        ++counts[x[size_t(i)]].inX;
+    }
+    for (int j = r.y0; j < r.y1; j++) {
+        if (auto it = counts.find(y[size_t(j)]); it != counts.end()) {
+            ++it->second.inY;
+            it->second.posY = j;
+        }
+    }
+    std::vector<std::pair<int, int>> unique;
+    for (int i = r.x0; i < r.x1; i++) {
+        const Count& count = counts[x[size_t(i)]];
+        if (count.inX == 1 && count.inY == 1) {
+            unique.emplace_back(i, count.posY);
+        }
+    }
+
+    std::vector<int> tails;     // of piles, indexes to 'unique'
+    std::vector<int> prev(unique.size(), -1);
+    for (int i = 0; i < int(unique.size()); i++) {
+        auto it = std::lower_bound(tails.begin(), tails.end(), unique[size_t(i)].second, [&unique](const int idx, const int pos) {
+            return unique[size_t(idx)].second < pos;
+        });
+        if (it != tails.begin()) {
+            prev[size_t(i)] = *(it - 1);
+        }
+        if (it == tails.end()) {
+            tails.push_back(i);
+        } else {
+            *it = i;
+        }
+    }
+    std::vector<std::pair<int, int>> result(tails.size());
+    int k = int(tails.size()) - 1;
+    for (int i = tails.empty() ? -1 : tails.back(); i >= 0; i = prev[size_t(i)]) {
+        result[size_t(k--)] = unique[size_t(i)];
+    }
+    return result;
+}
+
+// Middle snake of the range (Myers' linear space refinement): the point
+// (sx, sy) where the forward and the backward search meet lies on a
+// shortest edit path. Beyond 'limit' steps the furthest forward point
+// is taken, the path is no longer the shortest then, but the time is
+// bounded. False when cancelled or no inner point was found.
+static bool bisect(const std::vector<int>& x, const std::vector<int>& y, const Range& r, const int limit,
+                   const std::atomic<bool>& cancel, int& sx, int& sy) {
+    const int n = r.x1 - r.x0;
+    const int m = r.y1 - r.y0;
+    const int maxD = (n + m + 1) / 2;
+    const int offset = std::min(maxD, limit + 1) + 1;
+    std::vector<int> v1(size_t(2 * offset + 2), -1);
+    std::vector<int> v2(size_t(2 * offset + 2), -1);
+    v1[size_t(offset + 1)] = 0;
+    v2[size_t(offset + 1)] = 0;
+    const int delta = n - m;
+    const bool front = (delta % 2 != 0);
+    auto a = [&x, &r](const int i) {
+        return x[size_t(r.x0 + i)];
+    };
+    auto b = [&y, &r](const int j) {
+        return y[size_t(r.y0 + j)];
+    };
+
+    int k1start = 0;
+    int k1end = 0;
+    int k2start = 0;
+    int k2end = 0;
+    for (int d = 0; d < maxD; d++) {
+        if (cancel) {
+            return false;
+        }
+        if (d > limit) {
+            int best = -1;
+            for (int k = -(d - 1); k <= d - 1; k += 2) {
+                const int px = v1[size_t(offset + k)];
+                const int py = px - k;
+                if (px >= 0 && px <= n && py >= 0 && py <= m && px + py > best && px + py < n + m) {
+                    best = px + py;
+                    sx = px;
+                    sy = py;
+                }
+            }
+            if (best <= 0) {
+                return false;
+            }
+            sx += r.x0;
+            sy += r.y0;
+            return true;
+        }
+
+        for (int k1 = -d + k1start; k1 <= d - k1end; k1 += 2) {
+            const size_t k1off = size_t(offset + k1);
+            int x1 = (k1 == -d || (k1 != d && v1[k1off - 1] < v1[k1off + 1])) ? v1[k1off + 1] : v1[k1off - 1] + 1;
+            int y1 = x1 - k1;
+            while (x1 < n && y1 < m && a(x1) == b(y1)) {
+                ++x1;
+                ++y1;
+            }
+            v1[k1off] = x1;
+            if (x1 > n) {
+                k1end += 2;         // off the right edge
+            } else if (y1 > m) {
+                k1start += 2;       // off the bottom
+            } else if (front) {
+                const int k2off = offset + delta - k1;
+                if (k2off >= 0 && k2off < int(v2.size()) && v2[size_t(k2off)] != -1 && x1 >= n - v2[size_t(k2off)]) {
+                    sx = r.x0 + x1;
+                    sy = r.y0 + y1;
+                    return true;
+                }
+            }
+        }
+
+        for (int k2 = -d + k2start; k2 <= d - k2end; k2 += 2) {
+            const size_t k2off = size_t(offset + k2);
+            int x2 = (k2 == -d || (k2 != d && v2[k2off - 1] < v2[k2off + 1])) ? v2[k2off + 1] : v2[k2off - 1] + 1;
+            int y2 = x2 - k2;
+            while (x2 < n && y2 < m && a(n - x2 - 1) == b(m - y2 - 1)) {
+                ++x2;
+                ++y2;
+            }
+            v2[k2off] = x2;
+            if (x2 > n) {
+                k2end += 2;
+            } else if (y2 > m) {
+                k2start += 2;
+            } else if (!front) {
+                const int k1off = offset + delta - k2;
+                if (k1off >= 0 && k1off < int(v1.size()) && v1[size_t(k1off)] != -1) {
+                    const int x1 = v1[size_t(k1off)];
+                    if (x1 >= n - x2) {
+                        sx = r.x0 + x1;
+                        sy = r.y0 + x1 - (k1off - offset);
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/********************************************************************
+*                               lines                 public static *
+********************************************************************/
+std::vector<Diff::Hunk> Diff::lines(const std::vector<std::string_view>& a, const std::vector<std::string_view>& b) {
+    const int n = int(a.size());
+    const int m = int(b.size());
+    int head = 0;
+    while (head < n && head < m && a[size_t(head)] == b[size_t(head)]) {
+        ++head;
+    }
+    int tail = 0;
+    while (tail < n - head && tail < m - head && a[size_t(n - 1 - tail)] == b[size_t(m - 1 - tail)]) {
+        ++tail;
+    }
+
+    std::unordered_map<std::string_view, int> ids;
+    auto numbers = [&ids, head, tail](const std::vector<std::string_view>& lines) {
+        std::vector<int> result;
+        result.reserve(lines.size() - size_t(head + tail));
+        for (size_t i = size_t(head); i < lines.size() - size_t(tail); i++) {
+            result.push_back(ids.emplace(lines[i], int(ids.size())).first->second);
+        }
+        return result;
+    };
+    const std::vector<int> x = numbers(a);
+    const std::vector<int> y = numbers(b);
+    return myers(x, y, head);
+}
+
+/********************************************************************
+*                              compare                public static *
+*-------------------------------------------------------------------*
+* Ranges wait on a stack (no recursion, texts may be huge). A range *
+* is first split at its patience anchors; a range without anchors   *
+* is bisected. Changed lines are only marked, hunks are made of the *
+* marks at the end. False when cancelled.                           *
+********************************************************************/
+bool Diff::compare(const std::vector<std::string_view>& a, const std::vector<std::string_view>& b,
+                   std::vector<Hunk>& hunks, const std::atomic<bool>& cancel) {
+    hunks.clear();
+    const int n = int(a.size());
+    const int m = int(b.size());
+
+    std::unordered_map<std::string_view, int> ids;
+    std::vector<int> x;
+    std::vector<int> y;
+    x.reserve(a.size());
+    y.reserve(b.size());
+    for (const auto& line : a) {
+        x.push_back(ids.emplace(line, int(ids.size())).first->second);
+    }
+    for (const auto& line : b) {
+        y.push_back(ids.emplace(line, int(ids.size())).first->second);
+    }
+    ids = {};
+
+    const int limit = std::max(MinBisectCost, int(std::sqrt(double(n + m))));
+    std::vector<char> removed(a.size(), 0);
+    std::vector<char> added(b.size(), 0);
+    std::vector<Range> stack{{0, n, 0, m, false}};
+    while (!stack.empty()) {
+        if (cancel) {
+            return false;
+        }
+        Range r = stack.back();
+        stack.pop_back();
+        while (r.x0 < r.x1 && r.y0 < r.y1 && x[size_t(r.x0)] == y[size_t(r.y0)]) {
+            ++r.x0;
+            ++r.y0;
+        }
+        while (r.x0 < r.x1 && r.y0 < r.y1 && x[size_t(r.x1 - 1)] == y[size_t(r.y1 - 1)]) {
+            --r.x1;
+            --r.y1;
+        }
+        if (r.x0 == r.x1 || r.y0 == r.y1) {
+            std::fill(removed.begin() + r.x0, removed.begin() + r.x1, 1);
+            std::fill(added.begin() + r.y0, added.begin() + r.y1, 1);
+            continue;
+        }
+
+        if (!r.anchored) {
+            if (const auto matched = anchors(x, y, r); !matched.empty()) {
+                int px = r.x0;
+                int py = r.y0;
+                for (const auto& [ax, ay] : matched) {
+                    stack.push_back({px, ax, py, ay, false});
+                    px = ax + 1;
+                    py = ay + 1;
+                }
+                stack.push_back({px, r.x1, py, r.y1, false});
+                continue;
+            }
+        }
+        int sx = 0;
+        int sy = 0;
+        if (bisect(x, y, r, limit, cancel, sx, sy)) {
+            stack.push_back({r.x0, sx, r.y0, sy, true});
+            stack.push_back({sx, r.x1, sy, r.y1, true});
+        } else {
+            std::fill(removed.begin() + r.x0, removed.begin() + r.x1, 1);
+            std::fill(added.begin() + r.y0, added.begin() + r.y1, 1);
+        }
+    }
+    if (cancel) {
+        return false;
+    }
+
+    // Unchanged lines pair up in order, runs of changes between them are hunks.
+    int i = 0;
+    int j = 0;
+    while (i < n || j < m) {
+        if (i < n && j < m && !removed[size_t(i)] && !added[size_t(j)]) {
+            ++i;
+            ++j;
+            continue;
+        }
+        const int oldStart = i;
+        const int newStart = j;
+        while (i < n && removed[size_t(i)]) {
+            ++i;
+        }
+        while (j < m && added[size_t(j)]) {
+            ++j;
+        }
+        if (i == oldStart && j == newStart) {
+            break;
+        }
+        hunks.push_back({oldStart, i - oldStart, newStart, j - newStart});
+    }
+    return true;
+}
+
+/********************************************************************
+*                               split                 public static *
+*-------------------------------------------------------------------*
+* Lines of the text without '\n'. The text after the last '\n' is   *
+* the last line (empty when the text ends with '\n'), like blocks   *
+* of QTextDocument.                                                 *
+********************************************************************/
+std::vector<std::string_view> Diff::split(std::string_view text) {
+    std::vector<std::string_view> result;
+    size_t begin = 0;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\n') {
+            result.push_back(text.substr(begin, i - begin));
+            begin = i + 1;
+        }
+    }
+    result.push_back(text.substr(begin));
+    return result;
+}
+
+/********************************************************************
+*                               myers                private static *
+*-------------------------------------------------------------------*
+* Greedy forward search; V of every step d (diagonals -d..d) is     *
+* kept for the backtrack, O(D^2) memory. Edits found backwards are  *
+* then merged into hunks. 'offset' is added to all line numbers.    *
+********************************************************************/
+std::vector<Diff::Hunk> Diff::myers(const std::vector<int>& x, const std::vector<int>& y, const int offset) {
+    const int n = int(x.size());
+    const int m = int(y.size());
+    if (n == 0 && m == 0) {
+        return {};
+    }
+    if (n == 0 || m == 0) {
+        return {{offset, n, offset, m}};
+    }
+
+    const int max = n + m;
+    std::vector<int> v(size_t(2 * max + 2), 0);
+    std::vector<std::vector<int>> trace;
+    auto at = [max](const int k) {
+        return size_t(k + max);
+    };
+
+    int cost = -1;
+    for (int d = 0; d <= max && d <= MaxCost && cost < 0; d++) {
+        for (int k = -d; k <= d; k += 2) {
+            int px = (k == -d || (k != d && v[at(k - 1)] < v[at(k + 1)])) ? v[at(k + 1)] : v[at(k - 1)] + 1;
+            int py = px - k;
+            while (px < n && py < m && x[size_t(px)] == y[size_t(py)]) {
+                ++px;
+                ++py;
+            }
+            v[at(k)] = px;
+            if (px >= n && py >= m) {
+                cost = d;
+            }
+        }
+        trace.emplace_back(v.begin() + ptrdiff_t(at(-d)), v.begin() + ptrdiff_t(at(d) + 1));
+    }
+    if (cost < 0) {
+        return {{offset, n, offset, m}};
+    }
+
+    // Backtrack: one deletion or insertion per step, collected backwards.
+    struct Edit {
+        bool insert;
+        int x;
+        int y;
+    };
+    std::vector<Edit> edits;
+    int px = n;
+    int py = m;
+    for (int d = cost; d > 0; d--) {
+        const std::vector<int>& prev = trace[size_t(d - 1)];
+        auto value = [&prev, d](const int k) {
+            return prev[size_t(k + d - 1)];
+        };
+        const int k = px - py;
+        const bool insert = (k == -d || (k != d && value(k - 1) < value(k + 1)));
+        const int prevK = insert ? k + 1 : k - 1;
+        const int prevX = value(prevK);
+        const int prevY = prevX - prevK;
+        edits.push_back({insert, prevX, prevY});
+        px = prevX;
+        py = prevY;
+    }
+
+    std::vector<Hunk> hunks;
+    for (auto it = edits.rbegin(); it != edits.rend(); ++it) {
+        Hunk* last = hunks.empty() ? nullptr : &hunks.back();
+        if (!last || last->oldStart + last->oldCount != it->x + offset || last->newStart + last->newCount != it->y + offset) {
+            hunks.push_back({it->x + offset, 0, it->y + offset, 0});
+            last = &hunks.back();
+        }
+        if (it->insert) {
+            ++last->newCount;
+        } else {
+            ++last->oldCount;
+        }
+    }
+    return hunks;
+}
@@ -0,0 +1,73 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Diff.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DIFF_H
+#define GOEDIT_DIFF_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <atomic>
+#include <string_view>
+#include <vector>
+
+/********************************************************************
+*                               Diff                                *
+*-------------------------------------------------------------------*
+* Line diff (Myers, O(ND)). Common head and tail are cut off first  *
+* and lines are compared as numbers, so diffs of small changes in   *
+* big files are cheap. When the texts differ too much (MaxCost) the *
+* rest is reported as one changed block instead of searching for    *
+* the shortest script.                                              *
+* compare() is meant for whole files of any size (the diff view):   *
+* unique lines common to both texts split them first (patience),    *
+* the rest is diffed by Myers' linear space bisection. Its memory   *
+* is O(N + M) and it can be cancelled.                              *
+********************************************************************/
+class Diff {
+public:
+    static constexpr int MaxCost = 2000;
+
+    // Lines [oldStart, oldStart + oldCount) of the old text are
+    // replaced by lines [newStart, newStart + newCount) of the new.
+    struct Hunk {
+        int oldStart;
+        int oldCount;
+        int newStart;
+        int newCount;
+    };
+
+    Diff() = delete;
+    ~Diff() = delete;
+    Diff(const Diff&) = delete;
+    Diff(const Diff&&) = delete;
+
+    static std::vector<Hunk> lines(const std::vector<std::string_view>&, const std::vector<std::string_view>&);
+    static bool compare(const std::vector<std::string_view>&, const std::vector<std::string_view>&,
+                        std::vector<Hunk>&, const std::atomic<bool>&);
+    static std::vector<std::string_view> split(std::string_view);
+private:
+    static std::vector<Hunk> myers(const std::vector<int>&, const std::vector<int>&, const int);
+};
+
+#endif // GOEDIT_DIFF_H
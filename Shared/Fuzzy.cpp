@@ -0,0 +1,143 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Fuzzy.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "Fuzzy.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int MatchScore       = 16;
+static constexpr int BoundaryBonus    = 12;
+static constexpr int ConsecutiveBonus = 8;
+static constexpr int NameBonus        = 4;
+static constexpr int NameStartBonus   = 12;
+static constexpr int GapPenalty       = 1;
+
+/********************************************************************
+*                            isBoundary                       local *
+*-------------------------------------------------------------------*
+* Start of a word: after a separator or an upper case letter after  *
+* a lower case one (camelCase).                                     *
+********************************************************************/
+static inline bool isBoundary(const char prev, const char c) {
+    switch (prev) {
+    case '/': case '_': case '-': case '.': case ' ':
+        return true;
+    }
+    return (prev >= 'a' && prev <= 'z') && (c >= 'A' && c <= 'Z');
+}
+
+/********************************************************************
+*                            subsequence                      local *
+*-------------------------------------------------------------------*
+* Position of the last character of the earliest match of the       *
+* pattern in text starting at 'from', or npos.                      *
+********************************************************************/
+static size_t subsequence(std::string_view pattern, std::string_view text, const size_t from) {
+    size_t pi = 0;
+    for (size_t i = from; i < text.size(); i++) {
+        if (Fuzzy::lower(text[i]) == pattern[pi]) {
+            if (++pi == pattern.size()) {
+                return i;
+            }
+        }
+    }
+    return std::string_view::npos;
+}
+
+/********************************************************************
+*                               mask                  public static *
+********************************************************************/
+uint64_t Fuzzy::mask(std::string_view text) {
+    uint64_t result = 0;
+    for (const char c : text) {
+        result |= bit(c);
+    }
+    return result;
+}
+
+/********************************************************************
+*                               score                 public static *
+*-------------------------------------------------------------------*
+* 'pattern' must be lower case. Characters of 'text' from the       *
+* position 'nameStart' form the name (e.g. file name in a path),    *
+* matches there are worth more. The match is searched first inside *
+* the name, then in the whole text; the window found by the forward *
+* scan is shrunk by the backward scan (like fzf v1 does).           *
+* Returns NoMatch or a score, the bigger the better.                *
+********************************************************************/
+int Fuzzy::score(std::string_view pattern, std::string_view text, const size_t nameStart) {
+    if (pattern.empty()) {
+        return 0;
+    }
+
+    size_t from = (nameStart < text.size()) ? nameStart : 0;
+    size_t end = subsequence(pattern, text, from);
+    if (end == std::string_view::npos && from != 0) {
+        from = 0;
+        end = subsequence(pattern, text, 0);
+    }
+    if (end == std::string_view::npos) {
+        return NoMatch;
+    }
+
+    size_t start = end;
+    for (size_t i = end + 1, pi = pattern.size(); i-- > from; ) {
+        if (lower(text[i]) == pattern[pi - 1]) {
+            start = i;
+            if (--pi == 0) {
+                break;
+            }
+        }
+    }
+
+    int result = 0;
+    int run = 0;
+    size_t pi = 0;
+    for (size_t i = start; i <= end && pi < pattern.size(); i++) {
+        if (lower(text[i]) != pattern[pi]) {
+            run = 0;
+            result -= GapPenalty;
+            continue;
+        }
+        int s = MatchScore;
+        if (i == 0 || isBoundary(text[i - 1], text[i])) {
+            s += BoundaryBonus;
+        }
+        if (run > 0) {
+            s += ConsecutiveBonus;
+        }
+        if (i >= nameStart) {
+            s += (i == nameStart) ? NameStartBonus : NameBonus;
+        }
+        result += s;
+        ++run;
+        ++pi;
+    }
+    // among equal matches prefer shorter texts
+    result -= int((text.size() - start) >> 3);
+    return (result > 0) ? result : 1;
+}
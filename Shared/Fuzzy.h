@@ -0,0 +1,70 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Fuzzy.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FUZZY_H
+#define GOEDIT_FUZZY_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <string_view>
+
+/********************************************************************
+*                               Fuzzy                               *
+*-------------------------------------------------------------------*
+* Fuzzy (subsequence) matching used by the quick-open kind of       *
+* lookups. The character mask is a cheap necessary condition:       *
+* text can match the pattern only if its mask contains the mask of  *
+* the pattern, so most candidates are rejected by one AND.          *
+********************************************************************/
+class Fuzzy {
+public:
+    static constexpr int NoMatch = -1;
+
+    Fuzzy() = delete;
+    ~Fuzzy() = delete;
+    Fuzzy(const Fuzzy&) = delete;
+    Fuzzy(const Fuzzy&&) = delete;
+
+    static uint64_t mask(std::string_view);
+    static int score(std::string_view, std::string_view, const size_t = 0);
+
+    static inline char lower(const char c) {
+        return (c >= 'A' && c <= 'Z') ? char(c + ('a' - 'A')) : c;
+    }
+    static inline uint64_t bit(const char ch) {
+        const auto c = static_cast<unsigned char>(lower(ch));
+        if (c >= 'a' && c <= 'z') return uint64_t(1) << (c - 'a');
+        if (c >= '0' && c <= '9') return uint64_t(1) << (26 + c - '0');
+        switch (c) {
+        case '_': return uint64_t(1) << 36;
+        case '-': return uint64_t(1) << 37;
+        case '.': return uint64_t(1) << 38;
+        case '/': return uint64_t(1) << 39;
+        }
+        return uint64_t(1) << (40 + c % 24);
+    }
+};
+
+#endif // GOEDIT_FUZZY_H
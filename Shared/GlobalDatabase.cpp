@@ -0,0 +1,136 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GlobalDatabase.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QDebug>
+#include "GlobalDatabase.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static const char* const Schema = R"(
+CREATE TABLE recent (
+    kind INTEGER NOT NULL,
+    path TEXT NOT NULL,
+    used INTEGER NOT NULL,
+    PRIMARY KEY (kind, path)
+);
+CREATE INDEX recent_used ON recent (kind, used);
+)";
+
+// Added in version 2.
+static const char* const SettingsTable = R"(
+CREATE TABLE settings (
+    id   INTEGER PRIMARY KEY,
+    data BLOB NOT NULL
+);
+)";
+
+using namespace beesoft::sqlite;
+
+/********************************************************************
+*                               open                  public static *
+*-------------------------------------------------------------------*
+* Opens the database, creating it if needed. Does nothing when it   *
+* is already open.                                                  *
+********************************************************************/
+bool GlobalDatabase::open() {
+    auto& db = SQLite::global();
+    if (db.isOpen()) {
+        return true;
+    }
+    const QString fpath = path();
+    if (!QDir().mkpath(QFileInfo(fpath).path())) {
+        qWarning() << "GlobalDatabase: can't create" << QFileInfo(fpath).path();
+        return false;
+    }
+
+    const std::string name = QFile::encodeName(fpath).toStdString();
+    if (db.open(name)) {
+        const auto rows = db.select("PRAGMA user_version");
+        const i64 version = rows.empty() ? 0 : rows[0][0].as_i64();
+        if (version == Version || (version == 1 && upgrade())) {
+            db.exec("PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL");
+            return true;
+        }
+        db.close();
+    }
+    return create(name);
+}
+
+/********************************************************************
+*                               close                 public static *
+********************************************************************/
+void GlobalDatabase::close() {
+    SQLite::global().close();
+}
+
+/********************************************************************
+*                               path                  public static *
+********************************************************************/
+QString GlobalDatabase::path() {
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/goedit.db";
+}
+
+/********************************************************************
+*                              create                private static *
+********************************************************************/
+bool GlobalDatabase::create(const std::string& fpath) {
+    for (const char* suffix : {"-wal", "-shm"}) {
+        QFile::remove(QFile::decodeName(fpath + suffix));
+    }
+
+    auto& db = SQLite::global();
+    const bool ok = db.create(fpath, [](SQLite& db) {
+        return db.exec(Schema)
+               && db.exec(SettingsTable)
+               && db.exec("PRAGMA user_version=" + std::to_string(Version))
+               && db.exec("PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL");
+    }, true);
+    if (!ok) {
+        qWarning() << "GlobalDatabase: can't create" << QFile::decodeName(fpath);
+        db.close();
+    }
+    return ok;
+}
+
+/********************************************************************
+*                              upgrade               private static *
+*-------------------------------------------------------------------*
+* Version 1 had no settings. Its recent lists are worth keeping, so *
+* the table is added instead of creating the database anew.         *
+********************************************************************/
+bool GlobalDatabase::upgrade() {
+    return SQLite::global().transaction([](SQLite& db) {
+        return db.exec(SettingsTable)
+               && db.exec("PRAGMA user_version=" + std::to_string(Version));
+    });
+}
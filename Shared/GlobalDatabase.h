@@ -0,0 +1,58 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GlobalDatabase.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_GLOBAL_DATABASE_H
+#define GOEDIT_GLOBAL_DATABASE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <string>
+
+/********************************************************************
+*                          GlobalDatabase                           *
+*-------------------------------------------------------------------*
+* SQLite database of the application (SQLite::global), kept in the  *
+* application data directory of the user. It holds what does not    *
+* belong to any project, like the lists of recent files and the     *
+* settings of the user.                                             *
+********************************************************************/
+class GlobalDatabase {
+public:
+    static constexpr int Version = 2;
+
+    GlobalDatabase() = delete;
+    ~GlobalDatabase() = delete;
+    GlobalDatabase(const GlobalDatabase&) = delete;
+    GlobalDatabase(const GlobalDatabase&&) = delete;
+
+    static bool open();
+    static void close();
+    static QString path();
+private:
+    static bool create(const std::string&);
+    static bool upgrade();
+};
+
+#endif // GOEDIT_GLOBAL_DATABASE_H
@@ -0,0 +1,210 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : RecentStore.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFileInfo>
+#include <QDateTime>
+#include <QtConcurrent>
+#include <QDebug>
+#include "RecentStore.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+using namespace beesoft::sqlite;
+
+//*******************************************************************
+//                            RecentStore                       CTOR
+//*******************************************************************
+RecentStore::RecentStore(const Kind kind, QObject* parent)
+    : QObject(parent)
+    , _kind(kind)
+    , _clock(0)
+{
+    // One thread: writes reach the database in the order of touches.
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                           ~RecentStore                       dtor *
+********************************************************************/
+RecentStore::~RecentStore() {
+    wait();
+}
+
+/********************************************************************
+*                               load                         public *
+*-------------------------------------------------------------------*
+* Reads the paths from the database (open already) in order of use. *
+* Paths touched before the load are more recent than all the read   *
+* ones and stay at the head of the list.                            *
+********************************************************************/
+void RecentStore::load() {
+    wait();
+    auto& db = SQLite::global();
+    if (!db.isOpen()) {
+        return;
+    }
+    const auto rows = db.select("SELECT path, used FROM recent WHERE kind = :kind ORDER BY used DESC LIMIT "
+                                + std::to_string(Capacity),
+                                {Field("kind", i64(_kind))});
+    for (const auto& row : rows) {
+        const QString path = QString::fromStdString(row[0].as_text());
+        if (!_positions.contains(path)) {
+            _positions.insert(path, _order.insert(_order.end(), path));
+        }
+        _clock = qMax(_clock, qint64(row[1].as_i64()));
+    }
+}
+
+/********************************************************************
+*                               prune                        public *
+*-------------------------------------------------------------------*
+* Checks in the background which paths still exist (stat of a path  *
+* on a network share may take long). Missing ones are removed from  *
+* the database there and from the list when the check is done.      *
+********************************************************************/
+void RecentStore::prune() {
+    const QStringList paths(_order.begin(), _order.end());
+    const Kind kind = _kind;
+
+    QtConcurrent::run(&_pool, [this, paths, kind] {
+        QStringList stale;
+        for (const auto& path : paths) {
+            const QFileInfo info(path);
+            if (!info.exists() || (kind == Projects && !info.isDir())) {
+                stale.append(path);
+            }
+        }
+        if (stale.isEmpty()) {
+            return;
+        }
+        for (const auto& path : stale) {
+            unlink(path);
+        }
+        QMetaObject::invokeMethod(this, [this, stale] {
+            for (const auto& path : stale) {
+                erase(path);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               touch                        public *
+*-------------------------------------------------------------------*
+* Moves the path to the head of the list (adds it when it's new).   *
+* The least recently used path above Capacity is forgotten.         *
+********************************************************************/
+void RecentStore::touch(const QString& path) {
+    if (path.isEmpty()) {
+        return;
+    }
+    if (auto it = _positions.find(path); it != _positions.end()) {
+        _order.splice(_order.begin(), _order, it.value());
+    } else {
+        _positions.insert(path, _order.insert(_order.begin(), path));
+    }
+    if (int(_order.size()) > Capacity) {
+        const QString last = _order.back();
+        remove(last);
+    }
+
+    // Timestamps order the rows, two touches in the same
+    // millisecond must still differ.
+    _clock = qMax(_clock + 1, QDateTime::currentMSecsSinceEpoch());
+    write(path, _clock);
+}
+
+/********************************************************************
+*                              remove                        public *
+********************************************************************/
+void RecentStore::remove(const QString& path) {
+    erase(path);
+    QtConcurrent::run(&_pool, [this, path] {
+        unlink(path);
+    });
+}
+
+/********************************************************************
+*                               wait                         public *
+*-------------------------------------------------------------------*
+* Waits for the background writes, so the database may be closed.   *
+********************************************************************/
+void RecentStore::wait() {
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                               first                        public *
+********************************************************************/
+QStringList RecentStore::first(const int n) const {
+    QStringList paths;
+    for (auto it = _order.begin(); it != _order.end() && paths.size() < n; ++it) {
+        paths.append(*it);
+    }
+    return paths;
+}
+
+/********************************************************************
+*                               erase                       private *
+********************************************************************/
+void RecentStore::erase(const QString& path) {
+    if (auto it = _positions.find(path); it != _positions.end()) {
+        _order.erase(it.value());
+        _positions.erase(it);
+    }
+}
+
+/********************************************************************
+*                               write                       private *
+********************************************************************/
+void RecentStore::write(const QString& path, const qint64 used) {
+    const Kind kind = _kind;
+    QtConcurrent::run(&_pool, [path, used, kind] {
+        auto& db = SQLite::global();
+        if (!db.isOpen()) {
+            return;
+        }
+        const bool ok = db.exec("INSERT OR REPLACE INTO recent (kind, path, used) VALUES (:kind, :path, :used)",
+                                {Field("kind", i64(kind)), Field("path", path.toStdString()), Field("used", i64(used))});
+        if (!ok) {
+            qWarning() << "RecentStore: can't save" << path;
+        }
+    });
+}
+
+/********************************************************************
+*                              unlink                       private *
+*-------------------------------------------------------------------*
+* Removes the row of the path. Called in the pool thread.           *
+********************************************************************/
+void RecentStore::unlink(const QString& path) {
+    auto& db = SQLite::global();
+    if (db.isOpen()) {
+        db.exec("DELETE FROM recent WHERE kind = :kind AND path = :path",
+                {Field("kind", i64(_kind)), Field("path", path.toStdString())});
+    }
+}
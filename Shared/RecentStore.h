@@ -0,0 +1,78 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : RecentStore.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_RECENT_STORE_H
+#define GOEDIT_RECENT_STORE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QThreadPool>
+#include <list>
+
+/********************************************************************
+*                            RecentStore                            *
+*-------------------------------------------------------------------*
+* Most recently used paths of one kind (files or projects). Paths   *
+* are kept in memory in a list ordered by use with a hash of list   *
+* positions, so touching a path and reading the head of the list    *
+* are O(1) however long it is. Every change is written to the       *
+* global database in the background as a single upsert of one row.  *
+* Paths which no longer exist are pruned in the background too.     *
+********************************************************************/
+class RecentStore : public QObject {
+    Q_OBJECT
+public:
+    enum Kind { Files = 1, Projects = 2 };
+    static constexpr int Capacity = 5000;      // paths remembered
+private:
+    const Kind _kind;
+    std::list<QString> _order;                 // the most recent first
+    QHash<QString, std::list<QString>::iterator> _positions;
+    qint64 _clock;                             // 'used' of the last touch
+    QThreadPool _pool;
+public:
+    explicit RecentStore(const Kind, QObject* = nullptr);
+    ~RecentStore() override;
+
+    void load();
+    void prune();
+    void touch(const QString&);
+    void remove(const QString&);
+    void wait();
+    QStringList first(const int) const;
+    int size() const {
+        return int(_order.size());
+    }
+
+private:
+    void erase(const QString&);
+    void write(const QString&, const qint64);
+    void unlink(const QString&);
+};
+
+#endif // GOEDIT_RECENT_STORE_H
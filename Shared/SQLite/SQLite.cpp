@@ -5,9 +5,11 @@
 #include <unistd.h>
 #include <iostream>
 #include <fstream>
+#include <atomic>
 #include "SQLite.h"
 #include "Field.h"
 #include "Statement.h"
+#include "Shared/Trace.h"
 
 /*-------namespaces:
 -------------------------------------------------------------------*/
@@ -20,16 +22,39 @@ const char SQLite::ValidHeader[SQLite::HeaderSize] = {
     0x6f, 0x72, 0x6d, 0x61, 0x74, 0x20, 0x33, 0x00
 };
 
+// Number of instances which initialized the library,
+// the last one destroyed shuts it down.
+static atomic<int> initializedCount{0};
+
+// Statements executed, sampled into the trace.
+static TraceCounter statements("sqlite statements");
+
 SQLite::SQLite()
     : db(nullptr)
-{
-    cout << "SQLite ctor" << endl;
-    sqlite3_initialize();
-}
+    , _initialized(false)
+{}
 
 SQLite::~SQLite() {
-    cout << "~SQLite" << endl;
-    sqlite3_shutdown();
+    if (_initialized) {
+        close();
+        if (--initializedCount == 0) {
+            sqlite3_shutdown();
+        }
+    }
+}
+
+/**
+ * SQLite::initialize
+ *
+ * The library is initialized with the first database opened,
+ * not when the object is created (at start of the application).
+ */
+void SQLite::initialize() {
+    call_once(_initOnce, [this] {
+        sqlite3_initialize();
+        _initialized = true;
+        ++initializedCount;
+    });
 }
 
 /**
@@ -45,6 +70,7 @@ SQLite::~SQLite() {
  */
 bool SQLite::open(const std::string& fpath) {
     if (db) return false;
+    initialize();
 
     if (fileExists(fpath)) {
         if(canReadFrom(fpath) && canWriteTo(fpath)) {
@@ -74,6 +100,7 @@ bool SQLite::open(const std::string& fpath) {
  */
 bool SQLite::create(const string& fpath, const function<bool(SQLite&)>& lambda, const bool override) {
     if (db) return false;
+    initialize();
 
     // jeśli plik istnieje i jest na to pozwolenie to go usuwamy
     if (fileExists(fpath) && override) {
@@ -105,6 +132,8 @@ bool SQLite::create(const string& fpath, const function<bool(SQLite&)>& lambda,
  * @return true jeśli nie było problemów, false w przeciwnym przypadku.
  */
 bool SQLite::close() {
+    lock_guard<recursive_mutex> guard(_mutex);
+
     if (db) {
         if (sqlite3_close(db) == SQLITE_OK) {
             db = nullptr;
@@ -116,7 +145,9 @@ bool SQLite::close() {
 }
 
 bool SQLite::exec(const string& query) {
-    lock_guard<mutex> guard(_mutex);
+    TraceScope trace("exec", "sqlite");
+    statements.add();
+    lock_guard<recursive_mutex> guard(_mutex);
 
     if (sqlite3_exec(db, query.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK) {
         return true;
@@ -125,21 +156,72 @@ bool SQLite::exec(const string& query) {
     return false;
 }
 
+bool SQLite::exec(const string& query, const vector<Field>& binds) {
+    TraceScope trace("exec", "sqlite");
+    statements.add();
+    Statement stmt(*this);
+    return stmt.exec(query, binds);
+}
+
+/**
+ * SQLite::transaction
+ *
+ * Executes the lambda inside a transaction. The transaction is
+ * committed when the lambda returns true and rolled back otherwise.
+ * The database stays locked for other threads until it ends
+ * (the lambda may use all methods of the object, the mutex is recursive).
+ *
+ * @param lambda - work to do in the transaction.
+ * @return true if the transaction was committed, false otherwise.
+ */
+bool SQLite::transaction(const function<bool(SQLite&)>& lambda) {
+    lock_guard<recursive_mutex> guard(_mutex);
+
+    if (!exec("BEGIN TRANSACTION")) {
+        return false;
+    }
+    if (lambda(*this) && exec("COMMIT")) {
+        return true;
+    }
+    exec("ROLLBACK");
+    return false;
+}
+
 int SQLite::insert(const string& name, const vector<Field>& fields) {
+    TraceScope trace("insert", "sqlite");
+    statements.add();
     Statement stmt(*this);
     return stmt.insert(name, fields);
 }
 
+bool SQLite::insert(const string& name, const vector<vector<Field>>& rows) {
+    TraceScope trace("insert", "sqlite");
+    statements.add();
+    Statement stmt(*this);
+    return stmt.insert(name, rows);
+}
+
 bool SQLite::update(const string& name, const vector<Field>& fields) {
+    TraceScope trace("update", "sqlite");
+    statements.add();
     Statement stmt(*this);
     return stmt.update(name, fields);
 }
 
 vector<vector<Field>> SQLite::select(const string& query) {
+    TraceScope trace("select", "sqlite");
+    statements.add();
     Statement stmt(*this);
     return stmt.select(query);
 }
 
+vector<vector<Field>> SQLite::select(const string& query, const vector<Field>& binds) {
+    TraceScope trace("select", "sqlite");
+    statements.add();
+    Statement stmt(*this);
+    return stmt.select(query, binds);
+}
+
 /**
  * SQLite::remove_file
  *
@@ -7,6 +7,7 @@
 #include <string>
 #include <functional>
 #include <mutex>
+#include <vector>
 
 /*------- namespaces:
 -------------------------------------------------------------------*/
@@ -20,12 +21,25 @@ class SQLite {
     static const char ValidHeader[HeaderSize];
 
     sqlite3 *db;
-    std::mutex _mutex;
+    std::recursive_mutex _mutex;
+    std::once_flag _initOnce;
+    bool _initialized;
 public:
     static SQLite& shared() {
         static SQLite instance;
         return instance;
     }
+    // Second connection, for data of the application itself
+    // (the shared one is reopened with every project).
+    static SQLite& global() {
+        static SQLite instance;
+        return instance;
+    }
+    // Index of Go documentation, rebuilt at will and mostly read.
+    static SQLite& docs() {
+        static SQLite instance;
+        return instance;
+    }
 private:
     SQLite();
     ~SQLite();
@@ -36,10 +50,17 @@ public:
     bool open(const std::string&);
     bool create(const std::string&, const std::function<bool(SQLite&)>&, const bool = false);
     bool close();
+    bool isOpen() const {
+        return db != nullptr;
+    }
     bool exec(const std::string&);
+    bool exec(const std::string&, const std::vector<Field>&);
+    bool transaction(const std::function<bool(SQLite&)>&);
     int  insert(const std::string&, const std::vector<Field>&);
+    bool insert(const std::string&, const std::vector<std::vector<Field>>&);
     bool update(const std::string&, const std::vector<Field>&);
     std::vector<std::vector<Field>> select(const std::string&);
+    std::vector<std::vector<Field>> select(const std::string&, const std::vector<Field>&);
 
 private:
     bool removeFile(const std::string&) const;
@@ -47,6 +68,7 @@ private:
     bool canReadFrom(const std::string&) const;
     bool canWriteTo(const std::string&) const;
     bool isDatabaseFile(const std::string&) const;
+    void initialize();
     void logError(const std::string& = __BASE_FILE__, const int = __LINE__, const std::string& = __FUNCTION__);
 
     friend class Statement;
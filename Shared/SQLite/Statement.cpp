@@ -44,16 +44,19 @@ using namespace std;
  * Execute SELECT query and fetch data from database.
  *
  * @param query - query with SELECT to execute.
+ * @param binds - values of named parameters used in the query.
  * @return vector of rows, where row is vector of fields (type Field).
  */
-vector<vector<Field>> Statement::select(const string& query) {
-    lock_guard<mutex> guard(_sqlite._mutex);
+vector<vector<Field>> Statement::select(const string& query, const vector<Field>& binds) {
+    lock_guard<recursive_mutex> guard(_sqlite._mutex);
     Result result;
 
-    if (sqlite3_prepare_v2(_sqlite.db, query.c_str(), query.size(), &_stmt, nullptr) == SQLITE_OK) {
+    if (prepare(query)) {
+        bind(binds);
         if (const int column_count = sqlite3_column_count(_stmt); column_count > 0) {
             while (SQLITE_ROW == sqlite3_step(_stmt)) {
                 Row row;
+                row.reserve(column_count);
                 for (int i = 0; i < column_count; i++) {
                     const string column_name = sqlite3_column_name(_stmt, i);
                     switch (sqlite3_column_type(_stmt, i)) {
@@ -82,11 +85,11 @@ vector<vector<Field>> Statement::select(const string& query) {
                     }
                 }
                 if (row.size()) {
-                    result.push_back(row);
+                    result.push_back(std::move(row));
                 }
             }
         }
-        if (SQLITE_OK == sqlite3_finalize(_stmt)) {
+        if (finalize()) {
             return result;
         }
     }
@@ -94,6 +97,31 @@ vector<vector<Field>> Statement::select(const string& query) {
     return Result();
 }
 
+/**
+ * @brief Statement::exec
+ * Execute query (without results) with bound parameters.
+ *
+ * @param query - query to execute.
+ * @param binds - values of named parameters used in the query.
+ * @return true when OK, false otherwise.
+ */
+bool Statement::exec(const string& query, const vector<Field>& binds) {
+    lock_guard<recursive_mutex> guard(_sqlite._mutex);
+
+    if (prepare(query)) {
+        bind(binds);
+        if (sqlite3_step(_stmt) == SQLITE_DONE) {
+            if (finalize()) {
+                return true;
+            }
+        }
+        _sqlite.logError();
+        finalize();
+        return false;
+    }
+    _sqlite.logError();
+    return false;
+}
 
 /**
  * @brief Statement::update
@@ -106,7 +134,7 @@ vector<vector<Field>> Statement::select(const string& query) {
  * @return true when OK, false otherwise.
  */
 bool Statement::update(const string& table, const vector<Field>& fields) {
-    lock_guard<mutex> guard(_sqlite._mutex);
+    lock_guard<recursive_mutex> guard(_sqlite._mutex);
 
     if (const int n = fields.size(); n > 1) { // co najmniej 2 pola: id + coś
         const int last = fields.size() - 1;
@@ -120,39 +148,17 @@ bool Statement::update(const string& table, const vector<Field>& fields) {
                  << " WHERE " << fields[0].name() << "=" << fields[0].as_i64();
         const string query = ss_query.str();
 
-        if (sqlite3_prepare_v2(_sqlite.db, query.c_str(), query.size(), &_stmt, nullptr) == SQLITE_OK) {
-            for (int i = 0; i < n; i++) {
-                const auto& f = fields[i];
-                if (const int idx = sqlite3_bind_parameter_index(_stmt, f.bindName().c_str()); idx != 0) {
-                    switch (f.type()) {
-                    case Type::Null:
-                        sqlite3_bind_null(_stmt, idx);
-                        break;
-                    case Type::Int:
-                        sqlite3_bind_int64(_stmt, idx, f.as_i64());
-                        break;
-                    case Type::Float:
-                        sqlite3_bind_double(_stmt, idx, f.as_f64());
-                        break;
-                    case Type::Text: {
-                        const auto text = f.as_text();
-                        sqlite3_bind_text(_stmt, idx, text.c_str(), text.size(), SQLITE_TRANSIENT); }
-                        break;
-                    case Type::Blob: {
-                        const auto vector = f.as_vector();
-                        sqlite3_bind_blob(_stmt, idx, vector.data(), vector.size(), nullptr); }
-                        break;
-                    }
-                }
-            }
+        if (prepare(query)) {
+            bind(fields);
             if (sqlite3_step(_stmt) == SQLITE_DONE) {
-                if (sqlite3_finalize(_stmt) == SQLITE_OK) {
+                if (finalize()) {
                     return true;
                 }
             }
             _sqlite.logError();
+            finalize();
             return false;
- }
+        }
     }
     return false;
 }
@@ -166,62 +172,134 @@ bool Statement::update(const string& table, const vector<Field>& fields) {
  * @return last inserted rowid when OK, -1 othewise.
  */
 int Statement::insert(const string& table, const vector<Field>& fields) {
-    lock_guard<mutex> guard(_sqlite._mutex);
-
-    if (const int n = fields.size() - 1; n > 0) {
-        string names, binds;
-        for (int i = 0; i < n; i++) {
-            const Field& f = fields[i];
-            names += (f.name() + ",");
-            binds += (f.bindName() + ",");
-        }
-        const Field& f = fields[n];
-        names += (f.name());
-        binds += (f.bindName());
-
-        string query("INSERT INTO ");
-        query.append(table);
-        query.append(" (");
-        query.append(names);
-        query.append(") VALUES (");
-        query.append(binds);
-        query.append(")");
-
-        if (sqlite3_prepare_v2(_sqlite.db, query.c_str(), query.size(), &_stmt, nullptr) == SQLITE_OK) {
-            for (auto i = 0; i < int(fields.size()); i++) {
-                const auto& f = fields[i];
-                if (const int idx = sqlite3_bind_parameter_index(_stmt, f.bindName().c_str()); idx != 0) {
-                    switch (f.type()) {
-                    case Type::Null:
-                        sqlite3_bind_null(_stmt, idx);
-                        break;
-                    case Type::Int:
-                        sqlite3_bind_int64(_stmt, idx, f.as_i64());
-                        break;
-                    case Type::Float:
-                        sqlite3_bind_double(_stmt, idx, f.as_f64());
-                        break;
-                    case Type::Text: {
-                        const auto text = f.as_text();
-                        sqlite3_bind_text(_stmt, idx, text.c_str(), text.size(), SQLITE_TRANSIENT); }
-                        break;
-                    case Type::Blob: {
-                        const auto vector = f.as_vector();
-                        sqlite3_bind_blob(_stmt, idx, vector.data(), vector.size(), nullptr); }
-                        break;
-                    }
-                }
-            }
+    lock_guard<recursive_mutex> guard(_sqlite._mutex);
+
+    if (fields.size() > 0) {
+        const string query = insertQuery(table, fields);
+
+        if (prepare(query)) {
+            bind(fields);
             if (sqlite3_step(_stmt) == SQLITE_DONE) {
-                if (sqlite3_finalize(_stmt) == SQLITE_OK) {
-                    return sqlite3_last_insert_rowid(_sqlite.db);
+                const auto rowid = sqlite3_last_insert_rowid(_sqlite.db);
+                if (finalize()) {
+                    return rowid;
                 }
             }
             _sqlite.logError();
+            finalize();
             return -1;
         }
     }
     return -1;
 }
 
+/**
+ * @brief Statement::insert
+ * Execute INSERT query for many rows.
+ * The statement is prepared once and reused for every row,
+ * all rows must have the same fields as the first one.
+ * Call it inside a transaction, otherwise every row is committed separately.
+ *
+ * @param table - name of the table
+ * @param rows - rows to insert.
+ * @return true when OK, false otherwise.
+ */
+bool Statement::insert(const string& table, const vector<vector<Field>>& rows) {
+    lock_guard<recursive_mutex> guard(_sqlite._mutex);
+
+    if (rows.empty()) {
+        return true;
+    }
+    if (rows[0].empty() || !prepare(insertQuery(table, rows[0]))) {
+        _sqlite.logError();
+        return false;
+    }
+    for (const auto& row : rows) {
+        bind(row);
+        if (sqlite3_step(_stmt) != SQLITE_DONE) {
+            _sqlite.logError();
+            finalize();
+            return false;
+        }
+        sqlite3_reset(_stmt);
+        sqlite3_clear_bindings(_stmt);
+    }
+    return finalize();
+}
+
+/**
+ * @brief Statement::insertQuery
+ * INSERT INTO table (a,b) VALUES (:a,:b)
+ */
+string Statement::insertQuery(const string& table, const vector<Field>& fields) const {
+    string names, binds;
+    for (const Field& f : fields) {
+        if (!names.empty()) {
+            names += ',';
+            binds += ',';
+        }
+        names += f.name();
+        binds += f.bindName();
+    }
+
+    string query("INSERT INTO ");
+    query.append(table);
+    query.append(" (");
+    query.append(names);
+    query.append(") VALUES (");
+    query.append(binds);
+    query.append(")");
+    return query;
+}
+
+/**
+ * @brief Statement::prepare
+ */
+bool Statement::prepare(const string& query) {
+    return sqlite3_prepare_v2(_sqlite.db, query.c_str(), int(query.size()), &_stmt, nullptr) == SQLITE_OK;
+}
+
+/**
+ * @brief Statement::bind
+ * Binds values of fields to the parameters of the same names.
+ * Text and blob values are copied by SQLite (SQLITE_TRANSIENT),
+ * the values returned by Field are temporaries.
+ *
+ * @param fields - values to bind.
+ */
+void Statement::bind(const vector<Field>& fields) {
+    for (const auto& f : fields) {
+        if (const int idx = sqlite3_bind_parameter_index(_stmt, f.bindName().c_str()); idx != 0) {
+            switch (f.type()) {
+            case Type::Null:
+                sqlite3_bind_null(_stmt, idx);
+                break;
+            case Type::Int:
+                sqlite3_bind_int64(_stmt, idx, f.as_i64());
+                break;
+            case Type::Float:
+                sqlite3_bind_double(_stmt, idx, f.as_f64());
+                break;
+            case Type::Text: {
+                const auto text = f.as_text();
+                sqlite3_bind_text(_stmt, idx, text.c_str(), int(text.size()), SQLITE_TRANSIENT); }
+                break;
+            case Type::Blob: {
+                const auto vector = f.as_vector();
+                sqlite3_bind_blob(_stmt, idx, vector.data(), int(vector.size()), SQLITE_TRANSIENT); }
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Statement::finalize
+ */
+bool Statement::finalize() {
+    const bool ok = (sqlite3_finalize(_stmt) == SQLITE_OK);
+    _stmt = nullptr;
+    return ok;
+}
+
 }} // namespaces end
@@ -24,11 +24,16 @@ public:
     Statement(SQLite& sqlite): _sqlite(sqlite), _stmt(nullptr) {}
 
     int  insert(const std::string&, const std::vector<Field>&);
+    bool insert(const std::string&, const std::vector<std::vector<Field>>&);
     bool update(const std::string&, const std::vector<Field>&);
-    std::vector<std::vector<Field>> select(const std::string&);
+    bool exec(const std::string&, const std::vector<Field>&);
+    std::vector<std::vector<Field>> select(const std::string&, const std::vector<Field>& = {});
 
 private:
-
+    std::string insertQuery(const std::string&, const std::vector<Field>&) const;
+    bool prepare(const std::string&);
+    void bind(const std::vector<Field>&);
+    bool finalize();
 };
 
 
@@ -0,0 +1,195 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Settings.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QTimer>
+#include <QDataStream>
+#include <QtConcurrent>
+#include <QDebug>
+#include "Settings.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+using namespace beesoft::sqlite;
+
+/*------- static members:
+-------------------------------------------------------------------*/
+Settings::Values Settings::_values;
+Settings* Settings::_instance = nullptr;
+
+//*******************************************************************
+//                             Settings                         CTOR
+//*******************************************************************
+Settings::Settings(QObject* parent)
+    : QObject(parent)
+    , _timer(new QTimer(this))
+{
+    _instance = this;
+    // One thread: the last values written are the last ones saved.
+    _pool.setMaxThreadCount(1);
+    _timer->setSingleShot(true);
+    _timer->setInterval(SaveDelayMs);
+    connect(_timer, &QTimer::timeout, this, &Settings::save);
+}
+
+/********************************************************************
+*                            ~Settings                         dtor *
+********************************************************************/
+Settings::~Settings() {
+    wait();
+    _instance = nullptr;
+}
+
+/********************************************************************
+*                               load                         public *
+*-------------------------------------------------------------------*
+* Reads saved values from the global database (open already). When  *
+* there are none, or they can't be decoded, defaults stay in use.   *
+********************************************************************/
+bool Settings::load() {
+    wait();
+    auto& db = SQLite::global();
+    if (!db.isOpen()) {
+        return false;
+    }
+    const auto rows = db.select("SELECT data FROM settings WHERE id=1");
+    if (rows.empty() || rows[0][0].type() != Type::Blob || rows[0][0].size() == 0) {
+        return false;
+    }
+    const auto blob = rows[0][0].as_vector();
+    Values values;
+    if (!decode(QByteArray(blob.data(), int(blob.size())), values)) {
+        return false;
+    }
+    _values = values;
+    emit changed();
+    return true;
+}
+
+/********************************************************************
+*                             setValues                      public *
+*-------------------------------------------------------------------*
+* All values at once (from the properties dialog).                  *
+********************************************************************/
+void Settings::setValues(const Values& values) {
+    _values = values;
+    modified();
+}
+
+/********************************************************************
+*                               flush                        public *
+*-------------------------------------------------------------------*
+* Starts the write of pending changes now.                          *
+********************************************************************/
+void Settings::flush() {
+    if (_timer->isActive()) {
+        _timer->stop();
+        save();
+    }
+}
+
+/********************************************************************
+*                               wait                         public *
+*-------------------------------------------------------------------*
+* Writes pending changes and waits until they are saved, so the     *
+* database may be closed after that.                                *
+********************************************************************/
+void Settings::wait() {
+    flush();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                              encode                 public static *
+********************************************************************/
+QByteArray Settings::encode(const Values& values) {
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_12);
+
+    out << Magic << Version;
+    out << values.tabWidth << values.fontSize
+        << values.showMinimap << values.showChangeBar << values.matchBrackets << values.formatOnSave;
+    return data;
+}
+
+/********************************************************************
+*                              decode                 public static *
+********************************************************************/
+bool Settings::decode(const QByteArray& data, Values& values) {
+    QDataStream in(data);
+    in.setVersion(QDataStream::Qt_5_12);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    in >> magic >> version;
+    if (magic != Magic || version != Version) {
+        return false;
+    }
+
+    Values result;
+    in >> result.tabWidth >> result.fontSize
+       >> result.showMinimap >> result.showChangeBar >> result.matchBrackets >> result.formatOnSave;
+    if (in.status() != QDataStream::Ok) {
+        return false;
+    }
+    result.tabWidth = qBound(1, result.tabWidth, 16);
+    result.fontSize = qBound(0, result.fontSize, 72);
+    values = result;
+    return true;
+}
+
+/********************************************************************
+*                             modified                      private *
+*-------------------------------------------------------------------*
+* Listeners learn about the change at once, the database later.     *
+********************************************************************/
+void Settings::modified() {
+    emit changed();
+    _timer->start();
+}
+
+/********************************************************************
+*                               save                        private *
+*-------------------------------------------------------------------*
+* Values are encoded here (they are small), the database is written *
+* in the background. A write still waiting is replaced by this one. *
+********************************************************************/
+void Settings::save() {
+    const QByteArray data = encode(_values);
+    _pool.clear();
+    QtConcurrent::run(&_pool, [data] {
+        auto& db = SQLite::global();
+        if (!db.isOpen()) {
+            return;
+        }
+        const bool ok = db.exec("INSERT OR REPLACE INTO settings (id, data) VALUES (1, :data)",
+                                {Field("data", data.constData(), data.size())});
+        if (!ok) {
+            qWarning() << "Settings: can't save the values";
+        }
+    });
+}
@@ -0,0 +1,101 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Settings.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_SETTINGS_H
+#define GOEDIT_SETTINGS_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QByteArray>
+#include <QThreadPool>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QTimer;
+
+/********************************************************************
+*                             Settings                              *
+*-------------------------------------------------------------------*
+* Preferences of the user, read once from the global database into  *
+* a plain struct. Code on hot paths reads fields of values() and    *
+* never looks anything up. Changes are announced by the 'changed'   *
+* signal and written in the background, a burst of changes as one   *
+* write. There is one instance, owned by the main window.           *
+********************************************************************/
+class Settings : public QObject {
+    Q_OBJECT
+
+    static constexpr quint32 Magic = 0x47534554;   // "GSET"
+    static constexpr quint16 Version = 1;
+    static constexpr int SaveDelayMs = 500;
+public:
+    struct Values {
+        qint32 tabWidth = 4;        // in spaces
+        qint32 fontSize = 0;        // points, 0: size of the system font
+        bool showMinimap = true;
+        bool showChangeBar = true;
+        bool matchBrackets = true;  // highlight the bracket pair at the cursor
+        bool formatOnSave = true;
+    };
+private:
+    static Values _values;
+    static Settings* _instance;
+
+    QTimer* const _timer;
+    QThreadPool _pool;
+public:
+    explicit Settings(QObject* = nullptr);
+    ~Settings() override;
+
+    static const Values& values() {
+        return _values;
+    }
+    static Settings* instance() {
+        return _instance;
+    }
+    bool load();
+    void setValues(const Values&);
+    template <typename T>
+    void set(T Values::* const field, const T& value) {
+        if (!(_values.*field == value)) {
+            _values.*field = value;
+            modified();
+        }
+    }
+    void flush();
+    void wait();
+
+    static QByteArray encode(const Values&);
+    static bool decode(const QByteArray&, Values&);
+
+private:
+    void modified();
+    void save();
+
+signals:
+    void changed();
+};
+
+#endif // GOEDIT_SETTINGS_H
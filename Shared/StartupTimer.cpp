@@ -0,0 +1,96 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : StartupTimer.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QElapsedTimer>
+#include <QVector>
+#include <QPair>
+#include <QDebug>
+#include <cstring>
+#include "StartupTimer.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+const char* const StartupTimer::FirstPaint = "first paint";
+
+/*------- local variables:
+-------------------------------------------------------------------*/
+// Used only by the GUI thread.
+static QElapsedTimer timer;
+static QVector<QPair<const char*, qint64>> phases;
+static bool finished = false;
+
+/********************************************************************
+*                               start                 public static *
+********************************************************************/
+void StartupTimer::start() {
+    timer.start();
+    phases.reserve(16);
+}
+
+/********************************************************************
+*                                mark                 public static *
+*-------------------------------------------------------------------*
+* End of the phase. The name must be a string literal.              *
+********************************************************************/
+void StartupTimer::mark(const char* phase) {
+    if (!finished && timer.isValid()) {
+        phases.append({phase, timer.elapsed()});
+    }
+}
+
+/********************************************************************
+*                              finish                 public static *
+*-------------------------------------------------------------------*
+* Startup is complete: checks the budget, logs the phases.          *
+********************************************************************/
+void StartupTimer::finish() {
+    if (finished || !timer.isValid()) {
+        return;
+    }
+    mark("complete");
+    finished = true;
+
+    for (const auto& phase : phases) {
+        if (strcmp(phase.first, FirstPaint) == 0 && phase.second > FirstPaintBudgetMs) {
+            qWarning() << "Startup: first paint after" << phase.second << "ms, budget is" << FirstPaintBudgetMs << "ms";
+        }
+    }
+    if (qEnvironmentVariableIsSet("GOEDIT_STARTUP_TIMES")) {
+        qint64 previous = 0;
+        for (const auto& phase : phases) {
+            qInfo().noquote() << QString("Startup: %1 ms (+%2) %3").arg(phase.second, 5).arg(phase.second - previous, 4).arg(phase.first);
+            previous = phase.second;
+        }
+    }
+}
+
+/********************************************************************
+*                              elapsed                public static *
+********************************************************************/
+qint64 StartupTimer::elapsed() {
+    return timer.isValid() ? timer.elapsed() : 0;
+}
@@ -0,0 +1,56 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : StartupTimer.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_STARTUP_TIMER_H
+#define GOEDIT_STARTUP_TIMER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QtGlobal>
+
+/********************************************************************
+*                           StartupTimer                            *
+*-------------------------------------------------------------------*
+* Times of the startup phases, measured from the start of main().   *
+* Time to the first paint of the main window must stay within       *
+* FirstPaintBudgetMs; when it doesn't, a warning is logged. All     *
+* phases are logged when GOEDIT_STARTUP_TIMES is set.               *
+********************************************************************/
+class StartupTimer {
+public:
+    static constexpr qint64 FirstPaintBudgetMs = 250;
+    static const char* const FirstPaint;
+
+    StartupTimer() = delete;
+    ~StartupTimer() = delete;
+    StartupTimer(const StartupTimer&) = delete;
+    StartupTimer(const StartupTimer&&) = delete;
+
+    static void start();
+    static void mark(const char*);
+    static void finish();
+    static qint64 elapsed();
+};
+
+#endif // GOEDIT_STARTUP_TIMER_H
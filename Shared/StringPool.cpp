@@ -0,0 +1,98 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : StringPool.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstring>
+#include "StringPool.h"
+
+//*******************************************************************
+//                           StringPool                         CTOR
+//*******************************************************************
+StringPool::StringPool()
+    : _chunkUsed(ChunkSize)
+{}
+
+/********************************************************************
+*                              intern                        public *
+*-------------------------------------------------------------------*
+* Returns id of the string, adding it to the pool if needed.        *
+********************************************************************/
+uint32_t StringPool::intern(std::string_view str) {
+    if (auto it = _ids.find(str); it != _ids.end()) {
+        return it->second;
+    }
+    const std::string_view stored(store(str), str.size());
+    const auto id = static_cast<uint32_t>(_strings.size());
+    _strings.push_back(stored);
+    _ids.emplace(stored, id);
+    return id;
+}
+
+/********************************************************************
+*                               find                         public *
+*-------------------------------------------------------------------*
+* Returns id of the string or None when it was never interned.      *
+********************************************************************/
+uint32_t StringPool::find(std::string_view str) const {
+    if (auto it = _ids.find(str); it != _ids.end()) {
+        return it->second;
+    }
+    return None;
+}
+
+/********************************************************************
+*                               clear                        public *
+********************************************************************/
+void StringPool::clear() {
+    _ids.clear();
+    _strings.clear();
+    _chunks.clear();
+    _large.clear();
+    _chunkUsed = ChunkSize;
+}
+
+/********************************************************************
+*                               store                       private *
+*-------------------------------------------------------------------*
+* Copies characters into the current chunk. Long strings get a      *
+* block of their own so they don't waste the rest of a chunk. Even  *
+* the empty string needs a chunk to point into.                     *
+********************************************************************/
+const char* StringPool::store(std::string_view str) {
+    if (str.size() > ChunkSize / 4) {
+        auto& block = _large.emplace_back(new char[str.size()]);
+        memcpy(block.get(), str.data(), str.size());
+        return block.get();
+    }
+    if (_chunks.empty() || _chunkUsed + str.size() > ChunkSize) {
+        _chunks.emplace_back(new char[ChunkSize]);
+        _chunkUsed = 0;
+    }
+    char* const ptr = _chunks.back().get() + _chunkUsed;
+    memcpy(ptr, str.data(), str.size());
+    _chunkUsed += str.size();
+    return ptr;
+}
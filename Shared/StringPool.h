@@ -0,0 +1,72 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : StringPool.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_STRING_POOL_H
+#define GOEDIT_STRING_POOL_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/********************************************************************
+*                           StringPool                              *
+*-------------------------------------------------------------------*
+* Interned strings. Every distinct string is stored exactly once in *
+* big, never reallocated chunks and is identified by a 32-bit id.   *
+* Views handed out stay valid for the lifetime of the pool.         *
+********************************************************************/
+class StringPool {
+    static constexpr size_t ChunkSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> _chunks;
+    std::vector<std::unique_ptr<char[]>> _large;
+    size_t _chunkUsed;
+    std::vector<std::string_view> _strings;
+    std::unordered_map<std::string_view, uint32_t> _ids;
+public:
+    static constexpr uint32_t None = UINT32_MAX;
+
+    StringPool();
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    uint32_t intern(std::string_view);
+    uint32_t find(std::string_view) const;
+    void clear();
+
+    std::string_view operator[](const uint32_t id) const {
+        return _strings[id];
+    }
+    size_t size() const {
+        return _strings.size();
+    }
+private:
+    const char* store(std::string_view);
+};
+
+#endif // GOEDIT_STRING_POOL_H
@@ -0,0 +1,180 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TextScan.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "TextScan.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/********************************************************************
+*                             Utf8State                             *
+*-------------------------------------------------------------------*
+* Validator of UTF-8 byte by byte. The state survives between the   *
+* blocks, so a sequence may span the border of two blocks. Ranges   *
+* of the first continuation byte reject overlong forms, surrogates  *
+* and code points above U+10FFFF.                                   *
+********************************************************************/
+struct TextScan::Utf8State {
+    int need = 0;
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+
+    bool step(const uint8_t c) {
+        if (need) {
+            if (c < lo || c > hi) {
+                return false;
+            }
+            lo = 0x80;
+            hi = 0xBF;
+            need--;
+            return true;
+        }
+        if (c < 0x80) {
+            return true;
+        }
+        if (c >= 0xC2 && c <= 0xDF) {
+            need = 1;
+        } else if (c == 0xE0) {
+            need = 2;
+            lo = 0xA0;
+        } else if (c == 0xED) {
+            need = 2;
+            hi = 0x9F;
+        } else if (c >= 0xE1 && c <= 0xEF) {
+            need = 2;
+        } else if (c == 0xF0) {
+            need = 3;
+            lo = 0x90;
+        } else if (c == 0xF4) {
+            need = 3;
+            hi = 0x8F;
+        } else if (c >= 0xF1 && c <= 0xF3) {
+            need = 3;
+        } else {
+            return false;
+        }
+        return true;
+    }
+};
+
+/********************************************************************
+*                               scan                  public static *
+*-------------------------------------------------------------------*
+* Offsets pushed to 'lines' are those of the bytes following every  *
+* '\n' (the first line, at 0 or after the BOM, is not pushed).      *
+* UTF-16 text is not scanned, only its BOM is reported.             *
+********************************************************************/
+TextScan::Result TextScan::scan(const char* const data, const size_t n, std::vector<size_t>* const lines) {
+    Result result;
+    result.bom = bom(data, n);
+    if (result.bom == Bom::Utf16Le || result.bom == Bom::Utf16Be) {
+        result.utf8 = false;
+        return result;
+    }
+
+    auto const bytes = reinterpret_cast<const uint8_t*>(data);
+    Utf8State state;
+    bool valid = true;
+    bool cr = false;            // previous byte was '\r'
+    size_t i = bomSize(result.bom);
+
+#if defined(__SSE2__)
+    const __m128i lfs = _mm_set1_epi8('\n');
+    const __m128i crs = _mm_set1_epi8('\r');
+    for (; i + 16 <= n; i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        if (valid && (state.need || _mm_movemask_epi8(block))) {
+            for (size_t k = i; k < i + 16 && valid; k++) {
+                valid = state.step(bytes[k]);
+            }
+        }
+        const unsigned lf = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, lfs)));
+        const unsigned crMask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, crs)));
+        if (lf) {
+            result.lf += size_t(__builtin_popcount(lf));
+            result.crlf += size_t(__builtin_popcount(lf & ((crMask << 1) | unsigned(cr))));
+            if (lines) {
+                for (unsigned m = lf; m; m &= m - 1) {
+                    lines->push_back(i + size_t(__builtin_ctz(m)) + 1);
+                }
+            }
+        }
+        cr = (crMask >> 15) & 1;
+    }
+#endif
+    for (; i < n; i++) {
+        const uint8_t c = bytes[i];
+        if (valid) {
+            valid = state.step(c);
+        }
+        if (c == '\n') {
+            result.lf++;
+            if (cr) {
+                result.crlf++;
+            }
+            if (lines) {
+                lines->push_back(i + 1);
+            }
+        }
+        cr = (c == '\r');
+    }
+
+    result.utf8 = valid && !state.need;
+    return result;
+}
+
+/********************************************************************
+*                                bom                  public static *
+********************************************************************/
+TextScan::Bom TextScan::bom(const char* const data, const size_t n) {
+    auto const b = reinterpret_cast<const uint8_t*>(data);
+    if (n >= 3 && b[0] == 0xEF && b[1] == 0xBB && b[2] == 0xBF) {
+        return Bom::Utf8;
+    }
+    if (n >= 2 && b[0] == 0xFF && b[1] == 0xFE) {
+        return Bom::Utf16Le;
+    }
+    if (n >= 2 && b[0] == 0xFE && b[1] == 0xFF) {
+        return Bom::Utf16Be;
+    }
+    return Bom::None;
+}
+
+/********************************************************************
+*                              bomSize                public static *
+********************************************************************/
+size_t TextScan::bomSize(const Bom bom) {
+    switch (bom) {
+    case Bom::Utf8:
+        return 3;
+    case Bom::Utf16Le:
+    case Bom::Utf16Be:
+        return 2;
+    default:
+        return 0;
+    }
+}
@@ -0,0 +1,65 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TextScan.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_TEXT_SCAN_H
+#define GOEDIT_TEXT_SCAN_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/********************************************************************
+*                             TextScan                              *
+*-------------------------------------------------------------------*
+* One pass over the raw bytes of a file: UTF-8 validation, counts   *
+* of line endings and (optionally) offsets of line starts. Blocks   *
+* of 16 bytes are tested with SSE2; a block of ASCII bytes needs no *
+* decoding at all, so for source code the pass runs at the speed of *
+* memory. Other bytes go through a small scalar state machine.      *
+********************************************************************/
+class TextScan {
+    struct Utf8State;
+public:
+    enum class Bom { None, Utf8, Utf16Le, Utf16Be };
+
+    struct Result {
+        Bom bom = Bom::None;
+        bool utf8 = true;       // valid UTF-8 (after the BOM)
+        size_t lf = 0;          // all '\n', including those of "\r\n"
+        size_t crlf = 0;
+    };
+
+    TextScan() = delete;
+    ~TextScan() = delete;
+    TextScan(const TextScan&) = delete;
+    TextScan(const TextScan&&) = delete;
+
+    static Result scan(const char*, const size_t, std::vector<size_t>* = nullptr);
+    static Bom bom(const char*, const size_t);
+    static size_t bomSize(const Bom);
+};
+
+#endif // GOEDIT_TEXT_SCAN_H
@@ -0,0 +1,266 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Trace.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Trace.h"
+
+/********************************************************************
+*                           Trace::Buffer                           *
+*-------------------------------------------------------------------*
+* Events of one thread in a ring: when it's full, the oldest events *
+* are overwritten. The owner writes an event and publishes it by a  *
+* release store of 'written' (count of all events written); the     *
+* exporter reads 'written' with acquire and never looks beyond it.  *
+* A buffer of an exited thread is given to the next new thread, its *
+* events stay (each one knows its thread) until overwritten.        *
+********************************************************************/
+struct Trace::Buffer {
+    struct Event {
+        const char* name;
+        const char* category;
+        int64_t start;          // ns
+        int64_t value;          // duration in ns or the counter value
+        int tid;
+        char phase;             // 'X' complete, 'C' counter
+    };
+
+    const std::unique_ptr<Event[]> events;
+    std::atomic<size_t> written;
+    bool owned;                 // by a running thread (guarded by the registry mutex)
+
+    Buffer()
+        : events(new Event[BufferEvents])
+        , written(0)
+        , owned(true)
+    {}
+};
+
+namespace {
+    // Returns the buffer of the thread to the registry when the thread ends.
+    struct Owner {
+        std::shared_ptr<Trace::Buffer> buffer;
+        int tid = 0;
+        ~Owner();
+    };
+}
+
+/*------- local variables:
+-------------------------------------------------------------------*/
+static std::mutex buffersMutex;
+static std::vector<std::shared_ptr<Trace::Buffer>> buffers;
+static std::vector<const char*> threadNames;    // index: tid - 1
+static thread_local Owner owner;
+static thread_local const char* threadName = nullptr;
+static const auto origin = std::chrono::steady_clock::now();
+
+Owner::~Owner() {
+    if (buffer) {
+        std::lock_guard<std::mutex> guard(buffersMutex);
+        buffer->owned = false;
+    }
+}
+
+/********************************************************************
+*                            setEnabled               public static *
+********************************************************************/
+void Trace::setEnabled(const bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/********************************************************************
+*                           setThreadName             public static *
+*-------------------------------------------------------------------*
+* Name of the calling thread shown in the trace (a literal).        *
+********************************************************************/
+void Trace::setThreadName(const char* name) {
+    threadName = name;
+    if (owner.tid) {
+        std::lock_guard<std::mutex> guard(buffersMutex);
+        threadNames[size_t(owner.tid - 1)] = name;
+    }
+}
+
+/********************************************************************
+*                               clear                 public static *
+*-------------------------------------------------------------------*
+* Forgets recorded events. Should be called with tracing off, an    *
+* event written at the same moment may survive the clear.           *
+********************************************************************/
+void Trace::clear() {
+    std::lock_guard<std::mutex> guard(buffersMutex);
+    for (const auto& buf : buffers) {
+        buf->written.store(0, std::memory_order_release);
+    }
+}
+
+/********************************************************************
+*                              dropped                public static *
+*-------------------------------------------------------------------*
+* Count of events overwritten by newer ones.                        *
+********************************************************************/
+size_t Trace::dropped() {
+    std::lock_guard<std::mutex> guard(buffersMutex);
+    size_t n = 0;
+    for (const auto& buf : buffers) {
+        const size_t written = buf->written.load(std::memory_order_relaxed);
+        n += (written > BufferEvents) ? written - BufferEvents : 0;
+    }
+    return n;
+}
+
+/********************************************************************
+*                               write                 public static *
+*-------------------------------------------------------------------*
+* Writes all recorded events to the file as Chrome trace JSON.      *
+* Threads keep recording meanwhile, what they add is not exported.  *
+* Events are copied first; those the owner may have overwritten     *
+* during the copy are skipped.                                      *
+********************************************************************/
+bool Trace::write(const std::string& path) {
+    FILE* const file = fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+    auto quoted = [](const char* str) {
+        std::string out;
+        for (const char* p = str ? str : ""; *p; p++) {
+            if (*p == '"' || *p == '\\') {
+                out += '\\';
+            }
+            out += *p;
+        }
+        return out;
+    };
+
+    std::lock_guard<std::mutex> guard(buffersMutex);
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    bool first = true;
+    auto separate = [&first, file] {
+        if (!first) {
+            fputs(",\n", file);
+        }
+        first = false;
+    };
+    for (size_t i = 0; i < threadNames.size(); i++) {
+        if (threadNames[i]) {
+            separate();
+            fprintf(file, R"({"name":"thread_name","ph":"M","pid":1,"tid":%d,"args":{"name":"%s"}})",
+                    int(i + 1), quoted(threadNames[i]).c_str());
+        }
+    }
+    std::vector<Buffer::Event> events;
+    for (const auto& buf : buffers) {
+        const size_t end = buf->written.load(std::memory_order_acquire);
+        const size_t begin = (end > BufferEvents) ? end - BufferEvents : 0;
+        events.clear();
+        for (size_t i = begin; i < end; i++) {
+            events.push_back(buf->events[i % BufferEvents]);
+        }
+        // the owner may be rewriting the slot of event 'written - BufferEvents'
+        const size_t after = buf->written.load(std::memory_order_acquire);
+        const size_t valid = (after + 1 > BufferEvents) ? after + 1 - BufferEvents : 0;
+        const size_t skip = (valid > begin) ? std::min(valid - begin, events.size()) : 0;
+        for (size_t i = skip; i < events.size(); i++) {
+            const Buffer::Event& event = events[i];
+            const std::string name = quoted(event.name);
+            separate();
+            if (event.phase == 'X') {
+                fprintf(file, R"({"name":"%s","cat":"%s","ph":"X","pid":1,"tid":%d,"ts":%.3f,"dur":%.3f})",
+                        name.c_str(), quoted(event.category).c_str(), event.tid,
+                        double(event.start) / 1000.0, double(event.value) / 1000.0);
+            } else {
+                fprintf(file, R"({"name":"%s","ph":"C","pid":1,"tid":%d,"ts":%.3f,"args":{"value":%lld}})",
+                        name.c_str(), event.tid, double(event.start) / 1000.0, static_cast<long long>(event.value));
+            }
+        }
+    }
+    fputs("\n]}\n", file);
+    return fclose(file) == 0;
+}
+
+/********************************************************************
+*                                now                  public static *
+*-------------------------------------------------------------------*
+* Nanoseconds since the start of the application.                   *
+********************************************************************/
+int64_t Trace::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+/********************************************************************
+*                             complete                public static *
+********************************************************************/
+void Trace::complete(const char* name, const char* category, const int64_t start, const int64_t duration) {
+    record(name, category, 'X', start, duration);
+}
+
+/********************************************************************
+*                              counter                public static *
+********************************************************************/
+void Trace::counter(const char* name, const int64_t value) {
+    record(name, nullptr, 'C', now(), value);
+}
+
+/********************************************************************
+*                              record                private static *
+********************************************************************/
+void Trace::record(const char* name, const char* category, const char phase, const int64_t start, const int64_t value) {
+    Buffer& buf = buffer();
+    const size_t n = buf.written.load(std::memory_order_relaxed);
+    buf.events[n % BufferEvents] = {name, category, start, value, owner.tid, phase};
+    buf.written.store(n + 1, std::memory_order_release);
+}
+
+/********************************************************************
+*                              buffer                private static *
+*-------------------------------------------------------------------*
+* Buffer of the calling thread, taken with its first event: one of  *
+* an exited thread or a new one. Pool threads come and go, but the  *
+* number of buffers stays at the most threads recording at once.    *
+********************************************************************/
+Trace::Buffer& Trace::buffer() {
+    if (!owner.buffer) {
+        std::lock_guard<std::mutex> guard(buffersMutex);
+        threadNames.push_back(threadName);
+        owner.tid = int(threadNames.size());
+        for (const auto& buf : buffers) {
+            if (!buf->owned) {
+                buf->owned = true;
+                owner.buffer = buf;
+                return *buf;
+            }
+        }
+        owner.buffer = std::make_shared<Buffer>();
+        buffers.push_back(owner.buffer);
+    }
+    return *owner.buffer;
+}
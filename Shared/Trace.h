@@ -0,0 +1,122 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Trace.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_TRACE_H
+#define GOEDIT_TRACE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/********************************************************************
+*                               Trace                               *
+*-------------------------------------------------------------------*
+* Instrumentation of the running application. Events are written    *
+* to a buffer of the calling thread without any lock (every thread  *
+* has its own, only that thread writes it) and are exported as      *
+* JSON of Chrome trace events (chrome://tracing, Perfetto). When    *
+* tracing is off, an event costs one relaxed atomic load.           *
+* Names and categories must be string literals: only the pointers   *
+* are stored.                                                       *
+********************************************************************/
+class Trace {
+    static inline std::atomic<bool> _enabled{false};
+public:
+    struct Buffer;
+    static constexpr size_t BufferEvents = 32 * 1024;   // per thread, the oldest are overwritten
+
+    Trace() = delete;
+    ~Trace() = delete;
+    Trace(const Trace&) = delete;
+    Trace(const Trace&&) = delete;
+
+    static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(const bool);
+    static void setThreadName(const char*);
+    static void clear();
+    static bool write(const std::string&);
+    static size_t dropped();
+
+    static int64_t now();
+    static void complete(const char*, const char*, const int64_t, const int64_t);
+    static void counter(const char*, const int64_t);
+private:
+    static void record(const char*, const char*, const char, const int64_t, const int64_t);
+    static Buffer& buffer();
+};
+
+/********************************************************************
+*                            TraceScope                             *
+*-------------------------------------------------------------------*
+* Times its own lifetime: TraceScope scope("load", "io");           *
+********************************************************************/
+class TraceScope {
+    const char* const _name;
+    const char* const _category;
+    const int64_t _start;
+public:
+    TraceScope(const char* name, const char* category)
+        : _name(name)
+        , _category(category)
+        , _start(Trace::isEnabled() ? Trace::now() : -1)
+    {}
+    ~TraceScope() {
+        if (_start >= 0) {
+            Trace::complete(_name, _category, _start, Trace::now() - _start);
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+/********************************************************************
+*                           TraceCounter                            *
+*-------------------------------------------------------------------*
+* Running total, counted always (one atomic addition), sampled into *
+* the trace only while tracing is on.                               *
+********************************************************************/
+class TraceCounter {
+    const char* const _name;
+    std::atomic<int64_t> _value;
+public:
+    explicit TraceCounter(const char* name)
+        : _name(name)
+        , _value(0)
+    {}
+    void add(const int64_t n = 1) {
+        const int64_t value = _value.fetch_add(n, std::memory_order_relaxed) + n;
+        if (Trace::isEnabled()) {
+            Trace::counter(_name, value);
+        }
+    }
+    int64_t value() const {
+        return _value.load(std::memory_order_relaxed);
+    }
+};
+
+#endif // GOEDIT_TRACE_H
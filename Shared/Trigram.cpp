@@ -0,0 +1,177 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Trigram.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <algorithm>
+#include "Trigram.h"
+
+/********************************************************************
+*                              extract                public static *
+*-------------------------------------------------------------------*
+* Distinct trigrams of the text (in order of first occurrence).     *
+* Duplicates are filtered with a bitmap of all 2^24 trigrams, one   *
+* per thread, cleared afterwards only at the bits which were set.   *
+********************************************************************/
+void Trigram::extract(std::string_view text, std::vector<uint32_t>& out) {
+    thread_local std::vector<uint64_t> seen(size_t(1) << 18);
+
+    out.clear();
+    if (text.size() < 3) {
+        return;
+    }
+    uint32_t key = (uint32_t(fold(text[0])) << 8) | fold(text[1]);
+    for (size_t i = 2; i < text.size(); i++) {
+        key = ((key << 8) | fold(text[i])) & 0xffffff;
+        uint64_t& word = seen[key >> 6];
+        const uint64_t bit = uint64_t(1) << (key & 63);
+        if (!(word & bit)) {
+            word |= bit;
+            out.push_back(key);
+        }
+    }
+    for (const uint32_t k : out) {
+        seen[k >> 6] = 0;
+    }
+}
+
+/********************************************************************
+*                               query                 public static *
+*-------------------------------------------------------------------*
+* Trigrams a file must contain to contain the literal. Without case *
+* sensitivity non-ASCII letters may differ in case in the file, so  *
+* trigrams with non-ASCII bytes are not required then.              *
+********************************************************************/
+std::vector<uint32_t> Trigram::query(std::string_view literal, const bool caseSensitive) {
+    std::vector<uint32_t> keys;
+    for (size_t i = 2; i < literal.size(); i++) {
+        if (!caseSensitive && ((literal[i - 2] | literal[i - 1] | literal[i]) & 0x80)) {
+            continue;
+        }
+        keys.push_back(key(literal[i - 2], literal[i - 1], literal[i]));
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
+/********************************************************************
+*                             literals                public static *
+*-------------------------------------------------------------------*
+* Literal strings every match of the regular expression contains.   *
+* Only plain sequences at the top level are taken: characters made  *
+* optional by a quantifier, classes, groups and escapes end them.   *
+* Alternation at the top level means nothing is required. The       *
+* result can only be too weak (more candidates), never too strong.  *
+********************************************************************/
+std::vector<std::string> Trigram::literals(std::string_view regex) {
+    std::vector<std::string> result;
+    std::string current;
+    auto flush = [&] {
+        if (current.size() >= 3) {
+            result.push_back(current);
+        }
+        current.clear();
+    };
+    auto isWord = [](const char c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    };
+
+    const size_t n = regex.size();
+    int depth = 0;
+    bool afterEscape = false;       // \x41, \p{L}, ... hide what belongs to them
+
+    for (size_t i = 0; i < n; i++) {
+        const char c = regex[i];
+        if (afterEscape && isWord(c)) {
+            continue;
+        }
+        afterEscape = false;
+
+        switch (c) {
+        case '\\':
+            if (i + 1 < n) {
+                const char next = regex[++i];
+                if (isWord(next)) {
+                    flush();
+                    afterEscape = true;
+                } else if (depth == 0) {
+                    current += next;
+                }
+            }
+            break;
+        case '[':
+            flush();
+            for (i++; i < n && regex[i] != ']'; i++) {
+                if (regex[i] == '\\') i++;
+                else if (regex[i] == '[' && i + 1 < n && regex[i + 1] == ':') {
+                    const size_t end = regex.find(":]", i + 2);
+                    if (end != std::string_view::npos) i = end + 1;
+                }
+            }
+            break;
+        case '(':
+            flush();
+            depth++;
+            break;
+        case ')':
+            flush();
+            if (depth > 0) depth--;
+            break;
+        case '|':
+            if (depth == 0) {
+                return {};
+            }
+            break;
+        case '*':
+        case '?':
+        case '{':
+            // the previous character is optional
+            if (!current.empty()) {
+                current.pop_back();
+            }
+            flush();
+            if (c == '{') {
+                while (i < n && regex[i] != '}') i++;
+            }
+            break;
+        case '+':
+            flush();
+            break;
+        case '.':
+        case '^':
+        case '$':
+            flush();
+            break;
+        default:
+            if (depth == 0) {
+                current += c;
+            }
+            break;
+        }
+    }
+    flush();
+    return result;
+}
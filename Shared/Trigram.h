@@ -0,0 +1,63 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Trigram.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_TRIGRAM_H
+#define GOEDIT_TRIGRAM_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/********************************************************************
+*                              Trigram                              *
+*-------------------------------------------------------------------*
+* Trigrams of text for the full-text index. A trigram is three      *
+* consecutive bytes (ASCII letters folded to lower case) packed in  *
+* 24 bits. A file can contain a literal only if it contains all     *
+* trigrams of the literal, so the index gives candidate files.      *
+********************************************************************/
+class Trigram {
+public:
+    Trigram() = delete;
+    ~Trigram() = delete;
+    Trigram(const Trigram&) = delete;
+    Trigram(const Trigram&&) = delete;
+
+    static void extract(std::string_view, std::vector<uint32_t>&);
+    static std::vector<uint32_t> query(std::string_view, const bool);
+    static std::vector<std::string> literals(std::string_view);
+
+    static inline uint8_t fold(const char ch) {
+        const auto c = static_cast<uint8_t>(ch);
+        return (c >= 'A' && c <= 'Z') ? uint8_t(c + ('a' - 'A')) : c;
+    }
+    static inline uint32_t key(const char a, const char b, const char c) {
+        return (uint32_t(fold(a)) << 16) | (uint32_t(fold(b)) << 8) | uint32_t(fold(c));
+    }
+};
+
+#endif // GOEDIT_TRIGRAM_H
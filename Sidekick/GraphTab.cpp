@@ -0,0 +1,273 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GraphTab.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QLabel>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+#include <QMenu>
+#include <QInputDialog>
+#include <algorithm>
+#include "GraphTab.h"
+#include "Project/Project.h"
+#include "Project/ImportGraph.h"
+
+//*******************************************************************
+//                             GraphTab                         CTOR
+//*******************************************************************
+GraphTab::GraphTab(QWidget* parent)
+    : QWidget(parent)
+    , _summary(new QLabel)
+    , _view(new QTreeWidget)
+    , _project(nullptr)
+{
+    _view->setUniformRowHeights(true);
+    _view->setHeaderHidden(true);
+    _view->setAnimated(false);
+    _view->setColumnCount(1);
+    _view->setContextMenuPolicy(Qt::CustomContextMenu);
+    _summary->setIndent(4);
+
+    auto const layout = new QVBoxLayout;
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(_summary);
+    layout->addWidget(_view);
+    setLayout(layout);
+
+    connect(_view, &QTreeWidget::itemExpanded, this, &GraphTab::expanded);
+    connect(_view, &QTreeWidget::itemActivated, this, &GraphTab::activated);
+    connect(_view, &QTreeWidget::customContextMenuRequested, this, &GraphTab::contextMenu);
+}
+
+/********************************************************************
+*                             setProject                     public *
+********************************************************************/
+void GraphTab::setProject(Project* project) {
+    _project = project;
+    connect(project->importGraph(), &ImportGraph::updated, this, &GraphTab::reload);
+    connect(project, &Project::closed, this, &GraphTab::reload);
+    reload();
+}
+
+/********************************************************************
+*                               reload                      private *
+*-------------------------------------------------------------------*
+* Only top level items are made here, lists of imports are filled   *
+* when expanded, so even big graphs are shown at once.              *
+********************************************************************/
+void GraphTab::reload() {
+    _view->setUpdatesEnabled(false);
+    _view->clear();
+
+    const auto graph = _project ? _project->importGraph() : nullptr;
+    if (!graph || !_project->isOpen() || graph->isEmpty()) {
+        _summary->setText("No packages");
+        _view->setUpdatesEnabled(true);
+        return;
+    }
+
+    QList<QTreeWidgetItem*> items;
+    for (int id = 0; id < graph->localCount(); id++) {
+        items.append(packageItem(id));
+    }
+    std::sort(items.begin(), items.end(), [](const QTreeWidgetItem* a, const QTreeWidgetItem* b) {
+        return a->text(0) < b->text(0);
+    });
+
+    auto const modules = new QTreeWidgetItem(QStringList("Modules"));
+    for (const auto& module : graph->modules()) {
+        QString text = module.path;
+        if (!module.version.isEmpty()) {
+            text += ' ' + module.version;
+        }
+        if (module.indirect) {
+            text += " (indirect)";
+        }
+        auto const item = new QTreeWidgetItem(modules, QStringList(text));
+        item->setToolTip(0, module.version.isEmpty() ? module.dir + "/go.mod" : "required");
+    }
+    items.append(modules);
+    _view->addTopLevelItems(items);
+    _view->setUpdatesEnabled(true);
+
+    _summary->setText(QString("%1 packages, %2 imported, %3 modules")
+                      .arg(graph->localCount())
+                      .arg(graph->packageCount() - graph->localCount())
+                      .arg(graph->modules().size()));
+}
+
+/********************************************************************
+*                            packageItem                    private *
+********************************************************************/
+QTreeWidgetItem* GraphTab::packageItem(const int id, QTreeWidgetItem* parent) const {
+    const auto& package = _project->importGraph()->package(id);
+    auto const item = parent ? new QTreeWidgetItem(parent) : new QTreeWidgetItem;
+    item->setText(0, package.path);
+    item->setData(0, IdRole, id);
+    item->setData(0, ListRole, None);
+    item->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
+    switch (package.kind) {
+    case ImportGraph::Local:
+        item->setToolTip(0, QString("package %1 in %2").arg(package.name, package.dir.isEmpty() ? "." : package.dir));
+        break;
+    case ImportGraph::Standard:
+        item->setToolTip(0, "standard library");
+        break;
+    case ImportGraph::External:
+        item->setToolTip(0, (package.module < 0) ? "unknown module" : _project->importGraph()->modules()[package.module].path);
+        break;
+    }
+    return item;
+}
+
+/********************************************************************
+*                              expanded                     private *
+*-------------------------------------------------------------------*
+* Package items get two lists, lists get their packages.            *
+********************************************************************/
+void GraphTab::expanded(QTreeWidgetItem* item) {
+    const QVariant id = item->data(0, IdRole);
+    if (item->childCount() || !id.isValid()) {
+        return;
+    }
+    const auto graph = _project->importGraph();
+    switch (item->data(0, ListRole).toInt()) {
+    case None: {
+        const std::pair<List, const char*> lists[] = {{Imports, "imports"}, {ImportedBy, "imported by"}};
+        for (const auto& [list, title] : lists) {
+            const int count = (list == Imports) ? graph->imports(id.toInt()).size() : graph->importedBy(id.toInt()).size();
+            auto const child = new QTreeWidgetItem(item, QStringList(QString("%1 (%2)").arg(title).arg(count)));
+            child->setData(0, IdRole, id);
+            child->setData(0, ListRole, list);
+            child->setChildIndicatorPolicy(count ? QTreeWidgetItem::ShowIndicator : QTreeWidgetItem::DontShowIndicator);
+        }
+        break; }
+    case Imports:
+        for (const int target : graph->imports(id.toInt())) {
+            packageItem(target, item);
+        }
+        break;
+    case ImportedBy:
+        for (const int source : graph->importedBy(id.toInt())) {
+            packageItem(source, item);
+        }
+        break;
+    }
+    item->sortChildren(0, Qt::AscendingOrder);
+}
+
+/********************************************************************
+*                             activated                     private *
+*-------------------------------------------------------------------*
+* Local package opens its first file.                               *
+********************************************************************/
+void GraphTab::activated(QTreeWidgetItem* item) {
+    const QVariant id = item->data(0, IdRole);
+    if (!id.isValid() || item->data(0, ListRole).toInt() != None) {
+        return;
+    }
+    const auto& package = _project->importGraph()->package(id.toInt());
+    if (!package.file.isEmpty()) {
+        emit fileActivated(_project->root() + '/' + package.file);
+    }
+}
+
+/********************************************************************
+*                            contextMenu                    private *
+********************************************************************/
+void GraphTab::contextMenu(const QPoint& pos) {
+    auto const item = _view->itemAt(pos);
+    if (!item || !item->data(0, IdRole).isValid() || item->data(0, ListRole).toInt() != None) {
+        return;
+    }
+    const int id = item->data(0, IdRole).toInt();
+
+    QMenu menu;
+    menu.addAction("Reverse Dependencies", this, [this, id] {
+        showDependents(id);
+    });
+    menu.addAction("Shortest Import Path To ...", this, [this, id] {
+        showPath(id);
+    });
+    menu.exec(_view->viewport()->mapToGlobal(pos));
+}
+
+/********************************************************************
+*                           showDependents                  private *
+*-------------------------------------------------------------------*
+* All packages importing the package, directly or not, on the top.  *
+********************************************************************/
+void GraphTab::showDependents(const int id) {
+    const auto graph = _project->importGraph();
+    const QVector<int> dependents = graph->dependents(id);
+
+    auto const result = new QTreeWidgetItem(QStringList(QString("Dependents of %1 (%2)")
+                                                        .arg(graph->package(id).path)
+                                                        .arg(dependents.size())));
+    for (const int dependent : dependents) {
+        packageItem(dependent, result);
+    }
+    result->sortChildren(0, Qt::AscendingOrder);
+    _view->insertTopLevelItem(0, result);
+    _view->setCurrentItem(result);
+    result->setExpanded(true);
+}
+
+/********************************************************************
+*                              showPath                     private *
+*-------------------------------------------------------------------*
+* Chain of imports from the package to the one chosen by the user.  *
+********************************************************************/
+void GraphTab::showPath(const int from) {
+    const auto graph = _project->importGraph();
+    QStringList paths;
+    for (int id = 0; id < graph->packageCount(); id++) {
+        if (id != from) {
+            paths.append(graph->package(id).path);
+        }
+    }
+    paths.sort();
+
+    bool ok = false;
+    const QString target = QInputDialog::getItem(this, "Shortest Import Path", "To package:", paths, 0, true, &ok);
+    const int to = graph->find(target);
+    if (!ok || to < 0) {
+        return;
+    }
+
+    const QVector<int> path = graph->shortestPath(from, to);
+    const QString source = graph->package(from).path;
+    const QString title = path.isEmpty()
+                          ? QString("%1 does not depend on %2").arg(source, target)
+                          : QString("%1 -> %2 (%3 imports)").arg(source, target).arg(path.size() - 1);
+    auto const result = new QTreeWidgetItem(QStringList(title));
+    for (const int id : path) {
+        packageItem(id, result);
+    }
+    _view->insertTopLevelItem(0, result);
+    _view->setCurrentItem(result);
+    result->setExpanded(true);
+}
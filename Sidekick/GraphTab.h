@@ -0,0 +1,79 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GraphTab.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_GRAPH_TAB_H
+#define GOEDIT_GRAPH_TAB_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QWidget>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QLabel;
+class QTreeWidget;
+class QTreeWidgetItem;
+class Project;
+
+/********************************************************************
+*                             GraphTab                              *
+*-------------------------------------------------------------------*
+* Packages of the project with what they import and what imports    *
+* them (filled when expanded), modules from go.mod files, and       *
+* answers of queries asked from the context menu.                   *
+********************************************************************/
+class GraphTab : public QWidget {
+    Q_OBJECT
+
+    enum Role {
+        IdRole = Qt::UserRole + 1,
+        ListRole
+    };
+    enum List {
+        None,
+        Imports,
+        ImportedBy
+    };
+
+    QLabel* const _summary;
+    QTreeWidget* const _view;
+    Project* _project;
+public:
+    explicit GraphTab(QWidget* = nullptr);
+    void setProject(Project*);
+
+private:
+    void reload();
+    QTreeWidgetItem* packageItem(const int, QTreeWidgetItem* = nullptr) const;
+    void expanded(QTreeWidgetItem*);
+    void activated(QTreeWidgetItem*);
+    void contextMenu(const QPoint&);
+    void showDependents(const int);
+    void showPath(const int);
+
+signals:
+    void fileActivated(const QString&);
+};
+
+#endif // GOEDIT_GRAPH_TAB_H
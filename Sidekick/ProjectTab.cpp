@@ -1,6 +1,166 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectTab.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QTreeView>
+#include <QHeaderView>
+#include <QVBoxLayout>
+#include <QAction>
+#include <QMenu>
 #include "ProjectTab.h"
+#include "Project/Project.h"
+#include "Project/ProjectModel.h"
+#include "Project/ProjectWalker.h"
 
-ProjectTab::ProjectTab(QWidget *parent) : QWidget(parent)
+//*******************************************************************
+//                            ProjectTab                        CTOR
+//*******************************************************************
+ProjectTab::ProjectTab(QWidget *parent)
+    : QWidget(parent)
+    , _view(new QTreeView)
+    , _showVendorAction(new QAction("Show vendor directories", this))
+    , _project(nullptr)
 {
+    // Rows have the same height, so the view does not have to ask
+    // every item about its size (important for huge directories).
+    _view->setUniformRowHeights(true);
+    _view->setHeaderHidden(true);
+    _view->setAnimated(false);
+    _view->setContextMenuPolicy(Qt::CustomContextMenu);
+    _showVendorAction->setCheckable(true);
+
+    auto const layout = new QVBoxLayout;
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(_view);
+    setLayout(layout);
+
+    connect(_view, &QTreeView::activated, this, &ProjectTab::activated);
+    connect(_view, &QTreeView::customContextMenuRequested, this, &ProjectTab::contextMenu);
+}
+
+/********************************************************************
+*                             setProject                     public *
+********************************************************************/
+void ProjectTab::setProject(Project* project) {
+    _project = project;
+    _view->setModel(project->model());
+    _showVendorAction->setChecked(project->model()->showVendor());
+
+    connect(project, &Project::opened, this, &ProjectTab::projectOpened);
+    connect(project->model(), &ProjectModel::rowsInserted, this, &ProjectTab::rowsInserted);
+    connect(_showVendorAction, &QAction::toggled, project->model(), &ProjectModel::setShowVendor);
+}
+
+/********************************************************************
+*                           projectOpened                   private *
+********************************************************************/
+void ProjectTab::projectOpened() {
+    _view->expand(_view->model()->index(0, 0));
+}
+
+/********************************************************************
+*                              expanded                      public *
+*-------------------------------------------------------------------*
+* Expanded directories, relative to the project root.               *
+********************************************************************/
+QStringList ProjectTab::expanded() const {
+    QStringList result;
+    if (_project && _project->isOpen()) {
+        collectExpanded(_view->model()->index(0, 0), result);
+    }
+    return result;
+}
+
+/********************************************************************
+*                            setExpanded                     public *
+*-------------------------------------------------------------------*
+* Directories are listed lazily, so a directory is expanded when it *
+* appears in the model. Its subdirectories follow in the same way.  *
+********************************************************************/
+void ProjectTab::setExpanded(const QStringList& dirs) {
+    _pendingExpand = QSet<QString>(dirs.cbegin(), dirs.cend());
+    expandPending(_view->model()->index(0, 0));
+}
+
+/********************************************************************
+*                           rowsInserted                    private *
+********************************************************************/
+void ProjectTab::rowsInserted(const QModelIndex& parent, const int first, const int last) {
+    if (_pendingExpand.isEmpty()) {
+        return;
+    }
+    for (int row = first; row <= last; row++) {
+        expandPending(_view->model()->index(row, 0, parent));
+    }
+}
+
+/********************************************************************
+*                           expandPending                   private *
+********************************************************************/
+void ProjectTab::expandPending(const QModelIndex& index) {
+    if (!index.isValid() || !_project || !index.data(ProjectModel::IsDirRole).toBool()) {
+        return;
+    }
+    const QString path = ProjectWalker::relativePath(_project->root(), index.data(ProjectModel::PathRole).toString());
+    if (_pendingExpand.remove(path)) {
+        _view->expand(index);
+        // Children listed already (not inserted again).
+        for (int row = 0; row < _view->model()->rowCount(index); row++) {
+            expandPending(_view->model()->index(row, 0, index));
+        }
+    }
+}
+
+/********************************************************************
+*                          collectExpanded                  private *
+********************************************************************/
+void ProjectTab::collectExpanded(const QModelIndex& index, QStringList& result) const {
+    if (!index.isValid() || !_view->isExpanded(index)) {
+        return;
+    }
+    result.append(ProjectWalker::relativePath(_project->root(), index.data(ProjectModel::PathRole).toString()));
+    for (int row = 0; row < _view->model()->rowCount(index); row++) {
+        collectExpanded(_view->model()->index(row, 0, index), result);
+    }
+}
+
+/********************************************************************
+*                             activated                     private *
+********************************************************************/
+void ProjectTab::activated(const QModelIndex& index) {
+    if (!index.data(ProjectModel::IsDirRole).toBool()) {
+        emit fileActivated(index.data(ProjectModel::PathRole).toString());
+    }
+}
 
+/********************************************************************
+*                            contextMenu                    private *
+********************************************************************/
+void ProjectTab::contextMenu(const QPoint& pos) {
+    QMenu menu;
+    menu.addAction(_showVendorAction);
+    menu.exec(_view->viewport()->mapToGlobal(pos));
 }
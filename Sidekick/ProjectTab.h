@@ -1,16 +1,68 @@
-#ifndef PROJECTTAB_H
-#define PROJECTTAB_H
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ProjectTab.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_PROJECT_TAB_H
+#define GOEDIT_PROJECT_TAB_H
 
+/*------- include files:
+-------------------------------------------------------------------*/
 #include <QWidget>
+#include <QSet>
 
-class ProjectTab : public QWidget
-{
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QTreeView;
+class QModelIndex;
+class QAction;
+class Project;
+
+/********************************************************************
+*                            ProjectTab                             *
+********************************************************************/
+class ProjectTab : public QWidget {
     Q_OBJECT
+
+    QTreeView* const _view;
+    QAction* const _showVendorAction;
+    Project* _project;
+    QSet<QString> _pendingExpand;
 public:
-    explicit ProjectTab(QWidget *parent = nullptr);
+    explicit ProjectTab(QWidget* = nullptr);
+    void setProject(Project*);
+    QStringList expanded() const;
+    void setExpanded(const QStringList&);
 
-signals:
+private:
+    void projectOpened();
+    void rowsInserted(const QModelIndex&, const int, const int);
+    void expandPending(const QModelIndex&);
+    void collectExpanded(const QModelIndex&, QStringList&) const;
+    void activated(const QModelIndex&);
+    void contextMenu(const QPoint&);
 
+signals:
+    void fileActivated(const QString&);
 };
 
-#endif // PROJECTTAB_H
+#endif // GOEDIT_PROJECT_TAB_H
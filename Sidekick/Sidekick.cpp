@@ -26,7 +26,9 @@
 /*------- include files:
 -------------------------------------------------------------------*/
 #include <QAction>
+#include <QTabWidget>
 #include "Sidekick/ProjectTab.h"
+#include "Sidekick/GraphTab.h"
 #include "Sidekick.h"
 
 //*******************************************************************
@@ -34,11 +36,25 @@
 //*******************************************************************
 Sidekick::Sidekick(QWidget *parent)
     : QDockWidget(parent)
+    , _tabs(new QTabWidget)
     , _projectTab(new ProjectTab)
+    , _graphTab(new GraphTab)
 {
     setObjectName("Sidekick");
     toggleViewAction()->setIcon(QIcon(":/img/DockHorizontalIcon"));
     setAllowedAreas(Qt::LeftDockWidgetArea | Qt::RightDockWidgetArea);
     setWindowTitle("Sidekick");
-    setWidget(_projectTab);
+
+    _tabs->setDocumentMode(true);
+    _tabs->addTab(_projectTab, "Files");
+    _tabs->addTab(_graphTab, "Imports");
+    setWidget(_tabs);
+}
+
+/********************************************************************
+*                             setProject                     public *
+********************************************************************/
+void Sidekick::setProject(Project* project) {
+    _projectTab->setProject(project);
+    _graphTab->setProject(project);
 }
@@ -31,7 +31,10 @@
 
 /*------- forward declarations:
 -------------------------------------------------------------------*/
+class QTabWidget;
 class ProjectTab;
+class GraphTab;
+class Project;
 
 
 /********************************************************************
@@ -40,9 +43,18 @@ class ProjectTab;
 class Sidekick : public QDockWidget {
     Q_OBJECT
 
+    QTabWidget* const _tabs;
     ProjectTab* const _projectTab;
+    GraphTab* const _graphTab;
 public:
     explicit Sidekick(QWidget* = nullptr);
+    void setProject(Project*);
+    ProjectTab* projectTab() const {
+        return _projectTab;
+    }
+    GraphTab* graphTab() const {
+        return _graphTab;
+    }
 };
 
 #endif // GOEDIT_SIDEKICK_H
@@ -0,0 +1,73 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoDocTest.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QtTest>
+#include <string>
+#include "GoDocTest.h"
+#include "Go/GoDoc.h"
+
+/********************************************************************
+*                            declaration                    private *
+*-------------------------------------------------------------------*
+* Declaration of the first symbol of the source. The unterminated   *
+* ones used to hang the lexer loop of GoDoc::declaration.           *
+********************************************************************/
+void GoDocTest::declaration_data() {
+    QTest::addColumn<QByteArray>("source");
+    QTest::addColumn<QByteArray>("expected");
+    QTest::newRow("function") << QByteArray("package p\n\nfunc F(a int) error {\n\treturn nil\n}\n")
+                              << QByteArray("func F(a int) error");
+    QTest::newRow("constant in group") << QByteArray("package p\n\nconst (\n\tA = 1\n\tB = 2\n)\n")
+                                       << QByteArray("A = 1");
+    QTest::newRow("comment at end") << QByteArray("const t/*") << QByteArray("const t/*");
+    QTest::newRow("raw string at end") << QByteArray("package p\n\nvar s = `abc") << QByteArray("var s = `abc");
+    QTest::newRow("comment in group at end") << QByteArray("package p\n\nconst (\n\tA = 1 /* one\n")
+                                             << QByteArray("A = 1 /* one");
+}
+
+void GoDocTest::declaration() {
+    QFETCH(QByteArray, source);
+    QFETCH(QByteArray, expected);
+    const std::string_view text(source.constData(), size_t(source.size()));
+    GoParser parser(text);
+    const auto symbols = parser.parse();
+    QVERIFY(!symbols.empty());
+    QCOMPARE(QByteArray::fromStdString(GoDoc(text).declaration(symbols[0])), expected);
+}
+
+/********************************************************************
+*                              comment                      private *
+*-------------------------------------------------------------------*
+* Directives are left out of the comment above a declaration.       *
+********************************************************************/
+void GoDocTest::comment() {
+    const std::string text = "package p\n\n// F does it.\n//go:noinline\nfunc F() {}\n";
+    GoParser parser(text);
+    const auto symbols = parser.parse();
+    QCOMPARE(symbols.size(), size_t(1));
+    QCOMPARE(GoDoc(text).comment(symbols[0].line), std::string("F does it.\n"));
+}
@@ -0,0 +1,98 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GoParserTest.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QtTest>
+#include <string>
+#include "GoParserTest.h"
+#include "Go/GoParser.h"
+
+/********************************************************************
+*                           declarations                    private *
+********************************************************************/
+void GoParserTest::declarations() {
+    GoParser parser("package p\n\nimport \"fmt\"\n\ntype T struct {\n\tA int\n}\n\nfunc (t *T) M() {\n\tfmt.Println()\n}\n");
+    const auto symbols = parser.parse();
+    QCOMPARE(parser.package(), std::string("p"));
+    QCOMPARE(parser.imports().size(), size_t(1));
+    QCOMPARE(symbols.size(), size_t(3));
+    QCOMPARE(symbols[0].name, std::string("T"));
+    QCOMPARE(symbols[1].name, std::string("A"));
+    QCOMPARE(symbols[1].container, std::string("T"));
+    QCOMPARE(symbols[2].name, std::string("M"));
+    QCOMPARE(symbols[2].container, std::string("T"));
+}
+
+/********************************************************************
+*                        unterminatedAtEnd                  private *
+*-------------------------------------------------------------------*
+* A block comment or a raw string open at the end of the file must  *
+* end the parse (it used to loop forever).                          *
+********************************************************************/
+void GoParserTest::unterminatedAtEnd_data() {
+    QTest::addColumn<QByteArray>("source");
+    QTest::addColumn<int>("symbols");
+    QTest::newRow("comment") << QByteArray("/*") << 0;
+    QTest::newRow("raw string") << QByteArray("`") << 0;
+    QTest::newRow("comment in body") << QByteArray("package p\n\nfunc F() {\n\t/* todo\n") << 1;
+    QTest::newRow("raw string value") << QByteArray("package p\n\nvar s = `abc") << 1;
+    QTest::newRow("comment after name") << QByteArray("const t/*") << 1;
+}
+
+void GoParserTest::unterminatedAtEnd() {
+    QFETCH(QByteArray, source);
+    QFETCH(int, symbols);
+    GoParser parser(std::string_view(source.constData(), size_t(source.size())));
+    QCOMPARE(int(parser.parse().size()), symbols);
+}
+
+/********************************************************************
+*                        lexerEndsInComment                 private *
+*-------------------------------------------------------------------*
+* Run line by line, the lexer returns End at the end of a line      *
+* inside a comment and keeps the state for the next line.           *
+********************************************************************/
+void GoParserTest::lexerEndsInComment() {
+    using Lexer = GoLexer<char>;
+    const std::string first = "x := 1 /* one";
+    Lexer lexer(first.data(), int(first.size()));
+    GoToken token;
+    int tokens = 0;
+    while ((token = lexer.next()).kind != GoToken::End) {
+        QVERIFY(++tokens < 10);
+    }
+    QCOMPARE(lexer.state(), Lexer::InComment);
+
+    Lexer empty("", 0, Lexer::InComment);
+    QCOMPARE(int(empty.next().kind), int(GoToken::End));
+    QCOMPARE(empty.state(), Lexer::InComment);
+
+    const std::string second = "two */ y";
+    Lexer next(second.data(), int(second.size()), Lexer::InComment);
+    QCOMPARE(int(next.next().kind), int(GoToken::Comment));
+    QCOMPARE(int(next.next().kind), int(GoToken::Identifier));
+    QCOMPARE(next.state(), Lexer::Normal);
+}
@@ -0,0 +1,80 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : StringPoolTest.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QtTest>
+#include <string>
+#include "StringPoolTest.h"
+#include "Shared/StringPool.h"
+
+/********************************************************************
+*                            emptyString                    private *
+*-------------------------------------------------------------------*
+* The root of the project is the directory "", usually the first    *
+* string interned into a new pool.                                  *
+********************************************************************/
+void StringPoolTest::emptyString() {
+    StringPool pool;
+    const uint32_t id = pool.intern("");
+    QCOMPARE(pool[id].size(), size_t(0));
+    QCOMPARE(pool.intern(""), id);
+    QCOMPARE(pool.find(""), id);
+
+    pool.clear();
+    QCOMPARE(pool.find(""), StringPool::None);
+    QCOMPARE(pool[pool.intern("")].size(), size_t(0));
+}
+
+/********************************************************************
+*                       sameIdForEqualStrings               private *
+********************************************************************/
+void StringPoolTest::sameIdForEqualStrings() {
+    StringPool pool;
+    const std::string a = "pkg/file.go";
+    const uint32_t id = pool.intern(a);
+    QCOMPARE(pool.intern(std::string(a)), id);
+    QVERIFY(pool.intern("pkg") != id);
+    QCOMPARE(pool.find("missing"), StringPool::None);
+    QCOMPARE(std::string(pool[id]), a);
+}
+
+/********************************************************************
+*                           largeStrings                    private *
+*-------------------------------------------------------------------*
+* Strings longer than a quarter of a chunk get blocks of their own, *
+* views of the small ones stay valid meanwhile.                     *
+********************************************************************/
+void StringPoolTest::largeStrings() {
+    StringPool pool;
+    const uint32_t small = pool.intern("small");
+    const std::string large(100 * 1024, 'x');
+    const uint32_t id = pool.intern(large);
+    for (int i = 0; i < 10000; i++) {
+        pool.intern(std::to_string(i));
+    }
+    QCOMPARE(std::string(pool[id]), large);
+    QCOMPARE(std::string(pool[small]), std::string("small"));
+}
@@ -0,0 +1,44 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : StringPoolTest.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_STRING_POOL_TEST_H
+#define GOEDIT_STRING_POOL_TEST_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+
+/********************************************************************
+*                          StringPoolTest                           *
+********************************************************************/
+class StringPoolTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void emptyString();
+    void sameIdForEqualStrings();
+    void largeStrings();
+};
+
+#endif // GOEDIT_STRING_POOL_TEST_H
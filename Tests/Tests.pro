@@ -0,0 +1,25 @@
+# Unit tests of the parts without GUI:
+#   qmake Tests/Tests.pro && make && ./goedit-tests
+
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+INCLUDEPATH += $$PWD/..
+
+TARGET = goedit-tests
+
+SOURCES += \
+    $$PWD/../Go/GoDoc.cpp \
+    $$PWD/../Go/GoParser.cpp \
+    $$PWD/../Shared/StringPool.cpp \
+    GoDocTest.cpp \
+    GoParserTest.cpp \
+    StringPoolTest.cpp \
+    main.cpp
+
+HEADERS += \
+    GoDocTest.h \
+    GoParserTest.h \
+    StringPoolTest.h
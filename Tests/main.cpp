@@ -0,0 +1,19 @@
+#include <QCoreApplication>
+#include <QtTest>
+#include "GoDocTest.h"
+#include "GoParserTest.h"
+#include "StringPoolTest.h"
+
+// Runs all test classes, the exit status is the number of failed ones.
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    int failed = 0;
+
+    GoDocTest goDoc;
+    failed += QTest::qExec(&goDoc, argc, argv) ? 1 : 0;
+    GoParserTest goParser;
+    failed += QTest::qExec(&goParser, argc, argv) ? 1 : 0;
+    StringPoolTest stringPool;
+    failed += QTest::qExec(&stringPool, argc, argv) ? 1 : 0;
+    return failed;
+}
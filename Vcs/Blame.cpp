@@ -0,0 +1,107 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Blame.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QHash>
+#include "Blame.h"
+
+/********************************************************************
+*                               parse                 public static *
+*-------------------------------------------------------------------*
+* Every group starts with "<hash> <orig> <final> [<count>]". Header *
+* lines (author, summary, ...) follow only the first group of a     *
+* commit, the content of the line is the last one, after a tab.     *
+********************************************************************/
+Blame Blame::parse(const QByteArray& data) {
+    Blame blame;
+    QHash<QByteArray, int> ids;
+    int current = -1;
+    int line = -1;
+
+    for (const QByteArray& text : data.split('\n')) {
+        if (text.startsWith('\t')) {
+            if (current >= 0 && line >= 0) {
+                if (size_t(line) >= blame._lines.size()) {
+                    blame._lines.resize(size_t(line) + 1, -1);
+                }
+                blame._lines[size_t(line)] = current;
+            }
+            continue;
+        }
+        const int space = text.indexOf(' ');
+        const QByteArray key = (space < 0) ? text : text.left(space);
+        const QByteArray value = (space < 0) ? QByteArray() : text.mid(space + 1);
+
+        if (isHash(key)) {
+            auto it = ids.find(key);
+            if (it == ids.end()) {
+                it = ids.insert(key, int(blame._commits.size()));
+                blame._commits.push_back({QString::fromLatin1(key), QString(), 0, QString()});
+            }
+            current = it.value();
+            line = value.split(' ').value(1).toInt() - 1;
+        } else if (current >= 0) {
+            Commit& commit = blame._commits[size_t(current)];
+            if (key == "author") {
+                commit.author = QString::fromUtf8(value);
+            } else if (key == "author-time") {
+                commit.time = value.toLongLong();
+            } else if (key == "summary") {
+                commit.summary = QString::fromUtf8(value);
+            }
+        }
+    }
+    return blame;
+}
+
+/********************************************************************
+*                              commit                        public *
+*-------------------------------------------------------------------*
+* Commit of the line (0-based) or nullptr when it's not known.      *
+********************************************************************/
+const Blame::Commit* Blame::commit(const int line) const {
+    if (line < 0 || line >= lineCount() || _lines[size_t(line)] < 0) {
+        return nullptr;
+    }
+    return &_commits[size_t(_lines[size_t(line)])];
+}
+
+/********************************************************************
+*                              isHash                private static *
+*-------------------------------------------------------------------*
+* Object name: SHA-1 (40) or SHA-256 (64) hex digits.               *
+********************************************************************/
+bool Blame::isHash(const QByteArray& text) {
+    if (text.size() != 40 && text.size() != 64) {
+        return false;
+    }
+    for (const char c : text) {
+        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+            return false;
+        }
+    }
+    return true;
+}
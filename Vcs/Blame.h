@@ -0,0 +1,65 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Blame.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_BLAME_H
+#define GOEDIT_BLAME_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <QByteArray>
+#include <vector>
+
+/********************************************************************
+*                               Blame                               *
+*-------------------------------------------------------------------*
+* Commit of every line of a file revision, parsed from the output   *
+* of 'git blame --porcelain'. Lines share the commit records.       *
+********************************************************************/
+class Blame {
+public:
+    struct Commit {
+        QString id;
+        QString author;
+        qint64 time;        // seconds since epoch
+        QString summary;
+    };
+private:
+    std::vector<Commit> _commits;
+    std::vector<int> _lines;    // index of the commit of every line
+public:
+    static Blame parse(const QByteArray&);
+
+    bool isEmpty() const {
+        return _lines.empty();
+    }
+    int lineCount() const {
+        return int(_lines.size());
+    }
+    const Commit* commit(const int) const;
+private:
+    static bool isHash(const QByteArray&);
+};
+
+#endif // GOEDIT_BLAME_H
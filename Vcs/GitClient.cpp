@@ -0,0 +1,331 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GitClient.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QElapsedTimer>
+#include <QProcess>
+#include <QTimer>
+#include <QtConcurrent>
+#include <QDebug>
+#include "GitClient.h"
+#include "Shared/SQLite/SQLite.h"
+#include "Shared/SQLite/Field.h"
+
+/*------- namespaces:
+-------------------------------------------------------------------*/
+using namespace beesoft::sqlite;
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int ProcessTimeoutMs = 10000;
+static constexpr int BlameTimeoutMs = 60000;
+static constexpr int WatchDelayMs = 300;        // git writes several files at once
+static constexpr int PollMs = 50;               // how soon a dropped command is killed
+
+//*******************************************************************
+//                             GitClient                        CTOR
+//*******************************************************************
+GitClient::GitClient(QObject* parent)
+    : QObject(parent)
+    , _watcher(new QFileSystemWatcher(this))
+    , _timer(new QTimer(this))
+    , _epoch(0)
+{
+    _pool.setMaxThreadCount(2);
+    _timer->setSingleShot(true);
+    _timer->setInterval(WatchDelayMs);
+    connect(_watcher, &QFileSystemWatcher::directoryChanged, _timer, QOverload<>::of(&QTimer::start));
+    connect(_watcher, &QFileSystemWatcher::fileChanged, _timer, QOverload<>::of(&QTimer::start));
+    connect(_timer, &QTimer::timeout, this, &GitClient::checkHead);
+}
+
+/********************************************************************
+*                            ~GitClient                        dtor *
+********************************************************************/
+GitClient::~GitClient() {
+    cancel();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Looks for the repository of the directory in background. When one *
+* is found, headChanged() is emitted so bases can be loaded.        *
+********************************************************************/
+void GitClient::start(const QString& dir) {
+    stop();
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, epoch, dir] {
+        QByteArray dirs;
+        if (!git(dir, {"rev-parse", "--show-toplevel", "--absolute-git-dir"}, dirs, ProcessTimeoutMs, epoch)) {
+            return;     // not a repository or no git at all
+        }
+        const QList<QByteArray> lines = dirs.trimmed().split('\n');
+        if (lines.size() < 2) {
+            return;
+        }
+        QByteArray head;
+        git(dir, {"rev-parse", "--verify", "-q", "HEAD"}, head, ProcessTimeoutMs, epoch);
+
+        const QString root = QString::fromLocal8Bit(lines[0].trimmed());
+        const QString gitDir = QString::fromLocal8Bit(lines[1].trimmed());
+        QMetaObject::invokeMethod(this, [this, epoch, root, gitDir, head = QString::fromLatin1(head.trimmed())] {
+            if (epoch != _epoch) {
+                return;
+            }
+            _root = root;
+            _gitDir = gitDir;
+            _head = head;
+            watch();
+            emit headChanged();
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               stop                         public *
+*-------------------------------------------------------------------*
+* Results of commands still running are dropped. Without repository *
+* editors lose their bases, so headChanged() is emitted.            *
+********************************************************************/
+void GitClient::stop() {
+    cancel();
+    _timer->stop();
+
+    const QStringList paths = _watcher->files() + _watcher->directories();
+    if (!paths.isEmpty()) {
+        _watcher->removePaths(paths);
+    }
+    if (isActive()) {
+        _root.clear();
+        _gitDir.clear();
+        _head.clear();
+        emit headChanged();
+    }
+}
+
+/********************************************************************
+*                              cancel                        public *
+*-------------------------------------------------------------------*
+* Drops waiting commands and kills running ones (they notice it     *
+* within PollMs), so nothing touches the project database after     *
+* that and the GUI thread doesn't wait for a long blame.            *
+********************************************************************/
+void GitClient::cancel() {
+    ++_epoch;
+    _pool.clear();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                             loadBase                       public *
+*-------------------------------------------------------------------*
+* Text of the file at HEAD, reported by baseLoaded(). Files outside *
+* of the repository and untracked ones have no base.                *
+********************************************************************/
+void GitClient::loadBase(const QString& path) {
+    if (!isActive()) {
+        emit baseLoaded(path, QByteArray(), false);
+        return;
+    }
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, epoch, root = _root, path] {
+        QByteArray text;
+        const QString rel = relativePath(root, path);
+        const bool tracked = !rel.isEmpty() && git(root, {"cat-file", "blob", "HEAD:" + rel}, text, ProcessTimeoutMs, epoch);
+        if (!tracked) {
+            text.clear();
+        }
+        QMetaObject::invokeMethod(this, [this, epoch, path, text, tracked] {
+            if (epoch == _epoch) {
+                emit baseLoaded(path, text, tracked);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                             loadBlame                      public *
+*-------------------------------------------------------------------*
+* Blame of the file at HEAD, reported by blameLoaded(). It's empty  *
+* when the file has no committed revision.                          *
+********************************************************************/
+void GitClient::loadBlame(const QString& path) {
+    if (!isActive()) {
+        emit blameLoaded(path, Blame());
+        return;
+    }
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, epoch, root = _root, path] {
+        const Blame result = Blame::parse(blame(root, relativePath(root, path), epoch));
+        QMetaObject::invokeMethod(this, [this, epoch, path, result] {
+            if (epoch == _epoch) {
+                emit blameLoaded(path, result);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               watch                       private *
+*-------------------------------------------------------------------*
+* HEAD and packed-refs are replaced in the git directory, logs/HEAD *
+* is appended on every move of HEAD (it appears with the first      *
+* commit, so it's added again after each change).                   *
+********************************************************************/
+void GitClient::watch() {
+    if (!_watcher->directories().contains(_gitDir)) {
+        _watcher->addPath(_gitDir);
+    }
+    const QString log = _gitDir + "/logs/HEAD";
+    if (QFileInfo::exists(log) && !_watcher->files().contains(log)) {
+        _watcher->addPath(log);
+    }
+}
+
+/********************************************************************
+*                             checkHead                     private *
+*-------------------------------------------------------------------*
+* Something changed in the git directory, mostly the index. Only a  *
+* new commit of HEAD is reported; commands still running for the    *
+* old one are dropped.                                              *
+********************************************************************/
+void GitClient::checkHead() {
+    if (!isActive()) {
+        return;
+    }
+    const quint32 epoch = _epoch;
+    QtConcurrent::run(&_pool, [this, epoch, root = _root] {
+        QByteArray head;
+        git(root, {"rev-parse", "--verify", "-q", "HEAD"}, head, ProcessTimeoutMs, epoch);
+        QMetaObject::invokeMethod(this, [this, epoch, head = QString::fromLatin1(head.trimmed())] {
+            if (epoch != _epoch) {
+                return;
+            }
+            watch();
+            if (head != _head) {
+                ++_epoch;
+                _head = head;
+                emit headChanged();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               blame                       private *
+*-------------------------------------------------------------------*
+* Porcelain blame of the last revision which changed the file. The  *
+* output is cached (compressed) in the project database, only the   *
+* entry of the current revision is kept for a file.                 *
+********************************************************************/
+QByteArray GitClient::blame(const QString& root, const QString& rel, const quint32 epoch) {
+    QByteArray revision;
+    if (rel.isEmpty() || !git(root, {"rev-list", "-1", "HEAD", "--", rel}, revision, ProcessTimeoutMs, epoch)) {
+        return QByteArray();
+    }
+    revision = revision.trimmed();
+    if (revision.isEmpty()) {
+        return QByteArray();
+    }
+
+    auto& db = SQLite::shared();
+    const Field path("path", rel.toStdString());
+    const Field rev("revision", revision.toStdString());
+    if (db.isOpen()) {
+        const auto rows = db.select("SELECT data FROM blame WHERE path = :path AND revision = :revision", {path, rev});
+        if (!rows.empty()) {
+            const auto blob = rows[0][0].as_vector();
+            return qUncompress(QByteArray(blob.data(), int(blob.size())));
+        }
+    }
+
+    QByteArray data;
+    if (!git(root, {"blame", "--porcelain", QString::fromLatin1(revision), "--", rel}, data, BlameTimeoutMs, epoch)) {
+        return QByteArray();
+    }
+    if (db.isOpen()) {
+        const QByteArray packed = qCompress(data);
+        const bool ok = db.transaction([&](SQLite& db) {
+            return db.exec("DELETE FROM blame WHERE path = :path", {path})
+                   && db.exec("INSERT INTO blame (path, revision, data) VALUES (:path, :revision, :data)",
+                              {path, rev, Field("data", packed.constData(), packed.size())});
+        });
+        if (!ok) {
+            qWarning() << "GitClient: can't cache blame of" << rel;
+        }
+    }
+    return data;
+}
+
+/********************************************************************
+*                           relativePath             private static *
+*-------------------------------------------------------------------*
+* Path of the file in the work tree 'root' (which git reports       *
+* canonical), empty for files outside of it.                        *
+********************************************************************/
+QString GitClient::relativePath(const QString& root, const QString& path) {
+    const QString canonical = QFileInfo(path).canonicalFilePath();
+    if (!canonical.startsWith(root + '/')) {
+        return QString();
+    }
+    return canonical.mid(root.size() + 1);
+}
+
+/********************************************************************
+*                                git                        private *
+*-------------------------------------------------------------------*
+* Runs git in the directory and waits for it (called in background  *
+* threads only). False when it can't run, fails, times out or its   *
+* epoch is dropped meanwhile - then the process is killed.          *
+********************************************************************/
+bool GitClient::git(const QString& dir, const QStringList& args, QByteArray& output, const int timeoutMs, const quint32 epoch) {
+    QProcess process;
+    process.setWorkingDirectory(dir);
+    process.start("git", args);
+    if (!process.waitForStarted(timeoutMs)) {
+        return false;
+    }
+    QElapsedTimer elapsed;
+    elapsed.start();
+    while (!process.waitForFinished(PollMs)) {
+        if (process.state() == QProcess::NotRunning) {
+            return false;
+        }
+        if (epoch != _epoch || elapsed.hasExpired(timeoutMs)) {
+            process.kill();
+            process.waitForFinished();
+            return false;
+        }
+    }
+    if (process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0) {
+        return false;
+    }
+    output = process.readAllStandardOutput();
+    return true;
+}
@@ -0,0 +1,90 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : GitClient.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_GIT_CLIENT_H
+#define GOEDIT_GIT_CLIENT_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include <atomic>
+#include "Vcs/Blame.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QFileSystemWatcher;
+class QTimer;
+
+/********************************************************************
+*                             GitClient                             *
+*-------------------------------------------------------------------*
+* Git repository of the project. Everything comes from git commands *
+* run in background threads, the GUI thread never waits for them:   *
+* texts of files at HEAD (base of the change markers of editors)    *
+* and blame, cached per file revision in the project database.      *
+* Moves of HEAD (commit, checkout, reset) are noticed by watching   *
+* the git directory.                                                *
+********************************************************************/
+class GitClient : public QObject {
+    Q_OBJECT
+
+    QString _root;          // top level of the work tree, empty without repository
+    QString _gitDir;
+    QString _head;          // commit id, empty before the first commit
+    QFileSystemWatcher* const _watcher;
+    QTimer* const _timer;
+    std::atomic<quint32> _epoch;
+    QThreadPool _pool;
+public:
+    explicit GitClient(QObject* = nullptr);
+    ~GitClient() override;
+
+    void start(const QString&);
+    void stop();
+    void cancel();
+    bool isActive() const {
+        return !_root.isEmpty();
+    }
+    QString root() const {
+        return _root;
+    }
+    void loadBase(const QString&);
+    void loadBlame(const QString&);
+
+private:
+    void watch();
+    void checkHead();
+    QByteArray blame(const QString&, const QString&, const quint32);
+    bool git(const QString&, const QStringList&, QByteArray&, const int, const quint32);
+    static QString relativePath(const QString&, const QString&);
+
+signals:
+    void headChanged();
+    void baseLoaded(const QString&, const QByteArray&, const bool);
+    void blameLoaded(const QString&, const Blame&);
+};
+
+#endif // GOEDIT_GIT_CLIENT_H
@@ -0,0 +1,461 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : BracketTree.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <algorithm>
+#include <climits>
+#include "BracketTree.h"
+#include "Go/GoLexer.h"
+
+namespace {
+    using Lexer = GoLexer<char16_t>;
+
+    bool before(const int line, const int column, const int otherLine, const int otherColumn) {
+        return line < otherLine || (line == otherLine && column < otherColumn);
+    }
+}
+
+/********************************************************************
+*                               reset                        public *
+*-------------------------------------------------------------------*
+* Empty tree of 'count' lines, they are all to be scanned.          *
+********************************************************************/
+void BracketTree::reset(const int count) {
+    _lines.assign(size_t(count), {{}, Unknown, 0});
+    _pairs.clear();
+}
+
+/********************************************************************
+*                               shift                        public *
+*-------------------------------------------------------------------*
+* Lines were added (delta > 0) or removed after the line 'line'.    *
+* Positions of pairs below it move with their lines; the ones on    *
+* removed lines end up on 'line' and are replaced by the next match *
+* of the lines of the edit.                                         *
+********************************************************************/
+void BracketTree::shift(const int line, const int delta) {
+    if (delta == 0) {
+        return;
+    }
+    // The line below the edit was scanned after the end state of the
+    // last line the edit replaced, that state goes to its new place.
+    if (delta > 0) {
+        _lines.insert(_lines.begin() + line + 1, size_t(delta), {{}, Unknown, 0});
+        _lines[size_t(line + delta)].state = _lines[size_t(line)].state;
+        _lines[size_t(line)].state = Unknown;
+    } else {
+        const int n = std::min(-delta, int(_lines.size()) - line - 1);
+        if (n > 0) {
+            _lines[size_t(line)].state = _lines[size_t(line + n)].state;
+            _lines.erase(_lines.begin() + line + 1, _lines.begin() + line + 1 + n);
+        }
+    }
+
+    auto move = [line, delta](int& value) {
+        if (value > line) {
+            value = std::max(line, value + delta);
+        }
+    };
+    for (Pair& pair : _pairs) {
+        move(pair.openLine);
+        move(pair.closeLine);
+    }
+}
+
+/********************************************************************
+*                               scan                         public *
+*-------------------------------------------------------------------*
+* Finds brackets of the line 'text' (without the line separator).   *
+* The lexer starts in the state the previous line ended in. Returns *
+* true when the state at the end of line changed, so the next line  *
+* must be scanned too.                                              *
+********************************************************************/
+bool BracketTree::scan(const int line, const char16_t* text, const int size) {
+    uint8_t start = Lexer::Normal;
+    if (line > 0 && _lines[size_t(line - 1)].state != Unknown) {
+        start = _lines[size_t(line - 1)].state;
+    }
+    Line& current = _lines[size_t(line)];
+    current.brackets.clear();
+    current.flags = 0;
+
+    Lexer lexer(text, size, Lexer::State(start));
+    int tokens = 0;
+    bool lineComment = false;
+    for (;;) {
+        const GoToken token = lexer.next();
+        if (token.kind == GoToken::End) {
+            break;
+        }
+        if (token.length == 0) {
+            continue;
+        }
+        ++tokens;
+        switch (token.kind) {
+        case GoToken::LParen:
+        case GoToken::RParen:
+            current.brackets.push_back({token.begin, Paren, token.kind == GoToken::LParen});
+            break;
+        case GoToken::LBrace:
+        case GoToken::RBrace:
+            current.brackets.push_back({token.begin, Brace, token.kind == GoToken::LBrace});
+            break;
+        case GoToken::LBracket:
+        case GoToken::RBracket:
+            current.brackets.push_back({token.begin, Bracket, token.kind == GoToken::LBracket});
+            break;
+        case GoToken::Comment:
+            lineComment = start == Lexer::Normal && token.length > 1 && text[token.begin + 1] == u'/';
+            break;
+        default:
+            break;
+        }
+    }
+    if (lineComment && tokens == 1) {
+        current.flags |= CommentLine;
+    }
+
+    const uint8_t state = lexer.state();
+    const bool changed = state != current.state;
+    current.state = state;
+    return changed;
+}
+
+/********************************************************************
+*                               match                        public *
+*-------------------------------------------------------------------*
+* Matches pairs again after the lines [first, last] were scanned.   *
+* In the innermost pair enclosing the lines only its children that  *
+* touch the lines are rebuilt (from the brackets kept for lines),   *
+* between the neighbours they have. When the brackets there do not  *
+* balance, the level up is tried, at last the whole document.       *
+********************************************************************/
+void BracketTree::match(const int first, const int last) {
+    // Path from the top to the innermost pair enclosing the lines.
+    std::vector<int> path;
+    for (int i = 0, end = int(_pairs.size()); i < end;) {
+        const Pair& pair = _pairs[size_t(i)];
+        if (pair.openLine > last) {
+            break;
+        }
+        if (pair.openLine < first && pair.closeLine > last) {
+            path.push_back(i);
+            end = i + pair.size;
+            ++i;
+            continue;
+        }
+        i += pair.size;
+    }
+
+    std::vector<Pair> inner;
+    for (int k = int(path.size()) - 1; k >= -1; k--) {
+        // Children of the pair path[k] (or top level pairs), the ones
+        // in [from, to) touch the lines and are matched again.
+        int begin = 0;
+        int end = int(_pairs.size());
+        int startLine = 0;
+        int startColumn = 0;
+        int stopLine = int(_lines.size()) - 1;
+        int stopColumn = INT_MAX;
+        if (k >= 0) {
+            const Pair& parent = _pairs[size_t(path[size_t(k)])];
+            begin = path[size_t(k)] + 1;
+            end = path[size_t(k)] + parent.size;
+            startLine = parent.openLine;
+            startColumn = parent.openColumn + 1;
+            stopLine = parent.closeLine;
+            stopColumn = parent.closeColumn;
+        }
+        int from = begin;
+        int to = begin;
+        for (int i = begin; i < end; i += _pairs[size_t(i)].size) {
+            const Pair& pair = _pairs[size_t(i)];
+            if (pair.closeLine < first) {
+                from = to = i + pair.size;
+                startLine = pair.closeLine;
+                startColumn = pair.closeColumn + 1;
+                continue;
+            }
+            if (pair.openLine > last) {
+                stopLine = pair.openLine;
+                stopColumn = pair.openColumn;
+                break;
+            }
+            to = i + pair.size;
+        }
+
+        inner.clear();
+        if (!rematch(startLine, startColumn, stopLine, stopColumn, false, inner)) {
+            continue;
+        }
+        _pairs.erase(_pairs.begin() + from, _pairs.begin() + to);
+        _pairs.insert(_pairs.begin() + from, inner.begin(), inner.end());
+        const int diff = int(inner.size()) - (to - from);
+        for (int a = 0; a <= k; a++) {
+            _pairs[size_t(path[size_t(a)])].size += diff;
+        }
+        return;
+    }
+
+    inner.clear();
+    if (!_lines.empty()) {
+        rematch(0, 0, int(_lines.size()) - 1, INT_MAX, true, inner);
+    }
+    _pairs.swap(inner);
+}
+
+/********************************************************************
+*                             matching                       public *
+*-------------------------------------------------------------------*
+* Position of the bracket paired with the one at (line, column).    *
+* Returns false when there is no bracket there or it is unpaired.   *
+********************************************************************/
+bool BracketTree::matching(const int line, const int column, int& otherLine, int& otherColumn) const {
+    for (int i = 0, end = int(_pairs.size()); i < end;) {
+        const Pair& pair = _pairs[size_t(i)];
+        if (before(line, column, pair.openLine, pair.openColumn)) {
+            break;
+        }
+        if (pair.openLine == line && pair.openColumn == column) {
+            otherLine = pair.closeLine;
+            otherColumn = pair.closeColumn;
+            return pair.closed;
+        }
+        if (pair.closed && pair.closeLine == line && pair.closeColumn == column) {
+            otherLine = pair.openLine;
+            otherColumn = pair.openColumn;
+            return true;
+        }
+        if (before(line, column, pair.closeLine, pair.closeColumn)) {
+            end = i + pair.size;
+            ++i;
+            continue;
+        }
+        i += pair.size;
+    }
+    return false;
+}
+
+/********************************************************************
+*                              region                        public *
+*-------------------------------------------------------------------*
+* Foldable region with the header on the line 'line'. When a few    *
+* pairs open on the line, the outermost one is taken.               *
+********************************************************************/
+bool BracketTree::region(const int line, Region& result) const {
+    for (int i = 0, end = int(_pairs.size()); i < end;) {
+        const Pair& pair = _pairs[size_t(i)];
+        if (pair.openLine > line) {
+            break;
+        }
+        if (pair.openLine == line && pairRegion(pair, result)) {
+            return true;
+        }
+        if (pair.closeLine > line) {
+            end = i + pair.size;
+            ++i;
+            continue;
+        }
+        i += pair.size;
+    }
+    return commentRegion(line, result);
+}
+
+/********************************************************************
+*                             regionsAt                      public *
+*-------------------------------------------------------------------*
+* Foldable regions the line 'line' belongs to (as the header or as  *
+* a hidden line), the outermost first.                              *
+********************************************************************/
+std::vector<BracketTree::Region> BracketTree::regionsAt(const int line) const {
+    std::vector<Region> result;
+    Region region;
+    for (int i = 0, end = int(_pairs.size()); i < end;) {
+        const Pair& pair = _pairs[size_t(i)];
+        if (pair.openLine > line) {
+            break;
+        }
+        if (pair.closeLine > line) {
+            if (pairRegion(pair, region)) {
+                result.push_back(region);
+            }
+            end = i + pair.size;
+            ++i;
+            continue;
+        }
+        i += pair.size;
+    }
+
+    // Comments hold no pairs, so they are the innermost.
+    int header = line;
+    if (_lines[size_t(line)].flags & CommentLine) {
+        while (header > 0 && (_lines[size_t(header - 1)].flags & CommentLine)) {
+            --header;
+        }
+    } else {
+        while (header > 0 && _lines[size_t(header - 1)].state == Lexer::InComment) {
+            --header;
+        }
+    }
+    if (commentRegion(header, region) && region.last >= line) {
+        result.push_back(region);
+    }
+    return result;
+}
+
+/********************************************************************
+*                              regions                       public *
+*-------------------------------------------------------------------*
+* All foldable regions of the document.                             *
+********************************************************************/
+std::vector<BracketTree::Region> BracketTree::regions() const {
+    std::vector<Region> result;
+    Region region;
+    for (const Pair& pair : _pairs) {
+        if (pairRegion(pair, region)) {
+            result.push_back(region);
+        }
+    }
+    for (int line = 0; line < int(_lines.size()); line++) {
+        if (commentRegion(line, region)) {
+            result.push_back(region);
+        }
+    }
+    return result;
+}
+
+/********************************************************************
+*                              rematch                      private *
+*-------------------------------------------------------------------*
+* Pairs of the brackets from (fromLine, fromColumn) inclusive up to *
+* (toLine, toColumn) exclusive, appended to 'out' in preorder.      *
+* Strict matching fails on the first bracket without a pair. The    *
+* tolerant one skips a closing bracket nothing waits for and gives  *
+* up opened pairs it closes over (or that are open at the end).     *
+********************************************************************/
+bool BracketTree::rematch(const int fromLine, const int fromColumn, const int toLine, const int toColumn, const bool tolerant, std::vector<Pair>& out) const {
+    const int base = int(out.size());
+    std::vector<int> stack;
+
+    auto close = [&out, &stack](const int line, const int column, const bool closed) {
+        Pair& pair = out[size_t(stack.back())];
+        pair.closeLine = line;
+        pair.closeColumn = column;
+        pair.size = int(out.size()) - stack.back();
+        pair.closed = closed;
+        stack.pop_back();
+    };
+
+    for (int line = fromLine; line <= toLine; line++) {
+        for (const Mark& bracket : _lines[size_t(line)].brackets) {
+            if (line == fromLine && bracket.column < fromColumn) {
+                continue;
+            }
+            if (line == toLine && bracket.column >= toColumn) {
+                break;
+            }
+            if (bracket.open) {
+                stack.push_back(int(out.size()));
+                out.push_back({line, bracket.column, -1, -1, 1, bracket.kind, false});
+                continue;
+            }
+
+            int depth = int(stack.size()) - 1;
+            if (tolerant) {
+                while (depth >= 0 && out[size_t(stack[size_t(depth)])].kind != bracket.kind) {
+                    --depth;
+                }
+            }
+            if (depth < 0 || out[size_t(stack[size_t(depth)])].kind != bracket.kind) {
+                if (tolerant) {
+                    continue;
+                }
+                out.resize(size_t(base));
+                return false;
+            }
+            while (int(stack.size()) - 1 > depth) {
+                close(line, bracket.column, false);
+            }
+            close(line, bracket.column, true);
+        }
+    }
+
+    if (!stack.empty() && !tolerant) {
+        out.resize(size_t(base));
+        return false;
+    }
+    while (!stack.empty()) {
+        close(toLine, toColumn, false);
+    }
+    return true;
+}
+
+/********************************************************************
+*                           commentRegion                   private *
+*-------------------------------------------------------------------*
+* Region of a run of line comments or of a block comment starting   *
+* on the line 'line'.                                               *
+********************************************************************/
+bool BracketTree::commentRegion(const int line, Region& result) const {
+    const int count = int(_lines.size());
+    const Line& current = _lines[size_t(line)];
+    const uint8_t start = (line > 0) ? _lines[size_t(line - 1)].state : uint8_t(Lexer::Normal);
+
+    if (current.flags & CommentLine) {
+        if (line > 0 && (_lines[size_t(line - 1)].flags & CommentLine)) {
+            return false;
+        }
+        int last = line;
+        while (last + 1 < count && (_lines[size_t(last + 1)].flags & CommentLine)) {
+            ++last;
+        }
+        result = {line, line + 1, last};
+        return last > line;
+    }
+    if (start != Lexer::InComment && current.state == Lexer::InComment && line + 1 < count) {
+        int last = line + 1;
+        while (last + 1 < count && _lines[size_t(last)].state == Lexer::InComment) {
+            ++last;
+        }
+        result = {line, line + 1, last};
+        return true;
+    }
+    return false;
+}
+
+/********************************************************************
+*                            pairRegion              private static *
+*-------------------------------------------------------------------*
+* Lines between the brackets of a block or a group, the line with   *
+* the closing bracket stays visible.                                *
+********************************************************************/
+bool BracketTree::pairRegion(const Pair& pair, Region& result) {
+    if (!pair.closed || pair.kind == Bracket) {
+        return false;
+    }
+    result = {pair.openLine, pair.openLine + 1, pair.closeLine - 1};
+    return result.last >= result.first;
+}
@@ -0,0 +1,112 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : BracketTree.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_BRACKET_TREE_H
+#define GOEDIT_BRACKET_TREE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <vector>
+
+/********************************************************************
+*                            BracketTree                            *
+*-------------------------------------------------------------------*
+* Pairs of brackets of a Go document and the regions folded by the  *
+* editor. Every line keeps its brackets found by GoLexer and the    *
+* lexer state at its end, pairs are kept in preorder (a subtree is  *
+* a contiguous run of the vector). After an edit only the changed   *
+* lines are scanned again and only the pairs inside the smallest    *
+* pair enclosing the edit are matched again; the whole document is  *
+* matched only when the edit unbalances every enclosing pair.       *
+********************************************************************/
+class BracketTree {
+public:
+    enum Kind : uint8_t {
+        Paren = 0,
+        Brace,
+        Bracket
+    };
+    struct Pair {
+        int openLine;
+        int openColumn;
+        int closeLine;
+        int closeColumn;
+        int size;           // pairs in the subtree, this one included
+        Kind kind;
+        bool closed;        // false: the close position is where it was given up
+    };
+    // Header line stays visible, lines [first, last] are hidden.
+    struct Region {
+        int header;
+        int first;
+        int last;
+    };
+private:
+    static constexpr uint8_t Unknown = 0xff;
+
+    enum Flag : uint8_t {
+        CommentLine = 1     // nothing but a line comment
+    };
+    struct Mark {
+        int column;
+        Kind kind;
+        bool open;
+    };
+    struct Line {
+        std::vector<Mark> brackets;
+        uint8_t state;      // lexer state at the end of line
+        uint8_t flags;
+    };
+
+    std::vector<Line> _lines;
+    std::vector<Pair> _pairs;
+public:
+    BracketTree() = default;
+    BracketTree(const BracketTree&) = delete;
+    BracketTree& operator=(const BracketTree&) = delete;
+
+    void reset(const int);
+    void shift(const int, const int);
+    bool scan(const int, const char16_t*, const int);
+    void match(const int, const int);
+
+    bool matching(const int, const int, int&, int&) const;
+    bool region(const int, Region&) const;
+    std::vector<Region> regionsAt(const int) const;
+    std::vector<Region> regions() const;
+
+    int lineCount() const {
+        return int(_lines.size());
+    }
+    const std::vector<Pair>& pairs() const {
+        return _pairs;
+    }
+private:
+    bool rematch(const int, const int, const int, const int, const bool, std::vector<Pair>&) const;
+    bool commentRegion(const int, Region&) const;
+    static bool pairRegion(const Pair&, Region&);
+};
+
+#endif // GOEDIT_BRACKET_TREE_H
@@ -0,0 +1,90 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Buffer.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_BUFFER_H
+#define GOEDIT_BUFFER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <QDateTime>
+#include <QFileInfo>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QWidget;
+
+/********************************************************************
+*                              Buffer                               *
+*-------------------------------------------------------------------*
+* Interface of a document opened in the Workspace. Remembers the    *
+* modification time of the file from the last load/save, so own     *
+* writes are not taken as external changes.                         *
+********************************************************************/
+class Buffer {
+    QString _path;
+    QDateTime _stamp;
+    bool _stale;
+public:
+    Buffer() : _stale(false) {}
+    virtual ~Buffer() = default;
+
+    virtual QWidget* widget() = 0;
+    virtual bool load(const QString&) = 0;
+    virtual bool saveAs(const QString&) = 0;
+    virtual bool isModified() const = 0;
+    virtual void gotoPosition(const int, const int) = 0;
+    virtual QString wordUnderCursor() const = 0;
+    virtual int cursorLine() const = 0;
+    virtual QString text() const = 0;
+
+    bool save() {
+        return saveAs(_path);
+    }
+    QString path() const {
+        return _path;
+    }
+    bool isUntitled() const {
+        return _path.isEmpty();
+    }
+    bool isStale() const {
+        return _stale;
+    }
+    void setStale(const bool state) {
+        _stale = state;
+    }
+    // File on disk is not the one we loaded or saved.
+    bool changedOnDisk() const {
+        const QFileInfo info(_path);
+        return !info.exists() || info.lastModified() != _stamp;
+    }
+protected:
+    void setPath(const QString& path) {
+        _path = path;
+        _stamp = QFileInfo(path).lastModified();
+        _stale = false;
+    }
+};
+
+#endif // GOEDIT_BUFFER_H
@@ -0,0 +1,350 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ChangeBar.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QPlainTextEdit>
+#include <QTextDocument>
+#include <QTextBlock>
+#include <QDateTime>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QHelpEvent>
+#include <QToolTip>
+#include <QTimer>
+#include <QtConcurrent>
+#include "ChangeBar.h"
+#include "Shared/Trace.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static const QColor AddedColor(90, 170, 90);
+static const QColor ModifiedColor(80, 130, 210);
+static const QColor RemovedColor(210, 80, 80);
+
+//*******************************************************************
+//                             ChangeBar                        CTOR
+//*******************************************************************
+ChangeBar::ChangeBar(QPlainTextEdit* editor)
+    : QWidget(editor)
+    , _editor(editor)
+    , _timer(new QTimer(this))
+    , _hasBlame(false)
+    , _blameWanted(false)
+    , _generation(0)
+{
+    _pool.setMaxThreadCount(1);
+    _timer->setSingleShot(true);
+    _timer->setInterval(DelayMs);
+    connect(_timer, &QTimer::timeout, this, &ChangeBar::diff);
+
+    QTextDocument* const doc = _editor->document();
+    for (QTextBlock block = doc->begin(); block.isValid(); block = block.next()) {
+        _lines.push_back(block.text().toUtf8());
+    }
+    _marks.assign(_lines.size(), None);
+
+    connect(doc, &QTextDocument::contentsChange, this, &ChangeBar::contentsChange);
+    connect(_editor, &QPlainTextEdit::updateRequest, this, [this](const QRect& rect, const int dy) {
+        if (dy != 0) {
+            scroll(0, dy);
+        } else {
+            update(0, rect.y(), width(), rect.height());
+        }
+    });
+}
+
+/********************************************************************
+*                            ~ChangeBar                        dtor *
+********************************************************************/
+ChangeBar::~ChangeBar() {
+    _pool.clear();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                              setBase                       public *
+*-------------------------------------------------------------------*
+* Text of the file at HEAD. Line ends and BOM are removed, as they  *
+* are not part of lines of the document.                            *
+********************************************************************/
+void ChangeBar::setBase(const QByteArray& text) {
+    auto base = std::make_shared<Base>();
+    base->text = text;
+    base->text.replace("\r\n", "\n");
+    if (base->text.startsWith("\xEF\xBB\xBF")) {
+        base->text.remove(0, 3);
+    }
+    base->lines = Diff::split(std::string_view(base->text.constData(), size_t(base->text.size())));
+    _base = std::move(base);
+    ++_generation;
+    _timer->stop();
+    diff();
+}
+
+/********************************************************************
+*                             clearBase                      public *
+********************************************************************/
+void ChangeBar::clearBase() {
+    _base.reset();
+    _hunks.clear();
+    _marks.assign(_lines.size(), None);
+    ++_generation;
+    _timer->stop();
+    clearBlame();
+    update();
+}
+
+/********************************************************************
+*                        setBlame/clearBlame                 public *
+********************************************************************/
+void ChangeBar::setBlame(const Blame& blame) {
+    _blame = blame;
+    _hasBlame = true;
+    _blameWanted = false;
+}
+
+void ChangeBar::clearBlame() {
+    _blame = Blame();
+    _hasBlame = false;
+    _blameWanted = false;
+}
+
+/********************************************************************
+*                             describe                       public *
+*-------------------------------------------------------------------*
+* Commit of the line (0-based) of the document, from the blame.     *
+********************************************************************/
+QString ChangeBar::describe(const int line) const {
+    if (!_base || line < 0 || line >= int(_marks.size())) {
+        return QString();
+    }
+    const int base = baseLine(line);
+    if (base < 0) {
+        return "Not committed yet";
+    }
+    const Blame::Commit* const commit = _blame.commit(base);
+    if (!commit) {
+        return QString();
+    }
+    const QString time = QDateTime::fromSecsSinceEpoch(commit->time).toString("yyyy-MM-dd hh:mm");
+    return QString("%1  %2, %3\n%4").arg(commit->id.left(8), commit->author, time, commit->summary);
+}
+
+/********************************************************************
+*                            paintEvent                   protected *
+*-------------------------------------------------------------------*
+* Only lines in the updated part of the view are drawn.             *
+********************************************************************/
+void ChangeBar::paintEvent(QPaintEvent* event) {
+    QPainter painter(this);
+    painter.fillRect(event->rect(), palette().color(QPalette::Base));
+    if (!_base) {
+        return;
+    }
+
+    const int top = event->rect().top();
+    const int bottom = event->rect().bottom();
+    const int count = int(_marks.size());
+    QTextBlock block = _editor->cursorForPosition(QPoint(0, top)).block();
+    for (; block.isValid() && block.blockNumber() < count; block = block.next()) {
+        if (!block.isVisible()) {
+            continue;
+        }
+        const QRect rect = _editor->cursorRect(QTextCursor(block));
+        if (rect.top() > bottom) {
+            break;
+        }
+        switch (_marks[size_t(block.blockNumber())]) {
+        case Added:
+            painter.fillRect(1, rect.top(), Width - 2, rect.height(), AddedColor);
+            break;
+        case Modified:
+            painter.fillRect(1, rect.top(), Width - 2, rect.height(), ModifiedColor);
+            break;
+        case Removed: {
+            const QPoint points[] = {{0, rect.top() - 3}, {Width - 1, rect.top()}, {0, rect.top() + 3}};
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(RemovedColor);
+            painter.drawPolygon(points, 3);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+/********************************************************************
+*                               event                     protected *
+*-------------------------------------------------------------------*
+* Tooltip shows the commit of the line. The blame is loaded on the  *
+* first request only, most files are never asked for it.            *
+********************************************************************/
+bool ChangeBar::event(QEvent* event) {
+    if (event->type() != QEvent::ToolTip) {
+        return QWidget::event(event);
+    }
+    auto const help = static_cast<QHelpEvent*>(event);
+    if (!_base) {
+        QToolTip::hideText();
+        return true;
+    }
+    if (!_hasBlame) {
+        if (!_blameWanted) {
+            _blameWanted = true;
+            emit blameWanted();
+        }
+        QToolTip::showText(help->globalPos(), "Loading blame...", this);
+        return true;
+    }
+    const int line = _editor->cursorForPosition(QPoint(0, help->pos().y())).blockNumber();
+    const QString text = describe(line);
+    if (text.isEmpty()) {
+        QToolTip::hideText();
+    } else {
+        QToolTip::showText(help->globalPos(), text, this);
+    }
+    return true;
+}
+
+/********************************************************************
+*                          contentsChange                   private *
+*-------------------------------------------------------------------*
+* The copy of lines follows the document, only lines of the edit    *
+* are converted again. They are marked changed now, the diff (when  *
+* typing stops) tells what really differs from the base.            *
+********************************************************************/
+void ChangeBar::contentsChange(const int position, const int, const int added) {
+    QTextDocument* const doc = _editor->document();
+    const int count = doc->blockCount();
+    QTextBlock block = doc->findBlock(position);
+    if (!block.isValid()) {
+        return;
+    }
+    const int first = block.blockNumber();
+    const QTextBlock end = doc->findBlock(position + added);
+    const int last = end.isValid() ? qMax(first, end.blockNumber()) : count - 1;
+    const int delta = count - int(_lines.size());
+    ++_generation;
+
+    if (delta > 0) {
+        _lines.insert(_lines.begin() + first + 1, size_t(delta), QByteArray());
+        _marks.insert(_marks.begin() + first + 1, size_t(delta), uint8_t(Added));
+    } else if (delta < 0) {
+        const int n = qMin(-delta, int(_lines.size()) - first - 1);
+        _lines.erase(_lines.begin() + first + 1, _lines.begin() + first + 1 + n);
+        _marks.erase(_marks.begin() + first + 1, _marks.begin() + first + 1 + n);
+    }
+    if (int(_lines.size()) != count) {
+        _lines.resize(size_t(count));
+        _marks.resize(size_t(count), uint8_t(Added));
+    }
+
+    for (int line = first; line <= last && block.isValid(); line++, block = block.next()) {
+        _lines[size_t(line)] = block.text().toUtf8();
+        if (_marks[size_t(line)] == None || _marks[size_t(line)] == Removed) {
+            _marks[size_t(line)] = Modified;
+        }
+    }
+    if (_base) {
+        _timer->start();
+        update();
+    }
+}
+
+/********************************************************************
+*                               diff                        private *
+*-------------------------------------------------------------------*
+* Diffs a copy of the lines (QByteArray is shared, no text is       *
+* copied) with the base in the background. The result is used only  *
+* if the document did not change in the meantime.                   *
+********************************************************************/
+void ChangeBar::diff() {
+    if (!_base) {
+        return;
+    }
+    const quint32 generation = _generation;
+    _pool.clear();
+    QtConcurrent::run(&_pool, [this, generation, base = _base, lines = _lines] {
+        TraceScope trace("diff", "changes");
+        std::vector<std::string_view> current;
+        current.reserve(lines.size());
+        for (const auto& line : lines) {
+            current.emplace_back(line.constData(), size_t(line.size()));
+        }
+        const std::vector<Diff::Hunk> hunks = Diff::lines(base->lines, current);
+        QMetaObject::invokeMethod(this, [this, generation, hunks] {
+            if (generation == _generation) {
+                apply(hunks);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               apply                       private *
+********************************************************************/
+void ChangeBar::apply(const std::vector<Diff::Hunk>& hunks) {
+    _hunks = hunks;
+    _marks.assign(_lines.size(), None);
+    const int count = int(_marks.size());
+    for (const auto& hunk : _hunks) {
+        if (hunk.newCount == 0) {
+            if (count > 0) {
+                _marks[size_t(qMin(hunk.newStart, count - 1))] = Removed;
+            }
+            continue;
+        }
+        const Mark mark = (hunk.oldCount == 0) ? Added : Modified;
+        for (int line = hunk.newStart; line < hunk.newStart + hunk.newCount && line < count; line++) {
+            _marks[size_t(line)] = mark;
+        }
+    }
+    update();
+}
+
+/********************************************************************
+*                             baseLine                      private *
+*-------------------------------------------------------------------*
+* Line of the base shown as the line of the document, -1 when it is *
+* changed. Lines after hunks move by their size difference.         *
+********************************************************************/
+int ChangeBar::baseLine(const int line) const {
+    if (_marks[size_t(line)] == Added || _marks[size_t(line)] == Modified) {
+        return -1;
+    }
+    int delta = 0;
+    for (const auto& hunk : _hunks) {
+        if (line < hunk.newStart) {
+            break;
+        }
+        if (line < hunk.newStart + hunk.newCount) {
+            return -1;
+        }
+        delta += hunk.oldCount - hunk.newCount;
+    }
+    return line + delta;
+}
@@ -0,0 +1,116 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : ChangeBar.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_CHANGE_BAR_H
+#define GOEDIT_CHANGE_BAR_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QWidget>
+#include <QByteArray>
+#include <QThreadPool>
+#include <memory>
+#include <vector>
+#include "Shared/Diff.h"
+#include "Vcs/Blame.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QPlainTextEdit;
+class QTimer;
+
+/********************************************************************
+*                             ChangeBar                             *
+*-------------------------------------------------------------------*
+* Markers of lines added, changed or removed since HEAD, beside the *
+* left edge of the editor. The bar keeps its own UTF-8 copy of the  *
+* lines, updated only for lines touched by an edit; shortly after   *
+* typing stops the copy is diffed with the base in a background     *
+* thread. Until then lines of the edit are marked at once, so the   *
+* markers follow typing without waiting for anything.               *
+********************************************************************/
+class ChangeBar : public QWidget {
+    Q_OBJECT
+public:
+    static constexpr int Width = 6;
+
+    enum Mark : uint8_t {
+        None,
+        Added,
+        Modified,
+        Removed         // lines were removed above this one
+    };
+private:
+    static constexpr int DelayMs = 100;
+
+    struct Base {
+        QByteArray text;
+        std::vector<std::string_view> lines;
+    };
+
+    QPlainTextEdit* const _editor;
+    QTimer* const _timer;
+    std::vector<QByteArray> _lines;
+    std::vector<uint8_t> _marks;
+    std::shared_ptr<const Base> _base;  // null when the file has no base
+    std::vector<Diff::Hunk> _hunks;     // of the last diff
+    Blame _blame;
+    bool _hasBlame;
+    bool _blameWanted;
+    quint32 _generation;
+    QThreadPool _pool;
+public:
+    explicit ChangeBar(QPlainTextEdit*);
+    ~ChangeBar() override;
+
+    void setBase(const QByteArray&);
+    void clearBase();
+    bool hasBase() const {
+        return _base != nullptr;
+    }
+    QByteArray base() const {
+        return _base ? _base->text : QByteArray();
+    }
+    void setBlame(const Blame&);
+    void clearBlame();
+    bool hasBlame() const {
+        return _hasBlame;
+    }
+    QString describe(const int) const;
+
+protected:
+    void paintEvent(QPaintEvent*) override;
+    bool event(QEvent*) override;
+
+private:
+    void contentsChange(const int, const int, const int);
+    void diff();
+    void apply(const std::vector<Diff::Hunk>&);
+    int baseLine(const int) const;
+
+signals:
+    void blameWanted();
+};
+
+#endif // GOEDIT_CHANGE_BAR_H
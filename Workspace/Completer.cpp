@@ -0,0 +1,411 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Completer.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QListWidget>
+#include <QKeyEvent>
+#include <QTextBlock>
+#include <QJsonArray>
+#include <QJsonObject>
+#include "Completer.h"
+#include "Editor.h"
+#include "Project/Project.h"
+#include "Project/SymbolIndex.h"
+#include "Lsp/LspClient.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+// Used when there is no language server.
+static const char* const Predeclared[] = {
+    "break", "case", "chan", "const", "continue", "default", "defer",
+    "else", "fallthrough", "for", "func", "go", "goto", "if", "import",
+    "interface", "map", "package", "range", "return", "select", "struct",
+    "switch", "type", "var",
+    "append", "cap", "close", "complex", "copy", "delete", "imag", "len",
+    "make", "new", "panic", "print", "println", "real", "recover",
+    "any", "bool", "byte", "complex64", "complex128", "error", "float32",
+    "float64", "int", "int8", "int16", "int32", "int64", "rune", "string",
+    "uint", "uint8", "uint16", "uint32", "uint64", "uintptr",
+    "true", "false", "iota", "nil"
+};
+
+//*******************************************************************
+//                             Completer                        CTOR
+//*******************************************************************
+Completer::Completer(QObject* parent)
+    : QObject(parent)
+    , _popup(new QListWidget)
+    , _project(nullptr)
+    , _wordStart(0)
+    , _active(false)
+    , _session(0)
+{
+    _popup->setWindowFlags(Qt::ToolTip | Qt::FramelessWindowHint);
+    _popup->setFocusPolicy(Qt::NoFocus);
+    _popup->setUniformItemSizes(true);
+    _popup->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    connect(_popup, &QListWidget::itemClicked, this, &Completer::accept);
+}
+
+/********************************************************************
+*                            ~Completer                        dtor *
+********************************************************************/
+Completer::~Completer() {
+    delete _popup;
+}
+
+/********************************************************************
+*                             setProject                     public *
+********************************************************************/
+void Completer::setProject(Project* project) {
+    _project = project;
+}
+
+/********************************************************************
+*                               attach                       public *
+*-------------------------------------------------------------------*
+* Completion works in one editor at a time (the current one).       *
+********************************************************************/
+void Completer::attach(Editor* editor) {
+    if (_editor == editor) {
+        return;
+    }
+    hide();
+    if (_editor) {
+        _editor->removeEventFilter(this);
+        disconnect(_editor, nullptr, this, nullptr);
+    }
+    _editor = editor;
+    if (_editor) {
+        _editor->installEventFilter(this);
+        connect(_editor, &QPlainTextEdit::textChanged, this, &Completer::textChanged);
+        connect(_editor, &QPlainTextEdit::cursorPositionChanged, this, &Completer::cursorMoved);
+    }
+}
+
+/********************************************************************
+*                              complete                      public *
+*-------------------------------------------------------------------*
+* Starts completion of the word before the cursor.                  *
+********************************************************************/
+void Completer::complete() {
+    if (!_editor) {
+        return;
+    }
+    hide();
+    _wordStart = wordStart();
+    _active = true;
+    collect();
+}
+
+/********************************************************************
+*                                hide                        public *
+********************************************************************/
+void Completer::hide() {
+    ++_session;
+    _active = false;
+    _index.clear();
+    _popup->hide();
+}
+
+/********************************************************************
+*                            eventFilter                  protected *
+********************************************************************/
+bool Completer::eventFilter(QObject* object, QEvent* event) {
+    if (object != _editor) {
+        return false;
+    }
+    if (event->type() == QEvent::FocusOut) {
+        hide();
+        return false;
+    }
+    if (event->type() != QEvent::KeyPress) {
+        return false;
+    }
+
+    auto const key = static_cast<QKeyEvent*>(event);
+    if (key->key() == Qt::Key_Space && (key->modifiers() & Qt::ControlModifier)) {
+        complete();
+        return true;
+    }
+    if (_popup->isVisible()) {
+        switch (key->key()) {
+        case Qt::Key_Up:
+            move(-1);
+            return true;
+        case Qt::Key_Down:
+            move(1);
+            return true;
+        case Qt::Key_PageUp:
+            move(-10);
+            return true;
+        case Qt::Key_PageDown:
+            move(10);
+            return true;
+        case Qt::Key_Return:
+        case Qt::Key_Enter:
+        case Qt::Key_Tab:
+            accept();
+            return true;
+        case Qt::Key_Escape:
+            hide();
+            return true;
+        }
+    }
+    // The key is handled by the editor, its effect is seen in textChanged.
+    _typed = key->text();
+    return false;
+}
+
+/********************************************************************
+*                            textChanged                    private *
+*-------------------------------------------------------------------*
+* Typing narrows the candidates of the session, a '.' or a word of  *
+* MinPrefix characters starts a new session.                        *
+********************************************************************/
+void Completer::textChanged() {
+    const QString typed = _typed;
+    _typed.clear();
+    if (typed.isEmpty()) {
+        // Not typed (undo, paste, reload).
+        hide();
+        return;
+    }
+
+    const QChar c = typed.at(0);
+    if (_active) {
+        if (isWordChar(c) || c == '\b') {
+            cursorMoved();
+            if (_active) {
+                refilter();
+            }
+        } else {
+            hide();
+        }
+    }
+    if (_active) {
+        return;
+    }
+    if (c == '.' || (isWordChar(c) && prefixLength() == MinPrefix)) {
+        complete();
+    }
+}
+
+/********************************************************************
+*                            cursorMoved                    private *
+*-------------------------------------------------------------------*
+* Session ends when the cursor leaves the word.                     *
+********************************************************************/
+void Completer::cursorMoved() {
+    if (!_active) {
+        return;
+    }
+    const int position = _editor->textCursor().position();
+    if (position < _wordStart || wordStart() != _wordStart) {
+        hide();
+    }
+}
+
+/********************************************************************
+*                              collect                      private *
+*-------------------------------------------------------------------*
+* Candidates for the word. The language server is asked at the      *
+* start of the word, so its answer serves all prefixes typed later. *
+* Without the server, symbols of the project and predeclared names  *
+* are used.                                                         *
+********************************************************************/
+void Completer::collect() {
+    LspClient* const lsp = _project ? _project->lspClient() : nullptr;
+    if (lsp && lsp->isReady() && !_editor->isUntitled()) {
+        const QTextBlock block = _editor->document()->findBlock(_wordStart);
+        const QPointer<Completer> self(this);
+        const quint32 session = _session;
+        lsp->request("textDocument/completion",
+                     lsp->positionParams(_editor->path(), block.blockNumber(), _wordStart - block.position()),
+                     [self, session](const QJsonValue& result) {
+                         if (self) {
+                             self->lspResult(session, result);
+                         }
+                     });
+        return;
+    }
+
+    std::vector<CompletionIndex::Candidate> candidates;
+    const QString word = prefix();
+    const bool member = _wordStart > 0 && _editor->document()->characterAt(_wordStart - 1) == '.';
+    if (_project && !word.isEmpty() && !member) {
+        for (const auto& symbol : _project->symbolIndex()->search(word.left(1), MaxCandidates)) {
+            const std::string name = symbol.name.toStdString();
+            const QString detail = SymbolIndex::kindName(symbol.kind) + ' ' + symbol.path;
+            candidates.push_back({name, name, detail.toStdString(), symbol.kind});
+        }
+    }
+    if (!member) {
+        for (const char* const name : Predeclared) {
+            candidates.push_back({name, name, std::string(), 0});
+        }
+    }
+    _index.assign(std::move(candidates));
+    refilter();
+}
+
+/********************************************************************
+*                             lspResult                     private *
+*-------------------------------------------------------------------*
+* CompletionList or an array of CompletionItem. Answers of sessions *
+* finished meanwhile are dropped.                                   *
+********************************************************************/
+void Completer::lspResult(const quint32 session, const QJsonValue& result) {
+    if (session != _session || !_active || !_editor) {
+        return;
+    }
+    const QJsonArray items = result.isArray() ? result.toArray() : result.toObject().value("items").toArray();
+
+    std::vector<CompletionIndex::Candidate> candidates;
+    candidates.reserve(size_t(qMin(items.size(), MaxCandidates)));
+    for (int i = 0; i < items.size() && i < MaxCandidates; i++) {
+        const QJsonObject item = items[i].toObject();
+        const QString label = item.value("label").toString();
+        QString insert = item.value("textEdit").toObject().value("newText").toString();
+        if (insert.isEmpty()) {
+            insert = item.value("insertText").toString(label);
+        }
+        candidates.push_back({
+            label.toStdString(),
+            insert.toStdString(),
+            item.value("detail").toString().toStdString(),
+            item.value("kind").toInt()
+        });
+    }
+    _index.assign(std::move(candidates));
+    refilter();
+}
+
+/********************************************************************
+*                              refilter                     private *
+*-------------------------------------------------------------------*
+* Shows the best candidates for the prefix under the cursor.        *
+********************************************************************/
+void Completer::refilter() {
+    const auto& hits = _index.filter(prefix().toStdString(), MaxVisible);
+    if (hits.empty()) {
+        _popup->hide();
+        return;
+    }
+
+    _popup->setUpdatesEnabled(false);
+    _popup->clear();
+    for (const auto& hit : hits) {
+        const CompletionIndex::Candidate& candidate = _index[hit.index];
+        auto const item = new QListWidgetItem(QString::fromStdString(candidate.text), _popup);
+        item->setData(Qt::UserRole, hit.index);
+        if (!candidate.detail.empty()) {
+            item->setToolTip(QString::fromStdString(candidate.detail));
+        }
+    }
+    _popup->setCurrentRow(0);
+    _popup->setUpdatesEnabled(true);
+
+    const int frame = 2 * _popup->frameWidth();
+    const int rows = qMin(_popup->count(), 12);
+    const int width = qBound(200, _popup->sizeHintForColumn(0) + frame + 20, 600);
+    _popup->resize(width, rows * _popup->sizeHintForRow(0) + frame);
+    _popup->move(_editor->viewport()->mapToGlobal(_editor->cursorRect().bottomLeft()));
+    _popup->show();
+}
+
+/********************************************************************
+*                               accept                      private *
+*-------------------------------------------------------------------*
+* Replaces the prefix with the selected candidate.                  *
+********************************************************************/
+void Completer::accept() {
+    QListWidgetItem* const item = _popup->currentItem();
+    if (!item || !_editor) {
+        hide();
+        return;
+    }
+    const QString insert = QString::fromStdString(_index[item->data(Qt::UserRole).toUInt()].insert);
+    const int start = _wordStart;
+    hide();
+
+    QTextCursor cursor = _editor->textCursor();
+    const int end = cursor.position();
+    cursor.setPosition(start);
+    cursor.setPosition(end, QTextCursor::KeepAnchor);
+    cursor.insertText(insert);
+    _editor->setTextCursor(cursor);
+}
+
+/********************************************************************
+*                                move                       private *
+********************************************************************/
+void Completer::move(const int delta) {
+    const int row = qBound(0, _popup->currentRow() + delta, _popup->count() - 1);
+    _popup->setCurrentRow(row);
+}
+
+/********************************************************************
+*                        prefix/prefixLength                private *
+*-------------------------------------------------------------------*
+* Part of the word between its start and the cursor.                *
+********************************************************************/
+QString Completer::prefix() const {
+    QTextCursor cursor = _editor->textCursor();
+    const int end = cursor.position();
+    if (end <= _wordStart) {
+        return QString();
+    }
+    cursor.setPosition(_wordStart);
+    cursor.setPosition(end, QTextCursor::KeepAnchor);
+    return cursor.selectedText();
+}
+
+int Completer::prefixLength() const {
+    return _editor->textCursor().position() - wordStart();
+}
+
+/********************************************************************
+*                             wordStart                     private *
+*-------------------------------------------------------------------*
+* Position of the start of the word the cursor is at the end of.    *
+********************************************************************/
+int Completer::wordStart() const {
+    const QTextCursor cursor = _editor->textCursor();
+    const QString text = cursor.block().text();
+    int column = cursor.positionInBlock();
+    while (column > 0 && isWordChar(text[column - 1])) {
+        --column;
+    }
+    return cursor.block().position() + column;
+}
+
+/********************************************************************
+*                             isWordChar             private static *
+********************************************************************/
+bool Completer::isWordChar(const QChar c) {
+    return c.isLetterOrNumber() || c == '_';
+}
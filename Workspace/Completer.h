@@ -0,0 +1,91 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Completer.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_COMPLETER_H
+#define GOEDIT_COMPLETER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QPointer>
+#include "Workspace/CompletionIndex.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QListWidget;
+class QJsonValue;
+class Editor;
+class Project;
+
+/********************************************************************
+*                             Completer                             *
+*-------------------------------------------------------------------*
+* Completion popup of the current editor. Candidates are collected  *
+* once per word (from the language server, or from the symbol index *
+* when there is no server) and then only filtered while the user    *
+* types. The popup never takes the focus, keys it needs are taken   *
+* from the editor by an event filter.                               *
+********************************************************************/
+class Completer : public QObject {
+    Q_OBJECT
+
+    static constexpr int MinPrefix = 2;         // auto popup after so many characters
+    static constexpr int MaxVisible = 100;
+    static constexpr int MaxCandidates = 50000;
+
+    QListWidget* const _popup;
+    QPointer<Editor> _editor;
+    Project* _project;
+    CompletionIndex _index;
+    QString _typed;
+    int _wordStart;
+    bool _active;
+    quint32 _session;
+public:
+    explicit Completer(QObject* = nullptr);
+    ~Completer() override;
+
+    void setProject(Project*);
+    void attach(Editor*);
+    void complete();
+    void hide();
+
+protected:
+    bool eventFilter(QObject*, QEvent*) override;
+
+private:
+    void textChanged();
+    void cursorMoved();
+    void collect();
+    void lspResult(const quint32, const QJsonValue&);
+    void refilter();
+    void accept();
+    void move(const int);
+    QString prefix() const;
+    int prefixLength() const;
+    int wordStart() const;
+    static bool isWordChar(const QChar);
+};
+
+#endif // GOEDIT_COMPLETER_H
@@ -0,0 +1,181 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : CompletionIndex.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <algorithm>
+#include <numeric>
+#include "CompletionIndex.h"
+#include "Shared/Fuzzy.h"
+
+/********************************************************************
+*                               assign                       public *
+*-------------------------------------------------------------------*
+* New set of candidates. Duplicates (same text and insert) are      *
+* removed, the first one wins.                                      *
+********************************************************************/
+void CompletionIndex::assign(std::vector<Candidate> candidates) {
+    clear();
+
+    std::vector<std::string> keys(candidates.size());
+    std::vector<uint32_t> order(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++) {
+        keys[i].reserve(candidates[i].text.size());
+        for (const char c : candidates[i].text) {
+            keys[i] += Fuzzy::lower(c);
+        }
+    }
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](const uint32_t a, const uint32_t b) {
+        return (keys[a] != keys[b]) ? keys[a] < keys[b] : candidates[a].text < candidates[b].text;
+    });
+
+    _candidates.reserve(candidates.size());
+    _keys.reserve(candidates.size());
+    _masks.reserve(candidates.size());
+    for (const uint32_t i : order) {
+        if (!_candidates.empty()
+            && _candidates.back().text == candidates[i].text
+            && _candidates.back().insert == candidates[i].insert) {
+            continue;
+        }
+        _masks.push_back(Fuzzy::mask(keys[i]));
+        _keys.push_back(std::move(keys[i]));
+        _candidates.push_back(std::move(candidates[i]));
+    }
+}
+
+/********************************************************************
+*                               clear                        public *
+********************************************************************/
+void CompletionIndex::clear() {
+    _candidates.clear();
+    _keys.clear();
+    _masks.clear();
+    _lastQuery.clear();
+    _survivors.clear();
+    _hits.clear();
+}
+
+/********************************************************************
+*                               filter                       public *
+*-------------------------------------------------------------------*
+* Returns 'limit' best candidates for the query. Candidates         *
+* starting with the query come first (they are one range of the     *
+* sorted array), the rest are ordered by the fuzzy score.           *
+********************************************************************/
+const std::vector<CompletionIndex::Hit>& CompletionIndex::filter(std::string_view text, const size_t limit) {
+    std::string query;
+    for (const char c : text) {
+        if (c != ' ') {
+            query += Fuzzy::lower(c);
+        }
+    }
+    _hits.clear();
+
+    if (query.empty()) {
+        _lastQuery.clear();
+        const size_t n = std::min(limit, _candidates.size());
+        for (size_t i = 0; i < n; i++) {
+            _hits.push_back({uint32_t(i), 0});
+        }
+        return _hits;
+    }
+
+    const bool narrow = !_lastQuery.empty() && query.compare(0, _lastQuery.size(), _lastQuery) == 0;
+    rejectByMask(Fuzzy::mask(query), narrow);
+
+    const auto [first, last] = prefixRange(query);
+    _survivors.clear();
+    for (const uint32_t idx : _scratch) {
+        int score = Fuzzy::score(query, _candidates[idx].text);
+        if (score == Fuzzy::NoMatch) {
+            continue;
+        }
+        _survivors.push_back(idx);
+        if (idx >= first && idx < last) {
+            score += PrefixBonus;
+            if (_candidates[idx].text.compare(0, text.size(), text) == 0) {
+                score += CaseBonus;
+            }
+        }
+        _hits.push_back({idx, score});
+    }
+    _lastQuery = query;
+
+    const size_t n = std::min(limit, _hits.size());
+    std::partial_sort(_hits.begin(), _hits.begin() + long(n), _hits.end(), [](const Hit& a, const Hit& b) {
+        return (a.score != b.score) ? a.score > b.score : a.index < b.index;
+    });
+    _hits.resize(n);
+    return _hits;
+}
+
+/********************************************************************
+*                            prefixRange                    private *
+*-------------------------------------------------------------------*
+* Range of the candidates whose lower case text starts with 'key'.  *
+********************************************************************/
+std::pair<uint32_t, uint32_t> CompletionIndex::prefixRange(std::string_view key) const {
+    const auto lo = std::lower_bound(_keys.cbegin(), _keys.cend(), key, [](const std::string& k, std::string_view v) {
+        return std::string_view(k) < v;
+    });
+    const auto hi = std::upper_bound(lo, _keys.cend(), key, [](std::string_view v, const std::string& k) {
+        return v < std::string_view(k).substr(0, v.size());
+    });
+    return {uint32_t(lo - _keys.cbegin()), uint32_t(hi - _keys.cbegin())};
+}
+
+/********************************************************************
+*                           rejectByMask                    private *
+*-------------------------------------------------------------------*
+* Candidates (all or the previous survivors) whose mask contains    *
+* the mask of the query go to _scratch. The index is written always *
+* and the output position advanced conditionally, so the loop has   *
+* no branches.                                                      *
+********************************************************************/
+void CompletionIndex::rejectByMask(const uint64_t qmask, const bool narrow) {
+    if (narrow) {
+        _scratch.resize(_survivors.size());
+        size_t n = 0;
+        for (const uint32_t idx : _survivors) {
+            _scratch[n] = idx;
+            n += ((_masks[idx] & qmask) == qmask);
+        }
+        _scratch.resize(n);
+        return;
+    }
+
+    const uint64_t* const masks = _masks.data();
+    const size_t count = _masks.size();
+    _scratch.resize(count);
+    uint32_t* const out = _scratch.data();
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        out[n] = uint32_t(i);
+        n += ((masks[i] & qmask) == qmask);
+    }
+    _scratch.resize(n);
+}
@@ -0,0 +1,88 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : CompletionIndex.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_COMPLETION_INDEX_H
+#define GOEDIT_COMPLETION_INDEX_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/********************************************************************
+*                          CompletionIndex                          *
+*-------------------------------------------------------------------*
+* Candidates of one completion session, sorted by their lower case  *
+* text, so candidates with a given prefix form one range found by   *
+* binary search. Filtering rejects candidates by the character mask *
+* first (a plain loop over an array of masks, which the compiler    *
+* vectorizes), only the rest is fuzzy scored. When the query        *
+* extends the previous one, only the previous survivors are scored. *
+********************************************************************/
+class CompletionIndex {
+public:
+    struct Candidate {
+        std::string text;       // shown and matched
+        std::string insert;     // inserted when accepted
+        std::string detail;
+        int kind;
+    };
+    struct Hit {
+        uint32_t index;
+        int score;
+    };
+private:
+    static constexpr int PrefixBonus = 1000;
+    static constexpr int CaseBonus = 1;
+
+    std::vector<Candidate> _candidates;
+    std::vector<std::string> _keys;         // lower case texts
+    std::vector<uint64_t> _masks;
+    std::string _lastQuery;
+    std::vector<uint32_t> _survivors;
+    std::vector<uint32_t> _scratch;
+    std::vector<Hit> _hits;
+public:
+    void assign(std::vector<Candidate>);
+    void clear();
+    const std::vector<Hit>& filter(std::string_view, const size_t);
+
+    const Candidate& operator[](const uint32_t idx) const {
+        return _candidates[idx];
+    }
+    size_t size() const {
+        return _candidates.size();
+    }
+    bool isEmpty() const {
+        return _candidates.empty();
+    }
+private:
+    std::pair<uint32_t, uint32_t> prefixRange(std::string_view) const;
+    void rejectByMask(const uint64_t, const bool);
+};
+
+#endif // GOEDIT_COMPLETION_INDEX_H
@@ -0,0 +1,401 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DiffView.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QPainter>
+#include <QScrollBar>
+#include <QKeyEvent>
+#include <QFontDatabase>
+#include <QtConcurrent>
+#include <algorithm>
+#include "DiffView.h"
+#include "Shared/Diff.h"
+#include "Shared/Trace.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static const QColor RemovedColor(220, 60, 60, 48);
+static const QColor AddedColor(60, 180, 60, 48);
+static constexpr int ContextLines = 3;      // shown above a hunk it jumps to
+
+//*******************************************************************
+//                             DiffView                         CTOR
+//*******************************************************************
+DiffView::DiffView(const Side& left, const Side& right, QWidget* parent)
+    : QAbstractScrollArea(parent)
+    , _left(text(left))
+    , _right(text(right))
+    , _longest(0)
+    , _busy(false)
+    , _cancelled(false)
+{
+    _pool.setMaxThreadCount(1);
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    const QFontMetrics metrics(font());
+    _charWidth = qMax(1, metrics.horizontalAdvance('M'));
+    _lineHeight = qMax(1, metrics.height());
+    setFocusPolicy(Qt::StrongFocus);
+    compare();
+}
+
+/********************************************************************
+*                             ~DiffView                        dtor *
+********************************************************************/
+DiffView::~DiffView() {
+    _cancelled = true;
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                              cancel                        public *
+*-------------------------------------------------------------------*
+* Stops the diff in progress; the view stays empty then.            *
+********************************************************************/
+void DiffView::cancel() {
+    if (_busy) {
+        _cancelled = true;
+    }
+}
+
+/********************************************************************
+*                       nextHunk/previousHunk                public *
+*-------------------------------------------------------------------*
+* Scrolls to the first hunk below/above the top of the view.        *
+********************************************************************/
+void DiffView::nextHunk() {
+    const int top = verticalScrollBar()->value() + ContextLines;
+    const auto it = std::upper_bound(_hunks.cbegin(), _hunks.cend(), top);
+    if (it != _hunks.cend()) {
+        verticalScrollBar()->setValue(*it - ContextLines);
+    }
+}
+
+void DiffView::previousHunk() {
+    const int top = verticalScrollBar()->value() + ContextLines;
+    const auto it = std::lower_bound(_hunks.cbegin(), _hunks.cend(), top);
+    if (it != _hunks.cbegin()) {
+        verticalScrollBar()->setValue(*(it - 1) - ContextLines);
+    }
+}
+
+/********************************************************************
+*                            paintEvent                   protected *
+*-------------------------------------------------------------------*
+* Titles in the first row, then only the rows in the view.          *
+********************************************************************/
+void DiffView::paintEvent(QPaintEvent*) {
+    TraceScope trace("paint", "diff");
+    QPainter painter(viewport());
+    painter.setFont(font());
+    const int width = viewport()->width();
+    const int half = width / 2;
+    painter.fillRect(viewport()->rect(), palette().color(QPalette::Base));
+
+    const QFontMetrics metrics(font());
+    const int statusWidth = metrics.horizontalAdvance(_status) + 2 * _charWidth;
+    painter.fillRect(0, 0, width, _lineHeight, palette().color(QPalette::Window));
+    painter.setPen(palette().color(QPalette::WindowText));
+    painter.drawText(QRect(_charWidth, 0, half - 2 * _charWidth, _lineHeight), Qt::AlignVCenter | Qt::AlignLeft,
+                     metrics.elidedText(_left->title, Qt::ElideMiddle, half - 2 * _charWidth));
+    painter.drawText(QRect(half + _charWidth, 0, half - statusWidth - _charWidth, _lineHeight), Qt::AlignVCenter | Qt::AlignLeft,
+                     metrics.elidedText(_right->title, Qt::ElideMiddle, half - statusWidth - _charWidth));
+    painter.drawText(QRect(width - statusWidth, 0, statusWidth - _charWidth, _lineHeight), Qt::AlignVCenter | Qt::AlignRight, _status);
+
+    const int first = verticalScrollBar()->value();
+    const int last = qMin(first + visibleLines(), int(_rows.size()) - 1);
+    const int column = horizontalScrollBar()->value();
+    for (int i = first; i <= last; i++) {
+        const Row& row = _rows[size_t(i)];
+        const int y = (i - first + 1) * _lineHeight;
+        const bool removed = (row.kind == Changed || row.kind == Removed);
+        const bool added = (row.kind == Changed || row.kind == Added);
+        drawSide(painter, *_left, row.left, 0, y, column, removed ? RemovedColor : QColor());
+        drawSide(painter, *_right, row.right, half, y, column, added ? AddedColor : QColor());
+    }
+    painter.setPen(palette().color(QPalette::Mid));
+    painter.drawLine(half, 0, half, viewport()->height());
+}
+
+/********************************************************************
+*                           keyPressEvent                 protected *
+*-------------------------------------------------------------------*
+* N and P jump to the next and the previous hunk, Escape cancels    *
+* the diff in progress.                                             *
+********************************************************************/
+void DiffView::keyPressEvent(QKeyEvent* event) {
+    QScrollBar* const vertical = verticalScrollBar();
+    QScrollBar* const horizontal = horizontalScrollBar();
+    const bool ctrl = event->modifiers() & Qt::ControlModifier;
+
+    switch (event->key()) {
+    case Qt::Key_N:
+        nextHunk();
+        return;
+    case Qt::Key_P:
+        previousHunk();
+        return;
+    case Qt::Key_Escape:
+        cancel();
+        return;
+    case Qt::Key_Up:
+        vertical->setValue(vertical->value() - 1);
+        return;
+    case Qt::Key_Down:
+        vertical->setValue(vertical->value() + 1);
+        return;
+    case Qt::Key_PageUp:
+        vertical->setValue(vertical->value() - vertical->pageStep());
+        return;
+    case Qt::Key_PageDown:
+        vertical->setValue(vertical->value() + vertical->pageStep());
+        return;
+    case Qt::Key_Left:
+        horizontal->setValue(horizontal->value() - 1);
+        return;
+    case Qt::Key_Right:
+        horizontal->setValue(horizontal->value() + 1);
+        return;
+    case Qt::Key_Home:
+        (ctrl ? vertical : horizontal)->setValue(0);
+        return;
+    case Qt::Key_End:
+        if (ctrl) {
+            vertical->setValue(vertical->maximum());
+        } else {
+            horizontal->setValue(horizontal->maximum());
+        }
+        return;
+    default:
+        QAbstractScrollArea::keyPressEvent(event);
+    }
+}
+
+/********************************************************************
+*                 resizeEvent/scrollContentsBy            protected *
+********************************************************************/
+void DiffView::resizeEvent(QResizeEvent* event) {
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+}
+
+void DiffView::scrollContentsBy(int, int) {
+    viewport()->update();
+}
+
+/********************************************************************
+*                              compare                      private *
+*-------------------------------------------------------------------*
+* Diff and the table of rows are made in the background, the GUI    *
+* thread only takes the result.                                     *
+********************************************************************/
+void DiffView::compare() {
+    _busy = true;
+    _status = "Comparing...";
+    QtConcurrent::run(&_pool, [this, left = _left, right = _right] {
+        TraceScope trace("compare", "diff");
+        std::vector<Diff::Hunk> hunks;
+        if (!Diff::compare(left->lines, right->lines, hunks, _cancelled)) {
+            QMetaObject::invokeMethod(this, [this] {
+                _busy = false;
+                _status = "Cancelled";
+                viewport()->update();
+                emit finished(-1);
+            }, Qt::QueuedConnection);
+            return;
+        }
+
+        Result result;
+        result.rows.reserve(std::max(left->lines.size(), right->lines.size()));
+        int l = 0;
+        int r = 0;
+        auto same = [&result, &l, &r](const int until) {
+            while (l < until) {
+                result.rows.push_back({l++, r++, Same});
+            }
+        };
+        for (const auto& hunk : hunks) {
+            same(hunk.oldStart);
+            result.hunks.push_back(int(result.rows.size()));
+            const int common = std::min(hunk.oldCount, hunk.newCount);
+            for (int i = 0; i < common; i++) {
+                result.rows.push_back({l++, r++, Changed});
+            }
+            for (int i = common; i < hunk.oldCount; i++) {
+                result.rows.push_back({l++, -1, Removed});
+            }
+            for (int i = common; i < hunk.newCount; i++) {
+                result.rows.push_back({-1, r++, Added});
+            }
+        }
+        same(int(left->lines.size()));
+
+        result.longest = 0;
+        for (const auto* lines : {&left->lines, &right->lines}) {
+            for (const auto& line : *lines) {
+                result.longest = std::max(result.longest, cells(line));
+            }
+        }
+        QMetaObject::invokeMethod(this, [this, result = std::move(result)] {
+            apply(result);
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               apply                       private *
+********************************************************************/
+void DiffView::apply(const Result& result) {
+    _rows = result.rows;
+    _hunks = result.hunks;
+    _longest = result.longest;
+    _busy = false;
+    _status = _hunks.empty() ? QString("Identical") : QString("%1 differences").arg(_hunks.size());
+    updateScrollBars();
+    if (!_hunks.empty()) {
+        verticalScrollBar()->setValue(_hunks.front() - ContextLines);
+    }
+    viewport()->update();
+    emit finished(hunkCount());
+}
+
+/********************************************************************
+*                             drawSide                      private *
+*-------------------------------------------------------------------*
+* Draws the line (-1: no line, filler of the other side's change)   *
+* in the half of the row starting at 'x'.                           *
+********************************************************************/
+void DiffView::drawSide(QPainter& painter, const Text& text, const int line, const int x, const int y,
+                        const int column, const QColor& background) const {
+    const int half = viewport()->width() / 2;
+    if (line < 0) {
+        painter.fillRect(x, y, half, _lineHeight, palette().color(QPalette::Window));
+        return;
+    }
+    if (background.isValid()) {
+        painter.fillRect(x, y, half, _lineHeight, background);
+    }
+
+    const int gutter = gutterWidth();
+    const int baseline = y + QFontMetrics(font()).ascent();
+    painter.setPen(palette().color(QPalette::Mid));
+    painter.drawText(QRect(x, y, gutter - _charWidth, _lineHeight), Qt::AlignVCenter | Qt::AlignRight, QString::number(line + 1));
+
+    const std::string_view data = text.lines[size_t(line)];
+    const QString cells = expand(QString::fromUtf8(data.data(), int(data.size()))).mid(column, visibleColumns() + 1);
+    painter.setPen(palette().color(QPalette::Text));
+    painter.setClipRect(x + gutter, y, half - gutter, _lineHeight);
+    painter.drawText(x + gutter, baseline, cells);
+    painter.setClipping(false);
+}
+
+/********************************************************************
+*                         updateScrollBars                  private *
+*-------------------------------------------------------------------*
+* Both scroll bars count cells (rows, columns), not pixels.         *
+********************************************************************/
+void DiffView::updateScrollBars() {
+    const int lines = visibleLines();
+    const int columns = visibleColumns();
+    verticalScrollBar()->setRange(0, qMax(0, int(_rows.size()) - lines));
+    verticalScrollBar()->setPageStep(lines);
+    horizontalScrollBar()->setRange(0, qMax(0, _longest - columns + 1));
+    horizontalScrollBar()->setPageStep(columns);
+}
+
+/********************************************************************
+*                   visibleLines/visibleColumns             private *
+********************************************************************/
+int DiffView::visibleLines() const {
+    return qMax(1, viewport()->height() / _lineHeight - 1);
+}
+
+int DiffView::visibleColumns() const {
+    return qMax(1, (viewport()->width() / 2 - gutterWidth()) / _charWidth);
+}
+
+/********************************************************************
+*                            gutterWidth                    private *
+*-------------------------------------------------------------------*
+* Room for line numbers of the longer text and a space.             *
+********************************************************************/
+int DiffView::gutterWidth() const {
+    const size_t lines = std::max(_left->lines.size(), _right->lines.size());
+    return (QString::number(lines).size() + 1) * _charWidth;
+}
+
+/********************************************************************
+*                               text                 private static *
+*-------------------------------------------------------------------*
+* Lines of the side. CR of line ends and BOM are not shown.         *
+********************************************************************/
+std::shared_ptr<const DiffView::Text> DiffView::text(const Side& side) {
+    auto text = std::make_shared<Text>();
+    text->title = side.title;
+    text->data = side.text;
+    text->data.replace("\r\n", "\n");
+    if (text->data.startsWith("\xEF\xBB\xBF")) {
+        text->data.remove(0, 3);
+    }
+    text->lines = Diff::split(std::string_view(text->data.constData(), size_t(text->data.size())));
+    return text;
+}
+
+/********************************************************************
+*                               cells                private static *
+*-------------------------------------------------------------------*
+* Width of the UTF-8 line in cells: a cell per character, tabs to   *
+* the next tab stop.                                                *
+********************************************************************/
+int DiffView::cells(std::string_view line) {
+    int count = 0;
+    for (const char c : line) {
+        if (c == '\t') {
+            count += TabWidth - count % TabWidth;
+        } else if ((static_cast<unsigned char>(c) & 0xc0) != 0x80) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/********************************************************************
+*                              expand                private static *
+********************************************************************/
+QString DiffView::expand(const QString& line) {
+    if (!line.contains('\t')) {
+        return line;
+    }
+    QString result;
+    result.reserve(line.size() + TabWidth);
+    for (const QChar c : line) {
+        if (c == '\t') {
+            result += QString(TabWidth - result.size() % TabWidth, ' ');
+        } else {
+            result += c;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,127 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : DiffView.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_DIFF_VIEW_H
+#define GOEDIT_DIFF_VIEW_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QAbstractScrollArea>
+#include <QByteArray>
+#include <QThreadPool>
+#include <atomic>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/********************************************************************
+*                             DiffView                              *
+*-------------------------------------------------------------------*
+* Two texts side by side, differences aligned. The diff (see        *
+* Diff::compare) runs in a background thread and can be cancelled   *
+* (Escape, closing the view). Like LongLineEditor the view is a     *
+* grid of cells: rows of the diff are only a table of line numbers, *
+* text of a line is decoded when the row is drawn, so the size of   *
+* the texts does not matter for painting or scrolling.              *
+********************************************************************/
+class DiffView : public QAbstractScrollArea {
+    Q_OBJECT
+public:
+    struct Side {
+        QString title;
+        QByteArray text;    // UTF-8
+    };
+private:
+    static constexpr int TabWidth = 4;
+
+    enum Kind : uint8_t {
+        Same,
+        Changed,
+        Removed,        // line of the left text only
+        Added           // line of the right text only
+    };
+    struct Row {
+        int left;       // line numbers, -1 when the side has no line
+        int right;
+        Kind kind;
+    };
+    struct Text {
+        QString title;
+        QByteArray data;
+        std::vector<std::string_view> lines;
+    };
+    struct Result {
+        std::vector<Row> rows;
+        std::vector<int> hunks;     // first row of every hunk
+        int longest;                // in cells
+    };
+
+    std::shared_ptr<const Text> _left;
+    std::shared_ptr<const Text> _right;
+    std::vector<Row> _rows;
+    std::vector<int> _hunks;
+    int _longest;
+    QString _status;
+    bool _busy;
+    std::atomic<bool> _cancelled;
+    QThreadPool _pool;
+    int _charWidth;
+    int _lineHeight;
+public:
+    DiffView(const Side&, const Side&, QWidget* = nullptr);
+    ~DiffView() override;
+
+    void cancel();
+    bool isBusy() const {
+        return _busy;
+    }
+    int hunkCount() const {
+        return int(_hunks.size());
+    }
+    void nextHunk();
+    void previousHunk();
+
+protected:
+    void paintEvent(QPaintEvent*) override;
+    void keyPressEvent(QKeyEvent*) override;
+    void resizeEvent(QResizeEvent*) override;
+    void scrollContentsBy(int, int) override;
+
+private:
+    void compare();
+    void apply(const Result&);
+    void drawSide(QPainter&, const Text&, const int, const int, const int, const int, const QColor&) const;
+    void updateScrollBars();
+    int visibleLines() const;
+    int visibleColumns() const;
+    int gutterWidth() const;
+    static std::shared_ptr<const Text> text(const Side&);
+    static int cells(std::string_view);
+    static QString expand(const QString&);
+
+signals:
+    void finished(int);
+};
+
+#endif // GOEDIT_DIFF_VIEW_H
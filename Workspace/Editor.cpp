@@ -0,0 +1,660 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Editor.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFontDatabase>
+#include <QTextBlock>
+#include <QTextLayout>
+#include <QScrollBar>
+#include <QPainter>
+#include <QPaintEvent>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <vector>
+#include "Editor.h"
+#include "Minimap.h"
+#include "ChangeBar.h"
+#include "TextFile.h"
+#include "Shared/Settings.h"
+#include "Shared/Trace.h"
+
+//*******************************************************************
+//                              Editor                          CTOR
+//*******************************************************************
+Editor::Editor(QWidget* parent)
+    : QPlainTextEdit(parent)
+    , _minimap(new Minimap(this))
+    , _changeBar(new ChangeBar(this))
+    , _multiCursor(this)
+    , _columnLine(-1)
+    , _columnColumn(0)
+    , _format{}
+    , _deferred{}
+    , _isDeferred(false)
+{
+    setLineWrapMode(QPlainTextEdit::NoWrap);
+    applySettings();
+    if (auto const settings = Settings::instance()) {
+        connect(settings, &Settings::changed, this, &Editor::applySettings);
+    }
+
+    _brackets.reset(document()->blockCount());
+    connect(document(), &QTextDocument::contentsChange, this, &Editor::contentsChange);
+    connect(this, &QPlainTextEdit::cursorPositionChanged, this, &Editor::cursorMoved);
+}
+
+/********************************************************************
+*                               load                         public *
+********************************************************************/
+bool Editor::load(const QString& path) {
+    QString text;
+    if (!TextFile::read(path, text, _format)) {
+        return false;
+    }
+    setPlainText(text);
+    document()->setModified(false);
+    setPath(path);
+    _isDeferred = false;
+    return true;
+}
+
+/********************************************************************
+*                              saveAs                        public *
+********************************************************************/
+bool Editor::saveAs(const QString& path) {
+    if (!TextFile::write(path, toPlainText(), _format)) {
+        return false;
+    }
+    document()->setModified(false);
+    setPath(path);
+    return true;
+}
+
+/********************************************************************
+*                           gotoPosition                     public *
+*-------------------------------------------------------------------*
+* 'line' and 'column' are 0-based, out of range values are clamped. *
+********************************************************************/
+void Editor::gotoPosition(const int line, const int column) {
+    const QTextBlock block = document()->findBlockByNumber(qBound(0, line, blockCount() - 1));
+    QTextCursor cursor(block);
+    cursor.setPosition(block.position() + qBound(0, column, block.length() - 1));
+    setTextCursor(cursor);
+    centerCursor();
+    setFocus();
+}
+
+/********************************************************************
+*                          wordUnderCursor                   public *
+*-------------------------------------------------------------------*
+* Selected text or the word the cursor is in.                       *
+********************************************************************/
+QString Editor::wordUnderCursor() const {
+    QTextCursor cursor = textCursor();
+    if (!cursor.hasSelection()) {
+        cursor.select(QTextCursor::WordUnderCursor);
+    }
+    return cursor.selectedText().trimmed();
+}
+
+/********************************************************************
+*                               defer                        public *
+*-------------------------------------------------------------------*
+* Document of a restored session: the file is not read until the    *
+* editor is shown for the first time (see hydrate).                 *
+********************************************************************/
+void Editor::defer(const Session::Document& doc) {
+    setPath(doc.path);
+    _deferred = doc;
+    _isDeferred = true;
+}
+
+/********************************************************************
+*                              hydrate                       public *
+*-------------------------------------------------------------------*
+* Loads the deferred document and restores its cursor and scroll    *
+* position.                                                         *
+********************************************************************/
+bool Editor::hydrate() {
+    if (!_isDeferred) {
+        return true;
+    }
+    const Session::Document doc = _deferred;
+    if (!load(doc.path)) {
+        return false;
+    }
+    const QTextBlock block = document()->findBlockByNumber(qBound(0, doc.line, blockCount() - 1));
+    QTextCursor cursor(block);
+    cursor.setPosition(block.position() + qBound(0, doc.column, block.length() - 1));
+    setTextCursor(cursor);
+    verticalScrollBar()->setValue(doc.scroll);
+    return true;
+}
+
+/********************************************************************
+*                              snapshot                      public *
+********************************************************************/
+Session::Document Editor::snapshot() const {
+    if (_isDeferred) {
+        return _deferred;
+    }
+    const QTextCursor cursor = textCursor();
+    // In QPlainTextEdit the scroll bar counts lines.
+    return {path(), cursor.blockNumber(), cursor.positionInBlock(), verticalScrollBar()->value()};
+}
+
+/********************************************************************
+*                               fold                         public *
+*-------------------------------------------------------------------*
+* Folds the innermost region at the cursor which is not folded yet. *
+********************************************************************/
+void Editor::fold() {
+    const int line = textCursor().blockNumber();
+    const auto regions = _brackets.regionsAt(line);
+    for (auto it = regions.rbegin(); it != regions.rend(); ++it) {
+        if (isFolded(it->header)) {
+            continue;
+        }
+        setFolded(*it, true);
+        if (line >= it->first) {
+            QTextCursor cursor(document()->findBlockByNumber(it->header));
+            cursor.movePosition(QTextCursor::EndOfBlock);
+            setTextCursor(cursor);
+        }
+        return;
+    }
+}
+
+/********************************************************************
+*                              unfold                        public *
+*-------------------------------------------------------------------*
+* Unfolds the region with the header on the line of the cursor.     *
+********************************************************************/
+void Editor::unfold() {
+    const int line = textCursor().blockNumber();
+    if (isFolded(line)) {
+        unfoldAt(line);
+    }
+}
+
+/********************************************************************
+*                              foldAll                       public *
+*-------------------------------------------------------------------*
+* Every region is folded in one pass over the lines: the number of  *
+* regions hiding a line is counted from their starts and ends, and  *
+* the document is laid out again once.                              *
+********************************************************************/
+void Editor::foldAll() {
+    TraceScope trace("foldAll", "editor");
+    QTextDocument* const doc = document();
+    const int count = doc->blockCount();
+    std::vector<int> depth(size_t(count) + 1, 0);
+    std::vector<bool> headers(size_t(count), false);
+    for (const auto& region : _brackets.regions()) {
+        ++depth[size_t(region.first)];
+        --depth[size_t(region.last + 1)];
+        headers[size_t(region.header)] = true;
+    }
+
+    int hidden = 0;
+    int line = 0;
+    for (QTextBlock block = doc->begin(); block.isValid() && line < count; block = block.next(), ++line) {
+        hidden += depth[size_t(line)];
+        block.setVisible(hidden == 0);
+        block.setUserState(headers[size_t(line)] ? Folded : -1);
+    }
+    doc->markContentsDirty(0, doc->characterCount());
+
+    QTextBlock block = textCursor().block();
+    if (!block.isVisible()) {
+        while (!block.isVisible() && block.previous().isValid()) {
+            block = block.previous();
+        }
+        QTextCursor cursor(block);
+        cursor.movePosition(QTextCursor::EndOfBlock);
+        setTextCursor(cursor);
+    }
+    ensureCursorVisible();
+    viewport()->update();
+}
+
+/********************************************************************
+*                             unfoldAll                      public *
+********************************************************************/
+void Editor::unfoldAll() {
+    TraceScope trace("unfoldAll", "editor");
+    QTextDocument* const doc = document();
+    for (QTextBlock block = doc->begin(); block.isValid(); block = block.next()) {
+        block.setVisible(true);
+        block.setUserState(-1);
+    }
+    doc->markContentsDirty(0, doc->characterCount());
+    ensureCursorVisible();
+    viewport()->update();
+}
+
+/********************************************************************
+*                        gotoMatchingBracket                 public *
+*-------------------------------------------------------------------*
+* Moves the cursor to the bracket paired with the one at (or just   *
+* before) the cursor.                                               *
+********************************************************************/
+bool Editor::gotoMatchingBracket() {
+    int line, column, otherLine, otherColumn;
+    if (!bracketAtCursor(line, column, otherLine, otherColumn)) {
+        return false;
+    }
+    const QTextBlock block = document()->findBlockByNumber(otherLine);
+    QTextCursor cursor(block);
+    cursor.setPosition(block.position() + otherColumn);
+    setTextCursor(cursor);
+    ensureCursorVisible();
+    return true;
+}
+
+/********************************************************************
+*                   addCursorAbove/addCursorBelow            public *
+********************************************************************/
+bool Editor::addCursorAbove() {
+    const bool added = _multiCursor.addVertical(-1);
+    updateSelections();
+    return added;
+}
+
+bool Editor::addCursorBelow() {
+    const bool added = _multiCursor.addVertical(1);
+    updateSelections();
+    return added;
+}
+
+/********************************************************************
+*                         addNextOccurrence                  public *
+********************************************************************/
+bool Editor::addNextOccurrence() {
+    const bool added = _multiCursor.addNextOccurrence();
+    updateSelections();
+    return added;
+}
+
+/********************************************************************
+*                       selectAllOccurrences                 public *
+*-------------------------------------------------------------------*
+* Returns the number of cursors, 0 when there is nothing to select. *
+********************************************************************/
+int Editor::selectAllOccurrences() {
+    const int count = _multiCursor.selectAllOccurrences();
+    updateSelections();
+    return count;
+}
+
+/********************************************************************
+*                            paintEvent                   protected *
+*-------------------------------------------------------------------*
+* Headers of folded regions are marked after their text, extra      *
+* cursors are drawn over the text.                                  *
+********************************************************************/
+void Editor::paintEvent(QPaintEvent* event) {
+    TraceScope trace("paint", "editor");
+    QPlainTextEdit::paintEvent(event);
+
+    QPainter painter(viewport());
+    painter.setPen(palette().color(QPalette::Mid));
+    const QFontMetrics fm(font());
+    const QPointF offset = contentOffset();
+    const int first = firstVisibleBlock().blockNumber();
+    int last = first;
+    for (QTextBlock block = firstVisibleBlock(); block.isValid(); block = block.next()) {
+        if (!block.isVisible()) {
+            continue;
+        }
+        const QRectF rect = blockBoundingGeometry(block).translated(offset);
+        if (rect.top() > event->rect().bottom()) {
+            break;
+        }
+        last = block.blockNumber();
+        if (block.userState() != Folded || block.layout()->lineCount() == 0) {
+            continue;
+        }
+        const qreal x = rect.left() + block.layout()->lineAt(0).naturalTextRect().right() + fm.horizontalAdvance(' ');
+        const QRectF box(x, rect.top() + 1, fm.horizontalAdvance(" ... "), fm.height() - 2);
+        painter.drawRect(box);
+        painter.drawText(box, Qt::AlignCenter, "...");
+    }
+
+    // Extra cursors, only the ones on lines in the view.
+    for (const auto& cursor : _multiCursor.cursors()) {
+        const int line = cursor.blockNumber();
+        if (line >= first && line <= last && cursor.block().isVisible()) {
+            const QRect rect = cursorRect(cursor);
+            painter.fillRect(rect.x(), rect.y(), qMax(1, cursorWidth()), rect.height(), palette().color(QPalette::Text));
+        }
+    }
+}
+
+/********************************************************************
+*                            resizeEvent                  protected *
+*-------------------------------------------------------------------*
+* Minimap takes the right margin of the viewport, the bar of        *
+* changes the left one.                                             *
+********************************************************************/
+void Editor::resizeEvent(QResizeEvent* event) {
+    QPlainTextEdit::resizeEvent(event);
+    const QRect view = viewport()->geometry();
+    _minimap->setGeometry(view.right() + 1, view.top(), Minimap::Width, view.height());
+    _changeBar->setGeometry(view.left() - ChangeBar::Width, view.top(), ChangeBar::Width, view.height());
+}
+
+/********************************************************************
+*                           keyPressEvent                 protected *
+*-------------------------------------------------------------------*
+* With extra cursors keys go to all of them. Escape or a key they   *
+* don't handle brings the editor back to a single cursor.           *
+********************************************************************/
+void Editor::keyPressEvent(QKeyEvent* event) {
+    if (!_multiCursor.isEmpty()) {
+        switch (event->key()) {
+        case Qt::Key_Shift:
+        case Qt::Key_Control:
+        case Qt::Key_Alt:
+        case Qt::Key_Meta:
+            break;
+        case Qt::Key_Escape:
+            _multiCursor.clear();
+            updateSelections();
+            return;
+        default:
+            if (_multiCursor.keyPress(event)) {
+                updateSelections();
+                ensureCursorVisible();
+                return;
+            }
+            _multiCursor.clear();
+            updateSelections();
+        }
+    }
+    QPlainTextEdit::keyPressEvent(event);
+}
+
+/********************************************************************
+*                  mousePressEvent/mouseMoveEvent         protected *
+*-------------------------------------------------------------------*
+* Alt+click adds a cursor, Alt+Shift+drag selects columns.          *
+********************************************************************/
+void Editor::mousePressEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton && (event->modifiers() & Qt::AltModifier)) {
+        const QTextCursor cursor = cursorForPosition(event->pos());
+        if (event->modifiers() & Qt::ShiftModifier) {
+            _columnLine = cursor.blockNumber();
+            _columnColumn = cursor.positionInBlock();
+            _multiCursor.selectColumns(_columnLine, _columnColumn, _columnLine, _columnColumn);
+        } else {
+            _multiCursor.add(cursor);
+        }
+        updateSelections();
+        return;
+    }
+    if (!_multiCursor.isEmpty()) {
+        _multiCursor.clear();
+        updateSelections();
+    }
+    QPlainTextEdit::mousePressEvent(event);
+}
+
+void Editor::mouseMoveEvent(QMouseEvent* event) {
+    if (_columnLine >= 0 && (event->buttons() & Qt::LeftButton)) {
+        const QTextCursor cursor = cursorForPosition(event->pos());
+        _multiCursor.selectColumns(_columnLine, _columnColumn, cursor.blockNumber(), cursor.positionInBlock());
+        updateSelections();
+        return;
+    }
+    QPlainTextEdit::mouseMoveEvent(event);
+}
+
+/********************************************************************
+*                         mouseReleaseEvent               protected *
+********************************************************************/
+void Editor::mouseReleaseEvent(QMouseEvent* event) {
+    if (_columnLine >= 0) {
+        _columnLine = -1;
+        return;
+    }
+    QPlainTextEdit::mouseReleaseEvent(event);
+}
+
+/********************************************************************
+*                          contentsChange                   private *
+*-------------------------------------------------------------------*
+* Lines of the edit are scanned again (and the following ones while *
+* the lexer state at their end changes), then pairs around them are *
+* matched again. Folds the edit went into are opened.               *
+********************************************************************/
+void Editor::contentsChange(const int position, const int, const int added) {
+    TraceScope trace("brackets", "editor");
+    QTextDocument* const doc = document();
+    QTextBlock block = doc->findBlock(position);
+    if (!block.isValid()) {
+        return;
+    }
+    const int first = block.blockNumber();
+    const int delta = doc->blockCount() - _brackets.lineCount();
+    const int last = qMax(first + qMax(0, delta), doc->findBlock(position + added).blockNumber());
+    _brackets.shift(first, delta);
+
+    int line = first;
+    for (; block.isValid(); block = block.next(), ++line) {
+        const QString text = block.text();
+        const bool changed = _brackets.scan(line, reinterpret_cast<const char16_t*>(text.utf16()), text.size());
+        if (line >= last && !changed) {
+            break;
+        }
+    }
+    _brackets.match(first, qMin(line, doc->blockCount() - 1));
+
+    block = doc->findBlockByNumber(first);
+    for (line = first; block.isValid() && line <= last; block = block.next(), ++line) {
+        if (block.userState() == Folded) {
+            unfoldAt(line);
+        } else if (!block.isVisible()) {
+            reveal(line);
+        }
+    }
+}
+
+/********************************************************************
+*                            cursorMoved                    private *
+*-------------------------------------------------------------------*
+* The cursor never stays in a folded region. Brackets of the pair   *
+* at the cursor are highlighted.                                    *
+********************************************************************/
+void Editor::cursorMoved() {
+    const QTextBlock current = textCursor().block();
+    if (!current.isVisible()) {
+        reveal(current.blockNumber());
+    }
+
+    _bracketSelections.clear();
+    auto highlight = [this](const int line, const int column) {
+        const QTextBlock block = document()->findBlockByNumber(line);
+        QTextEdit::ExtraSelection selection;
+        selection.format.setBackground(QColor(128, 128, 128, 64));
+        selection.cursor = QTextCursor(block);
+        selection.cursor.setPosition(block.position() + column);
+        selection.cursor.movePosition(QTextCursor::NextCharacter, QTextCursor::KeepAnchor);
+        _bracketSelections.append(selection);
+    };
+    int line, column, otherLine, otherColumn;
+    if (Settings::values().matchBrackets && bracketAtCursor(line, column, otherLine, otherColumn)) {
+        highlight(line, column);
+        highlight(otherLine, otherColumn);
+    }
+    updateSelections();
+}
+
+/********************************************************************
+*                            setFolded                      private *
+*-------------------------------------------------------------------*
+* Hides or shows lines of the region. Folded regions inside the one *
+* being unfolded stay folded.                                       *
+********************************************************************/
+void Editor::setFolded(const BracketTree::Region& region, const bool folded) {
+    QTextDocument* const doc = document();
+    QTextBlock block = doc->findBlockByNumber(region.header);
+    if (!block.isValid()) {
+        return;
+    }
+    block.setUserState(folded ? Folded : -1);
+    const int from = block.position();
+
+    block = block.next();
+    for (int line = region.first; block.isValid() && line <= region.last;) {
+        block.setVisible(!folded);
+        BracketTree::Region inner;
+        if (!folded && block.userState() == Folded && _brackets.region(line, inner) && inner.last <= region.last) {
+            line = inner.last + 1;
+            block = doc->findBlockByNumber(line);
+            continue;
+        }
+        block = block.next();
+        ++line;
+    }
+    const int to = block.isValid() ? block.position() : doc->characterCount();
+    doc->markContentsDirty(from, to - from);
+    viewport()->update();
+}
+
+/********************************************************************
+*                             unfoldAt                      private *
+*-------------------------------------------------------------------*
+* Unfolds the region with the header 'header'. Hidden lines below   *
+* it are shown too: an edit could have shrunk the region or taken   *
+* it away, they were hidden by it.                                  *
+********************************************************************/
+void Editor::unfoldAt(const int header) {
+    QTextDocument* const doc = document();
+    int line = header + 1;
+    if (BracketTree::Region region; _brackets.region(header, region)) {
+        setFolded(region, false);
+        line = region.last + 1;
+    } else {
+        doc->findBlockByNumber(header).setUserState(-1);
+    }
+
+    QTextBlock block = doc->findBlockByNumber(line);
+    const int from = block.position();
+    while (block.isValid() && !block.isVisible()) {
+        block.setVisible(true);
+        block = block.next();
+    }
+    const int to = block.isValid() ? block.position() : doc->characterCount();
+    if (to > from) {
+        doc->markContentsDirty(from, to - from);
+        viewport()->update();
+    }
+}
+
+/********************************************************************
+*                              reveal                       private *
+*-------------------------------------------------------------------*
+* Unfolds every region hiding the line 'line'.                      *
+********************************************************************/
+void Editor::reveal(const int line) {
+    for (const auto& region : _brackets.regionsAt(line)) {
+        if (line >= region.first && isFolded(region.header)) {
+            setFolded(region, false);
+        }
+    }
+    // Hidden by a fold the tree knows no more.
+    if (QTextBlock block = document()->findBlockByNumber(line); block.isValid() && !block.isVisible()) {
+        block.setVisible(true);
+        document()->markContentsDirty(block.position(), block.length());
+        viewport()->update();
+    }
+}
+
+/********************************************************************
+*                             isFolded                      private *
+********************************************************************/
+bool Editor::isFolded(const int line) const {
+    return document()->findBlockByNumber(line).userState() == Folded;
+}
+
+/********************************************************************
+*                          bracketAtCursor                  private *
+*-------------------------------------------------------------------*
+* Bracket right after the cursor or, if there is none, just before  *
+* it, with its pair.                                                *
+********************************************************************/
+bool Editor::bracketAtCursor(int& line, int& column, int& otherLine, int& otherColumn) const {
+    const QTextCursor cursor = textCursor();
+    line = cursor.blockNumber();
+    column = cursor.positionInBlock();
+    if (_brackets.matching(line, column, otherLine, otherColumn)) {
+        return true;
+    }
+    if (column > 0 && _brackets.matching(line, column - 1, otherLine, otherColumn)) {
+        --column;
+        return true;
+    }
+    return false;
+}
+
+/********************************************************************
+*                         updateSelections                  private *
+*-------------------------------------------------------------------*
+* Extra selections are the bracket pair at the cursor and the texts *
+* selected by extra cursors.                                        *
+********************************************************************/
+void Editor::updateSelections() {
+    setExtraSelections(_bracketSelections + _multiCursor.selections());
+    viewport()->update();
+}
+
+/********************************************************************
+*                           applySettings                   private *
+*-------------------------------------------------------------------*
+* Settings changing the look of the editor. Those read while typing *
+* are taken from Settings::values() where they are used.            *
+********************************************************************/
+void Editor::applySettings() {
+    const auto& settings = Settings::values();
+    QFont fixed = QFontDatabase::systemFont(QFontDatabase::FixedFont);
+    if (settings.fontSize > 0) {
+        fixed.setPointSize(settings.fontSize);
+    }
+    if (fixed != font()) {
+        setFont(fixed);
+    }
+    setTabStopDistance(settings.tabWidth * QFontMetricsF(fixed).horizontalAdvance(' '));
+
+    _minimap->setVisible(settings.showMinimap);
+    _changeBar->setVisible(settings.showChangeBar);
+    setViewportMargins(settings.showChangeBar ? ChangeBar::Width : 0, 0,
+                       settings.showMinimap ? Minimap::Width : 0, 0);
+    if (!settings.matchBrackets && !_bracketSelections.isEmpty()) {
+        _bracketSelections.clear();
+        updateSelections();
+    }
+}
@@ -0,0 +1,124 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Editor.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_EDITOR_H
+#define GOEDIT_EDITOR_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QPlainTextEdit>
+#include "Workspace/Buffer.h"
+#include "Workspace/TextFile.h"
+#include "Workspace/BracketTree.h"
+#include "Workspace/MultiCursor.h"
+#include "Project/Session.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class Minimap;
+class ChangeBar;
+
+/********************************************************************
+*                              Editor                               *
+********************************************************************/
+class Editor : public QPlainTextEdit, public Buffer {
+    Q_OBJECT
+
+    // Block user state of the header line of a folded region.
+    static constexpr int Folded = 1;
+
+    Minimap* const _minimap;
+    ChangeBar* const _changeBar;
+    BracketTree _brackets;
+    MultiCursor _multiCursor;
+    QList<QTextEdit::ExtraSelection> _bracketSelections;
+    // Start of a column selection dragged with the mouse.
+    int _columnLine;
+    int _columnColumn;
+    // Encoding and line endings the file is saved with.
+    TextFile::Format _format;
+    // Position to apply when a deferred document is loaded.
+    Session::Document _deferred;
+    bool _isDeferred;
+public:
+    explicit Editor(QWidget* = nullptr);
+
+    QWidget* widget() override {
+        return this;
+    }
+    bool load(const QString&) override;
+    bool saveAs(const QString&) override;
+    bool isModified() const override {
+        return document()->isModified();
+    }
+    void gotoPosition(const int, const int) override;
+    QString wordUnderCursor() const override;
+    int cursorLine() const override {
+        return textCursor().blockNumber();
+    }
+    QString text() const override {
+        return toPlainText();
+    }
+
+    void defer(const Session::Document&);
+    bool hydrate();
+    bool isDeferred() const {
+        return _isDeferred;
+    }
+    Session::Document snapshot() const;
+    ChangeBar* changeBar() const {
+        return _changeBar;
+    }
+
+    void fold();
+    void unfold();
+    void foldAll();
+    void unfoldAll();
+    bool gotoMatchingBracket();
+    bool addCursorAbove();
+    bool addCursorBelow();
+    bool addNextOccurrence();
+    int selectAllOccurrences();
+
+protected:
+    void paintEvent(QPaintEvent*) override;
+    void resizeEvent(QResizeEvent*) override;
+    void keyPressEvent(QKeyEvent*) override;
+    void mousePressEvent(QMouseEvent*) override;
+    void mouseMoveEvent(QMouseEvent*) override;
+    void mouseReleaseEvent(QMouseEvent*) override;
+
+private:
+    void contentsChange(const int, const int, const int);
+    void cursorMoved();
+    void setFolded(const BracketTree::Region&, const bool);
+    void unfoldAt(const int);
+    void reveal(const int);
+    bool isFolded(const int) const;
+    bool bracketAtCursor(int&, int&, int&, int&) const;
+    void updateSelections();
+    void applySettings();
+};
+
+#endif // GOEDIT_EDITOR_H
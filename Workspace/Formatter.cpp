@@ -0,0 +1,198 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Formatter.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFileInfo>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTimer>
+#include <QtConcurrent>
+#include <QDebug>
+#include "Formatter.h"
+#include "Editor.h"
+#include "Shared/Trace.h"
+
+//*******************************************************************
+//                             Formatter                        CTOR
+//*******************************************************************
+Formatter::Formatter(QObject* parent)
+    : QObject(parent)
+{
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                            ~Formatter                        dtor *
+********************************************************************/
+Formatter::~Formatter() {
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                              format                        public *
+*-------------------------------------------------------------------*
+* Queues the editor, unless it is already queued or formatted.      *
+********************************************************************/
+void Formatter::format(Editor* editor) {
+    if (_running.contains(editor) || _queue.contains(editor)) {
+        return;
+    }
+    _queue.append(editor);
+    next();
+}
+
+/********************************************************************
+*                               apply                 public static *
+*-------------------------------------------------------------------*
+* Replaces lines of the document (blocks) by lines of 'lines' as    *
+* the hunks say, from the last hunk, so line numbers of the hunks   *
+* before stay valid. One edit block: one step of undo.              *
+********************************************************************/
+void Formatter::apply(QTextDocument* doc, const QStringList& lines, const std::vector<Diff::Hunk>& hunks) {
+    QTextCursor cursor(doc);
+    cursor.beginEditBlock();
+    for (auto it = hunks.rbegin(); it != hunks.rend(); ++it) {
+        const QStringList text = lines.mid(it->newStart, it->newCount);
+        const int end = it->oldStart + it->oldCount;
+        if (end < doc->blockCount()) {
+            // whole lines, up to the start of the line after them
+            cursor.setPosition(doc->findBlockByNumber(it->oldStart).position());
+            cursor.setPosition(doc->findBlockByNumber(end).position(), QTextCursor::KeepAnchor);
+            cursor.insertText(text.isEmpty() ? QString() : text.join('\n') + '\n');
+        } else if (it->oldStart > 0) {
+            // up to the end: from the end of the line before
+            const QTextBlock before = doc->findBlockByNumber(it->oldStart - 1);
+            cursor.setPosition(before.position() + before.length() - 1);
+            cursor.movePosition(QTextCursor::End, QTextCursor::KeepAnchor);
+            cursor.insertText(text.isEmpty() ? QString() : '\n' + text.join('\n'));
+        } else {
+            cursor.select(QTextCursor::Document);
+            cursor.insertText(text.join('\n'));
+        }
+    }
+    cursor.endEditBlock();
+}
+
+/********************************************************************
+*                               next                        private *
+********************************************************************/
+void Formatter::next() {
+    while (_running.size() < MaxProcesses && !_queue.isEmpty()) {
+        if (const QPointer<Editor> editor = _queue.takeFirst(); editor) {
+            start(editor);
+        }
+    }
+}
+
+/********************************************************************
+*                               start                       private *
+*-------------------------------------------------------------------*
+* The text goes to the standard input of the formatter, so what is  *
+* formatted is exactly what the editor has.                         *
+********************************************************************/
+void Formatter::start(Editor* editor) {
+    QStringList args = command(QFileInfo(editor->path()).path());
+    if (args.isEmpty()) {
+        return;
+    }
+    const QString program = args.takeFirst();
+    const int revision = editor->document()->revision();
+    const QByteArray input = editor->toPlainText().toUtf8();
+    _running.append(editor);
+
+    auto const process = new QProcess(this);
+    QTimer::singleShot(TimeoutMs, process, [process] {
+        process->kill();
+    });
+    connect(process, &QProcess::errorOccurred, this, [this, process, editor](const QProcess::ProcessError error) {
+        if (error == QProcess::FailedToStart) {
+            qWarning() << "Formatter: can't start" << process->program();
+            process->deleteLater();
+            done(editor);
+        }
+    });
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this,
+            [this, process, editor = QPointer<Editor>(editor), key = editor, revision, input](const int code, const QProcess::ExitStatus status) {
+        process->deleteLater();
+        done(key);
+        if (status == QProcess::NormalExit && code == 0) {
+            finished(editor, revision, input, process->readAllStandardOutput());
+        }
+    });
+    process->start(program, args);
+    process->write(input);
+    process->closeWriteChannel();
+}
+
+/********************************************************************
+*                               done                        private *
+********************************************************************/
+void Formatter::done(Editor* editor) {
+    _running.removeOne(editor);
+    next();
+}
+
+/********************************************************************
+*                             finished                      private *
+*-------------------------------------------------------------------*
+* Diffs the output with the text sent in the pool thread, applies   *
+* it if the text of the editor is still the same.                   *
+********************************************************************/
+void Formatter::finished(QPointer<Editor> editor, const int revision, const QByteArray& input, const QByteArray& output) {
+    if (!editor || output == input || editor->document()->revision() != revision) {
+        return;
+    }
+    QtConcurrent::run(&_pool, [this, editor, revision, input, output] {
+        TraceScope trace("Formatter::diff", "editor");
+        auto hunks = Diff::lines(Diff::split({input.constData(), size_t(input.size())}),
+                                 Diff::split({output.constData(), size_t(output.size())}));
+        QMetaObject::invokeMethod(this, [this, editor, revision, output, hunks = std::move(hunks)] {
+            if (editor && editor->document()->revision() == revision) {
+                apply(editor->document(), QString::fromUtf8(output).split('\n'), hunks);
+                emit formatted(editor);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                              command               private static *
+*-------------------------------------------------------------------*
+* Program and arguments; goimports resolves imports of the package  *
+* in the directory 'dir'.                                           *
+********************************************************************/
+QStringList Formatter::command(const QString& dir) {
+    if (qEnvironmentVariableIsSet("GOEDIT_GOFMT")) {
+        return qEnvironmentVariable("GOEDIT_GOFMT").split(' ', Qt::SkipEmptyParts);
+    }
+    if (const QString goimports = QStandardPaths::findExecutable("goimports"); !goimports.isEmpty()) {
+        return {goimports, "-srcdir", dir};
+    }
+    return {"gofmt"};
+}
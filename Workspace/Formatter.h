@@ -0,0 +1,80 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Formatter.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_FORMATTER_H
+#define GOEDIT_FORMATTER_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QPointer>
+#include <QStringList>
+#include <QThreadPool>
+#include <vector>
+#include "Shared/Diff.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class Editor;
+class QTextDocument;
+
+/********************************************************************
+*                             Formatter                             *
+*-------------------------------------------------------------------*
+* Formats saved Go files with goimports (gofmt when it is missing,  *
+* or the command in GOEDIT_GOFMT). At most MaxProcesses formatters  *
+* run at once, others wait in the queue. The output is diffed with  *
+* the text in background and only the changed lines are replaced,   *
+* in one undo step, so cursors and the undo history are kept. When  *
+* the user typed in the meantime the result is dropped. An empty    *
+* GOEDIT_GOFMT turns formatting off.                                *
+********************************************************************/
+class Formatter : public QObject {
+    Q_OBJECT
+
+    static constexpr int MaxProcesses = 2;
+    static constexpr int TimeoutMs = 10000;
+
+    QList<QPointer<Editor>> _queue;
+    QList<Editor*> _running;
+    QThreadPool _pool;
+public:
+    explicit Formatter(QObject* = nullptr);
+    ~Formatter() override;
+
+    void format(Editor*);
+    static void apply(QTextDocument*, const QStringList&, const std::vector<Diff::Hunk>&);
+
+private:
+    void next();
+    void start(Editor*);
+    void done(Editor*);
+    void finished(QPointer<Editor>, const int, const QByteArray&, const QByteArray&);
+    static QStringList command(const QString&);
+
+signals:
+    void formatted(Editor*);
+};
+
+#endif // GOEDIT_FORMATTER_H
@@ -0,0 +1,468 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LongLineEditor.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QFontDatabase>
+#include <QFontMetrics>
+#include <QPainter>
+#include <QScrollBar>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QGuiApplication>
+#include <QClipboard>
+#include <cstring>
+#include <climits>
+#include "LongLineEditor.h"
+#include "Go/GoLexer.h"
+#include "Shared/Trace.h"
+
+//*******************************************************************
+//                          LongLineEditor                      CTOR
+//*******************************************************************
+LongLineEditor::LongLineEditor(QWidget* parent)
+    : QAbstractScrollArea(parent)
+    , _lines(1)
+    , _format{}
+    , _longest(0)
+    , _line(0)
+    , _column(0)
+    , _modified(false)
+{
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    const QFontMetrics metrics(font());
+    _charWidth = qMax(1, metrics.horizontalAdvance('M'));
+    _lineHeight = qMax(1, metrics.height());
+    viewport()->setCursor(Qt::IBeamCursor);
+    setFocusPolicy(Qt::StrongFocus);
+}
+
+/********************************************************************
+*                               detect                public static *
+*-------------------------------------------------------------------*
+* Does the file have a line longer than MaxLineLength? Reading      *
+* stops at the first such line.                                     *
+********************************************************************/
+bool LongLineEditor::detect(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QByteArray block(64 * 1024, Qt::Uninitialized);
+    qint64 run = 0;
+    for (qint64 n = file.read(block.data(), block.size()); n > 0; n = file.read(block.data(), block.size())) {
+        const char* p = block.constData();
+        const char* const end = p + n;
+        while (p < end) {
+            auto const eol = static_cast<const char*>(memchr(p, '\n', size_t(end - p)));
+            if (!eol) {
+                run += end - p;
+                break;
+            }
+            if (run + (eol - p) > MaxLineLength) {
+                return true;
+            }
+            run = 0;
+            p = eol + 1;
+        }
+        if (run > MaxLineLength) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/********************************************************************
+*                               load                         public *
+********************************************************************/
+bool LongLineEditor::load(const QString& path) {
+    if (!TextFile::readLines(path, _lines, _format)) {
+        return false;
+    }
+    _longest = 0;
+    for (const auto& line : _lines) {
+        _longest = qMax(_longest, line.size());
+    }
+    _line = _column = 0;
+    setPath(path);
+    setModified(false);
+    updateScrollBars();
+    viewport()->update();
+    return true;
+}
+
+/********************************************************************
+*                              saveAs                        public *
+********************************************************************/
+bool LongLineEditor::saveAs(const QString& path) {
+    if (!TextFile::write(path, text(), _format)) {
+        return false;
+    }
+    setPath(path);
+    setModified(false);
+    return true;
+}
+
+/********************************************************************
+*                               text                         public *
+********************************************************************/
+QString LongLineEditor::text() const {
+    QString text;
+    for (size_t i = 0; i < _lines.size(); i++) {
+        if (i > 0) {
+            text += '\n';
+        }
+        text += _lines[i];
+    }
+    return text;
+}
+
+/********************************************************************
+*                           gotoPosition                     public *
+********************************************************************/
+void LongLineEditor::gotoPosition(const int line, const int column) {
+    moveTo(line, column);
+    setFocus();
+}
+
+/********************************************************************
+*                          wordUnderCursor                   public *
+*-------------------------------------------------------------------*
+* Searched at most WordLimit characters around the cursor.          *
+********************************************************************/
+QString LongLineEditor::wordUnderCursor() const {
+    const QString& text = _lines[size_t(_line)];
+    auto isWord = [](const QChar c) {
+        return c.isLetterOrNumber() || c == '_';
+    };
+    int begin = _column;
+    while (begin > 0 && _column - begin < WordLimit && isWord(text[begin - 1])) {
+        --begin;
+    }
+    int end = _column;
+    while (end < text.size() && end - _column < WordLimit && isWord(text[end])) {
+        ++end;
+    }
+    return text.mid(begin, end - begin);
+}
+
+/********************************************************************
+*                            paintEvent                   protected *
+********************************************************************/
+void LongLineEditor::paintEvent(QPaintEvent*) {
+    TraceScope trace("paint", "editor");
+    QPainter painter(viewport());
+    painter.setFont(font());
+    painter.fillRect(viewport()->rect(), palette().color(QPalette::Base));
+
+    const int firstLine = verticalScrollBar()->value();
+    const int lastLine = qMin(firstLine + visibleLines(), int(_lines.size()) - 1);
+    const int firstColumn = horizontalScrollBar()->value();
+    const int columns = visibleColumns();
+
+    for (int line = firstLine; line <= lastLine; line++) {
+        drawLine(painter, line, (line - firstLine) * _lineHeight, firstColumn, columns);
+    }
+
+    if (_line >= firstLine && _line <= lastLine && _column >= firstColumn && _column <= firstColumn + columns) {
+        const int x = (_column - firstColumn) * _charWidth;
+        const int y = (_line - firstLine) * _lineHeight;
+        painter.fillRect(x, y, 2, _lineHeight, palette().color(QPalette::Text));
+    }
+}
+
+/********************************************************************
+*                              drawLine                     private *
+*-------------------------------------------------------------------*
+* Draws columns [first, first + count) of the line. Tokens are      *
+* found by lexing from Lookbehind columns before the window, so a   *
+* token started far to the left may get a wrong color; the price of *
+* never looking at the whole line.                                  *
+********************************************************************/
+void LongLineEditor::drawLine(QPainter& painter, const int line, const int y, const int first, const int count) const {
+    const QString& text = _lines[size_t(line)];
+    if (first >= text.size()) {
+        return;
+    }
+    const int end = qMin(text.size(), first + count);
+    const int start = qMax(0, first - Lookbehind);
+    const auto data = reinterpret_cast<const char16_t*>(text.utf16());
+
+    const QColor normal = palette().color(QPalette::Text);
+    const QColor keyword(0x3b, 0x7d, 0xd8);
+    const QColor literal(0xc0, 0x6a, 0x2b);
+    const QColor comment(0x6a, 0x99, 0x55);
+    const int baseline = y + QFontMetrics(font()).ascent();
+
+    GoLexer<char16_t> lexer(data + start, end - start);
+    for (GoToken token = lexer.next(); token.kind != GoToken::End; token = lexer.next()) {
+        if (token.length == 0) {
+            continue;
+        }
+        const int tokenBegin = qMax(start + token.begin, first);
+        const int tokenEnd = qMin(start + token.begin + token.length, end);
+        if (tokenBegin >= tokenEnd) {
+            continue;
+        }
+        switch (token.kind) {
+        case GoToken::Keyword:
+            painter.setPen(keyword);
+            break;
+        case GoToken::Number:
+        case GoToken::String:
+        case GoToken::RawString:
+        case GoToken::Rune:
+            painter.setPen(literal);
+            break;
+        case GoToken::Comment:
+            painter.setPen(comment);
+            break;
+        default:
+            painter.setPen(normal);
+        }
+        // One cell per code unit, tabs included.
+        QString cells = text.mid(tokenBegin, tokenEnd - tokenBegin);
+        cells.replace('\t', ' ');
+        painter.drawText((tokenBegin - first) * _charWidth, baseline, cells);
+    }
+}
+
+/********************************************************************
+*                           keyPressEvent                 protected *
+********************************************************************/
+void LongLineEditor::keyPressEvent(QKeyEvent* event) {
+    const bool ctrl = event->modifiers() & Qt::ControlModifier;
+    const int length = _lines[size_t(_line)].size();
+
+    switch (event->key()) {
+    case Qt::Key_Left:
+        if (_column > 0) moveTo(_line, _column - 1);
+        else if (_line > 0) moveTo(_line - 1, _lines[size_t(_line - 1)].size());
+        return;
+    case Qt::Key_Right:
+        if (_column < length) moveTo(_line, _column + 1);
+        else if (_line + 1 < int(_lines.size())) moveTo(_line + 1, 0);
+        return;
+    case Qt::Key_Up:
+        moveTo(_line - 1, _column);
+        return;
+    case Qt::Key_Down:
+        moveTo(_line + 1, _column);
+        return;
+    case Qt::Key_PageUp:
+        moveTo(_line - visibleLines(), _column);
+        return;
+    case Qt::Key_PageDown:
+        moveTo(_line + visibleLines(), _column);
+        return;
+    case Qt::Key_Home:
+        ctrl ? moveTo(0, 0) : moveTo(_line, 0);
+        return;
+    case Qt::Key_End:
+        ctrl ? moveTo(int(_lines.size()) - 1, INT_MAX) : moveTo(_line, length);
+        return;
+    case Qt::Key_Backspace:
+        removeBackward();
+        return;
+    case Qt::Key_Delete:
+        removeForward();
+        return;
+    case Qt::Key_Return:
+    case Qt::Key_Enter:
+        insert("\n");
+        return;
+    }
+    if (event->matches(QKeySequence::Paste)) {
+        insert(QGuiApplication::clipboard()->text());
+        return;
+    }
+    const QString text = event->text();
+    if (!text.isEmpty() && !ctrl && (text[0].isPrint() || text[0] == '\t')) {
+        insert(text);
+        return;
+    }
+    QAbstractScrollArea::keyPressEvent(event);
+}
+
+/********************************************************************
+*                          mousePressEvent                protected *
+********************************************************************/
+void LongLineEditor::mousePressEvent(QMouseEvent* event) {
+    const int line = verticalScrollBar()->value() + event->pos().y() / _lineHeight;
+    const int column = horizontalScrollBar()->value() + (event->pos().x() + _charWidth / 2) / _charWidth;
+    moveTo(line, column);
+}
+
+/********************************************************************
+*                            resizeEvent                  protected *
+********************************************************************/
+void LongLineEditor::resizeEvent(QResizeEvent* event) {
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBars();
+}
+
+/********************************************************************
+*                         scrollContentsBy                protected *
+*-------------------------------------------------------------------*
+* Nothing is scrolled in pixels, the window is simply drawn again.  *
+********************************************************************/
+void LongLineEditor::scrollContentsBy(int, int) {
+    viewport()->update();
+}
+
+/********************************************************************
+*                               moveTo                      private *
+*-------------------------------------------------------------------*
+* Moves the cursor, positions out of the text are clamped.          *
+********************************************************************/
+void LongLineEditor::moveTo(const int line, const int column) {
+    _line = qBound(0, line, int(_lines.size()) - 1);
+    _column = qBound(0, column, _lines[size_t(_line)].size());
+    ensureVisible();
+    viewport()->update();
+}
+
+/********************************************************************
+*                               insert                      private *
+*-------------------------------------------------------------------*
+* Inserts text at the cursor, new lines split the current line.     *
+********************************************************************/
+void LongLineEditor::insert(const QString& text) {
+    if (text.isEmpty()) {
+        return;
+    }
+    const QStringList parts = text.split('\n');
+    QString& current = _lines[size_t(_line)];
+    const QString tail = current.mid(_column);
+    current.truncate(_column);
+    current += parts.first();
+
+    int line = _line;
+    for (int i = 1; i < parts.size(); i++) {
+        _lines.insert(_lines.begin() + ++line, parts[i]);
+    }
+    const int column = _lines[size_t(line)].size();
+    _lines[size_t(line)] += tail;
+    for (int i = _line; i <= line; i++) {
+        _longest = qMax(_longest, _lines[size_t(i)].size());
+    }
+
+    setModified(true);
+    updateScrollBars();
+    moveTo(line, column);
+}
+
+/********************************************************************
+*                     removeBackward/removeForward          private *
+********************************************************************/
+void LongLineEditor::removeBackward() {
+    if (_column > 0) {
+        _lines[size_t(_line)].remove(_column - 1, 1);
+        setModified(true);
+        moveTo(_line, _column - 1);
+    } else if (_line > 0) {
+        const int column = _lines[size_t(_line - 1)].size();
+        _lines[size_t(_line - 1)] += _lines[size_t(_line)];
+        _longest = qMax(_longest, _lines[size_t(_line - 1)].size());
+        _lines.erase(_lines.begin() + _line);
+        setModified(true);
+        updateScrollBars();
+        moveTo(_line - 1, column);
+    }
+}
+
+void LongLineEditor::removeForward() {
+    QString& current = _lines[size_t(_line)];
+    if (_column < current.size()) {
+        current.remove(_column, 1);
+        setModified(true);
+        viewport()->update();
+    } else if (_line + 1 < int(_lines.size())) {
+        current += _lines[size_t(_line + 1)];
+        _longest = qMax(_longest, current.size());
+        _lines.erase(_lines.begin() + _line + 1);
+        setModified(true);
+        updateScrollBars();
+        viewport()->update();
+    }
+}
+
+/********************************************************************
+*                            setModified                    private *
+********************************************************************/
+void LongLineEditor::setModified(const bool state) {
+    if (_modified != state) {
+        _modified = state;
+        emit modificationChanged(state);
+    }
+}
+
+/********************************************************************
+*                         updateScrollBars                  private *
+*-------------------------------------------------------------------*
+* Both scroll bars count cells (lines, columns), not pixels.        *
+* The longest line is not recomputed when lines get shorter, the    *
+* range may be a bit too long then, which is harmless.              *
+********************************************************************/
+void LongLineEditor::updateScrollBars() {
+    const int lines = visibleLines();
+    const int columns = visibleColumns();
+    verticalScrollBar()->setRange(0, qMax(0, int(_lines.size()) - lines));
+    verticalScrollBar()->setPageStep(lines);
+    horizontalScrollBar()->setRange(0, qMax(0, _longest - columns + 1));
+    horizontalScrollBar()->setPageStep(columns);
+}
+
+/********************************************************************
+*                           ensureVisible                   private *
+********************************************************************/
+void LongLineEditor::ensureVisible() {
+    QScrollBar* const vbar = verticalScrollBar();
+    if (_line < vbar->value()) {
+        vbar->setValue(_line);
+    } else if (_line >= vbar->value() + visibleLines()) {
+        vbar->setValue(_line - visibleLines() + 1);
+    }
+
+    QScrollBar* const hbar = horizontalScrollBar();
+    const int columns = visibleColumns();
+    if (_column < hbar->value()) {
+        hbar->setValue(qMax(0, _column - columns / 4));
+    } else if (_column >= hbar->value() + columns) {
+        hbar->setValue(_column - columns * 3 / 4);
+    }
+}
+
+/********************************************************************
+*                    visibleLines/visibleColumns            private *
+********************************************************************/
+int LongLineEditor::visibleLines() const {
+    return qMax(1, viewport()->height() / _lineHeight);
+}
+
+int LongLineEditor::visibleColumns() const {
+    return qMax(1, viewport()->width() / _charWidth);
+}
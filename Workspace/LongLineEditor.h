@@ -0,0 +1,104 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : LongLineEditor.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_LONG_LINE_EDITOR_H
+#define GOEDIT_LONG_LINE_EDITOR_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QAbstractScrollArea>
+#include <vector>
+#include "Workspace/Buffer.h"
+#include "Workspace/TextFile.h"
+
+/********************************************************************
+*                          LongLineEditor                           *
+*-------------------------------------------------------------------*
+* Safe mode for files with pathologically long lines (minified or   *
+* generated code, embedded assets). There is no text layout: every  *
+* UTF-16 code unit is one cell of a monospaced grid (a tab too), so *
+* the column of a point is a division and only the visible window   *
+* of a line is ever tokenized and drawn. Costly features (minimap,  *
+* completion, language server) are not available here.              *
+********************************************************************/
+class LongLineEditor : public QAbstractScrollArea, public Buffer {
+    Q_OBJECT
+
+    static constexpr int Lookbehind = 256;      // columns lexed before the window
+    static constexpr int WordLimit = 256;
+
+    std::vector<QString> _lines;
+    TextFile::Format _format;
+    int _longest;
+    int _line;
+    int _column;
+    bool _modified;
+    int _charWidth;
+    int _lineHeight;
+public:
+    static constexpr int MaxLineLength = 10000;
+
+    explicit LongLineEditor(QWidget* = nullptr);
+
+    static bool detect(const QString&);
+
+    QWidget* widget() override {
+        return this;
+    }
+    bool load(const QString&) override;
+    bool saveAs(const QString&) override;
+    bool isModified() const override {
+        return _modified;
+    }
+    void gotoPosition(const int, const int) override;
+    QString wordUnderCursor() const override;
+    int cursorLine() const override {
+        return _line;
+    }
+    QString text() const override;
+
+signals:
+    void modificationChanged(bool);
+
+protected:
+    void paintEvent(QPaintEvent*) override;
+    void keyPressEvent(QKeyEvent*) override;
+    void mousePressEvent(QMouseEvent*) override;
+    void resizeEvent(QResizeEvent*) override;
+    void scrollContentsBy(int, int) override;
+
+private:
+    void drawLine(QPainter&, const int, const int, const int, const int) const;
+    void moveTo(const int, const int);
+    void insert(const QString&);
+    void removeBackward();
+    void removeForward();
+    void setModified(const bool);
+    void updateScrollBars();
+    void ensureVisible();
+    int visibleLines() const;
+    int visibleColumns() const;
+};
+
+#endif // GOEDIT_LONG_LINE_EDITOR_H
@@ -0,0 +1,369 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Minimap.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QPlainTextEdit>
+#include <QTextDocument>
+#include <QTextBlock>
+#include <QScrollBar>
+#include <QPainter>
+#include <QMouseEvent>
+#include <QtConcurrent>
+#include <climits>
+#include "Minimap.h"
+#include "Shared/Trace.h"
+
+//*******************************************************************
+//                              Minimap                         CTOR
+//*******************************************************************
+Minimap::Minimap(QPlainTextEdit* editor)
+    : QWidget(editor)
+    , _editor(editor)
+    , _dirtyFirst(-1)
+    , _dirtyLast(-1)
+    , _jobFirst(0)
+    , _jobLast(0)
+    , _busy(false)
+    , _generation(0)
+{
+    // One thread: jobs are summarized in the order they were made.
+    _pool.setMaxThreadCount(1);
+    setCursor(Qt::PointingHandCursor);
+
+    QTextDocument* const doc = _editor->document();
+    _lines.resize(size_t(doc->blockCount()));
+    _states.assign(size_t(doc->blockCount()), Unknown);
+    markDirty(0, doc->blockCount() - 1);
+    schedule();
+
+    connect(doc, &QTextDocument::contentsChange, this, &Minimap::contentsChange);
+    connect(_editor->verticalScrollBar(), &QScrollBar::valueChanged, this, QOverload<>::of(&QWidget::update));
+    connect(_editor->verticalScrollBar(), &QScrollBar::rangeChanged, this, QOverload<>::of(&QWidget::update));
+}
+
+/********************************************************************
+*                             ~Minimap                         dtor *
+********************************************************************/
+Minimap::~Minimap() {
+    _pool.clear();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                            paintEvent                   protected *
+*-------------------------------------------------------------------*
+* Draws cached tiles, only the missing ones are rendered.           *
+********************************************************************/
+void Minimap::paintEvent(QPaintEvent*) {
+    TraceScope trace("paint", "minimap");
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().color(QPalette::Base).darker(106));
+
+    const int total = int(_lines.size()) * LinePx;
+    if (total == 0) {
+        return;
+    }
+    const int top = offset();
+    const int firstTile = top / TilePx;
+    const int lastTile = qMin((top + height()) / TilePx, (total - 1) / TilePx);
+    for (int tile = firstTile; tile <= lastTile; tile++) {
+        auto it = _tiles.find(tile);
+        if (it == _tiles.end()) {
+            it = _tiles.insert(tile, renderTile(tile));
+        }
+        painter.drawImage((Width - MinimapSummary::Columns) / 2, tile * TilePx - top, it.value());
+    }
+
+    // Tiles far from the view are dropped.
+    if (_tiles.size() > MaxTiles) {
+        for (auto it = _tiles.begin(); it != _tiles.end();) {
+            if (it.key() < firstTile - MaxTiles / 4 || it.key() > lastTile + MaxTiles / 4) {
+                it = _tiles.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    const QScrollBar* const bar = _editor->verticalScrollBar();
+    const QRect view(0, bar->value() * LinePx - top, width(), qMax(LinePx, bar->pageStep() * LinePx));
+    painter.fillRect(view, QColor(128, 128, 128, 48));
+}
+
+/********************************************************************
+*                     mousePressEvent/mouseMoveEvent      protected *
+********************************************************************/
+void Minimap::mousePressEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton) {
+        scrollTo(event->pos().y());
+    }
+}
+
+void Minimap::mouseMoveEvent(QMouseEvent* event) {
+    if (event->buttons() & Qt::LeftButton) {
+        scrollTo(event->pos().y());
+    }
+}
+
+/********************************************************************
+*                          contentsChange                   private *
+*-------------------------------------------------------------------*
+* Summaries are kept in step with the lines of the document: lines  *
+* added or removed by the edit are added or removed here too, and   *
+* the lines of the edit are summarized again. Tiles below the edit  *
+* are invalidated only when the number of lines changed.            *
+********************************************************************/
+void Minimap::contentsChange(const int position, const int, const int added) {
+    QTextDocument* const doc = _editor->document();
+    const int count = doc->blockCount();
+    const int first = doc->findBlock(position).blockNumber();
+    if (first < 0) {
+        return;
+    }
+    const int last = qMax(first, doc->findBlock(position + added).blockNumber());
+    const int delta = count - int(_lines.size());
+    ++_generation;
+
+    if (delta > 0) {
+        _lines.insert(_lines.begin() + first + 1, size_t(delta), {});
+        _states.insert(_states.begin() + first + 1, size_t(delta), Unknown);
+    } else if (delta < 0) {
+        const int n = qMin(-delta, int(_lines.size()) - first - 1);
+        _lines.erase(_lines.begin() + first + 1, _lines.begin() + first + 1 + n);
+        _states.erase(_states.begin() + first + 1, _states.begin() + first + 1 + n);
+    }
+    if (int(_lines.size()) != count) {
+        _lines.resize(size_t(count));
+        _states.resize(size_t(count), Unknown);
+    }
+
+    // Ranges waiting or in progress move with their lines.
+    auto shift = [first, delta](int& line) {
+        if (line > first) {
+            line = qMax(first, line + delta);
+        }
+    };
+    if (_dirtyFirst >= 0) {
+        shift(_dirtyFirst);
+        shift(_dirtyLast);
+    }
+    if (_busy) {
+        shift(_jobFirst);
+        shift(_jobLast);
+    }
+
+    markDirty(first, last);
+    invalidate(first, delta != 0 ? INT_MAX : last);
+    schedule();
+    update();
+}
+
+/********************************************************************
+*                             markDirty                     private *
+********************************************************************/
+void Minimap::markDirty(const int first, const int last) {
+    const int lo = qMax(0, first);
+    const int hi = qMin(last, int(_lines.size()) - 1);
+    if (lo > hi) {
+        return;
+    }
+    if (_dirtyFirst < 0) {
+        _dirtyFirst = lo;
+        _dirtyLast = hi;
+    } else {
+        _dirtyFirst = qMin(_dirtyFirst, lo);
+        _dirtyLast = qMax(_dirtyLast, hi);
+    }
+}
+
+/********************************************************************
+*                             schedule                      private *
+*-------------------------------------------------------------------*
+* Sends the first chunk of dirty lines to the worker. Only the text *
+* of these lines is copied. One job at a time.                      *
+********************************************************************/
+void Minimap::schedule() {
+    if (_busy || _dirtyFirst < 0) {
+        return;
+    }
+    const int first = _dirtyFirst;
+    const int last = qMin(_dirtyLast, first + ChunkLines - 1);
+    if (last < _dirtyLast) {
+        _dirtyFirst = last + 1;
+    } else {
+        _dirtyFirst = _dirtyLast = -1;
+    }
+
+    QStringList lines;
+    lines.reserve(last - first + 1);
+    QTextBlock block = _editor->document()->findBlockByNumber(first);
+    for (int i = first; i <= last && block.isValid(); i++, block = block.next()) {
+        lines.append(block.text());
+    }
+    const uint8_t previous = (first > 0) ? _states[size_t(first - 1)] : 0;
+    const uint8_t state = (previous == Unknown) ? 0 : previous;
+
+    _busy = true;
+    _jobFirst = first;
+    _jobLast = last;
+    const quint32 generation = _generation;
+    QtConcurrent::run(&_pool, [this, generation, first, lines, state] {
+        const Result result = summarize(generation, first, lines, state);
+        QMetaObject::invokeMethod(this, [this, result] {
+            apply(result);
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               apply                       private *
+*-------------------------------------------------------------------*
+* Result made before the last edit is dropped and its lines are     *
+* summarized again. When the lexer state at the end of the chunk    *
+* changed, the following lines are summarized too.                  *
+********************************************************************/
+void Minimap::apply(const Result& result) {
+    _busy = false;
+    if (result.generation != _generation) {
+        markDirty(_jobFirst, _jobLast);
+        schedule();
+        return;
+    }
+
+    const int first = result.first;
+    const int n = qMin(int(result.lines.size()), int(_lines.size()) - first);
+    if (n > 0) {
+        const int last = first + n - 1;
+        const uint8_t previous = _states[size_t(last)];
+        for (int i = 0; i < n; i++) {
+            _lines[size_t(first + i)] = result.lines[size_t(i)];
+            _states[size_t(first + i)] = result.states[size_t(i)];
+        }
+        if (_states[size_t(last)] != previous) {
+            markDirty(last + 1, last + ChunkLines);
+        }
+        invalidate(first, last);
+        update();
+    }
+    schedule();
+}
+
+/********************************************************************
+*                            invalidate                     private *
+*-------------------------------------------------------------------*
+* Drops tiles showing any of the lines.                             *
+********************************************************************/
+void Minimap::invalidate(const int first, const int last) {
+    const int firstTile = first / TileLines;
+    const int lastTile = (last == INT_MAX) ? INT_MAX : last / TileLines;
+    for (auto it = _tiles.begin(); it != _tiles.end();) {
+        if (it.key() >= firstTile && it.key() <= lastTile) {
+            it = _tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/********************************************************************
+*                            renderTile                     private *
+*-------------------------------------------------------------------*
+* Every line is one row of pixels followed by an empty one.         *
+********************************************************************/
+QImage Minimap::renderTile(const int tile) const {
+    QImage image(MinimapSummary::Columns, TilePx, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QColor text = palette().color(QPalette::Text);
+    text.setAlpha(150);
+    const QRgb colors[MinimapSummary::KindCount] = {
+        qPremultiply(text.rgba()),
+        qPremultiply(qRgba(0x3b, 0x7d, 0xd8, 220)),
+        qPremultiply(qRgba(0xc0, 0x6a, 0x2b, 220)),
+        qPremultiply(qRgba(0x6a, 0x99, 0x55, 180))
+    };
+
+    const int first = tile * TileLines;
+    const int last = qMin(first + TileLines, int(_lines.size()));
+    for (int line = first; line < last; line++) {
+        auto const row = reinterpret_cast<QRgb*>(image.scanLine((line - first) * LinePx));
+        for (const auto& span : _lines[size_t(line)]) {
+            const QRgb color = colors[span.kind];
+            const int end = qMin(span.column + span.length, MinimapSummary::Columns);
+            for (int x = span.column; x < end; x++) {
+                row[x] = color;
+            }
+        }
+    }
+    return image;
+}
+
+/********************************************************************
+*                              offset                       private *
+*-------------------------------------------------------------------*
+* Pixel of the map shown at the top of the widget. When the map is  *
+* higher than the widget it moves proportionally to the editor.     *
+* Editor lines are not wrapped, so the scroll bar counts lines.     *
+********************************************************************/
+int Minimap::offset() const {
+    const int total = int(_lines.size()) * LinePx;
+    const QScrollBar* const bar = _editor->verticalScrollBar();
+    if (total <= height() || bar->maximum() <= 0) {
+        return 0;
+    }
+    return int(qint64(total - height()) * bar->value() / bar->maximum());
+}
+
+/********************************************************************
+*                             scrollTo                      private *
+*-------------------------------------------------------------------*
+* Centers the editor on the line at 'y'.                            *
+********************************************************************/
+void Minimap::scrollTo(const int y) {
+    QScrollBar* const bar = _editor->verticalScrollBar();
+    const int line = (y + offset()) / LinePx;
+    bar->setValue(line - bar->pageStep() / 2);
+}
+
+/********************************************************************
+*                             summarize              private static *
+*-------------------------------------------------------------------*
+* Runs in the worker thread.                                        *
+********************************************************************/
+Minimap::Result Minimap::summarize(const quint32 generation, const int first, const QStringList& lines, const uint8_t state) {
+    TraceScope trace("summarize", "minimap");
+    Result result{generation, first, {}, {}};
+    result.lines.resize(size_t(lines.size()));
+    result.states.resize(size_t(lines.size()));
+
+    uint8_t current = state;
+    for (int i = 0; i < lines.size(); i++) {
+        const QString& line = lines[i];
+        current = MinimapSummary::line(reinterpret_cast<const char16_t*>(line.utf16()), line.size(), current, result.lines[size_t(i)]);
+        result.states[size_t(i)] = current;
+    }
+    return result;
+}
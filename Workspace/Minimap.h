@@ -0,0 +1,103 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Minimap.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_MINIMAP_H
+#define GOEDIT_MINIMAP_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QWidget>
+#include <QHash>
+#include <QImage>
+#include <QStringList>
+#include <QThreadPool>
+#include <vector>
+#include "Workspace/MinimapSummary.h"
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QPlainTextEdit;
+
+/********************************************************************
+*                              Minimap                              *
+*-------------------------------------------------------------------*
+* Overview of the whole document beside the editor. Every line has  *
+* a summary (see MinimapSummary) computed in a background thread,   *
+* only for lines changed by an edit (and the following ones while   *
+* their lexer state changes). The picture is painted in tiles of    *
+* TileLines lines, kept until lines they show change, so scrolling  *
+* only draws the cached images and never reads the document.        *
+********************************************************************/
+class Minimap : public QWidget {
+    Q_OBJECT
+public:
+    static constexpr int Width = MinimapSummary::Columns + 8;
+private:
+    static constexpr int LinePx = 2;
+    static constexpr int TileLines = 128;
+    static constexpr int TilePx = TileLines * LinePx;
+    static constexpr int ChunkLines = 2048;    // lines summarized by one job
+    static constexpr int MaxTiles = 64;
+    static constexpr uint8_t Unknown = 0xff;
+
+    struct Result {
+        quint32 generation;
+        int first;
+        std::vector<std::vector<MinimapSummary::Span>> lines;
+        std::vector<uint8_t> states;
+    };
+
+    QPlainTextEdit* const _editor;
+    std::vector<std::vector<MinimapSummary::Span>> _lines;
+    std::vector<uint8_t> _states;       // lexer state at the end of line
+    QHash<int, QImage> _tiles;
+    int _dirtyFirst;
+    int _dirtyLast;
+    int _jobFirst;
+    int _jobLast;
+    bool _busy;
+    quint32 _generation;
+    QThreadPool _pool;
+public:
+    explicit Minimap(QPlainTextEdit*);
+    ~Minimap() override;
+
+protected:
+    void paintEvent(QPaintEvent*) override;
+    void mousePressEvent(QMouseEvent*) override;
+    void mouseMoveEvent(QMouseEvent*) override;
+
+private:
+    void contentsChange(const int, const int, const int);
+    void markDirty(const int, const int);
+    void schedule();
+    void apply(const Result&);
+    void invalidate(const int, const int);
+    QImage renderTile(const int) const;
+    int offset() const;
+    void scrollTo(const int);
+    static Result summarize(const quint32, const int, const QStringList&, const uint8_t);
+};
+
+#endif // GOEDIT_MINIMAP_H
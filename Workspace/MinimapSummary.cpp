@@ -0,0 +1,109 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : MinimapSummary.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include "MinimapSummary.h"
+#include "Go/GoLexer.h"
+
+/********************************************************************
+*                               line                  public static *
+*-------------------------------------------------------------------*
+* Summary of the line 'text' (without the line separator). 'state'  *
+* is the GoLexer state at the start of the line. Returns the state  *
+* at its end.                                                       *
+********************************************************************/
+uint8_t MinimapSummary::line(const char16_t* text, const int size, const uint8_t state, std::vector<Span>& spans) {
+    using Lexer = GoLexer<char16_t>;
+    spans.clear();
+
+    Lexer lexer(text, size, Lexer::State(state));
+    int column = 0;         // visual column of the position 'done'
+    int done = 0;           // code units already summarized
+    for (;;) {
+        const GoToken token = lexer.next();
+        if (token.kind == GoToken::End) {
+            break;
+        }
+        if (token.length == 0) {
+            continue;
+        }
+        uint8_t kind = Text;
+        switch (token.kind) {
+        case GoToken::Keyword:
+            kind = Keyword;
+            break;
+        case GoToken::Number:
+        case GoToken::String:
+        case GoToken::RawString:
+        case GoToken::Rune:
+            kind = Literal;
+            break;
+        case GoToken::Comment:
+            kind = Comment;
+            break;
+        default:
+            break;
+        }
+        add(text, done, token.begin, Text, column, spans);
+        add(text, token.begin, token.begin + token.length, kind, column, spans);
+        done = token.begin + token.length;
+        if (column >= Columns) {
+            break;
+        }
+    }
+    return lexer.state();
+}
+
+/********************************************************************
+*                                add                 private static *
+*-------------------------------------------------------------------*
+* Adds runs of non-blank characters from [begin, end) of the text,  *
+* advancing the visual 'column'. Runs of the same kind touching     *
+* each other are merged.                                            *
+********************************************************************/
+void MinimapSummary::add(const char16_t* text, const int begin, const int end, const uint8_t kind, int& column, std::vector<Span>& spans) {
+    for (int i = begin; i < end && column < Columns; i++) {
+        const char16_t c = text[i];
+        if (c == u'\t') {
+            column += TabWidth - column % TabWidth;
+            continue;
+        }
+        if (c == u' ') {
+            ++column;
+            continue;
+        }
+        if (!spans.empty()) {
+            Span& last = spans.back();
+            if (last.kind == kind && last.column + last.length == column) {
+                ++last.length;
+                ++column;
+                continue;
+            }
+        }
+        spans.push_back({uint8_t(column), 1, kind});
+        ++column;
+    }
+}
@@ -0,0 +1,70 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : MinimapSummary.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_MINIMAP_SUMMARY_H
+#define GOEDIT_MINIMAP_SUMMARY_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <cstdint>
+#include <vector>
+
+/********************************************************************
+*                          MinimapSummary                           *
+*-------------------------------------------------------------------*
+* Downsampled picture of one line for the minimap: runs of visible  *
+* characters (columns with tabs expanded) with the class of their   *
+* token. The line is tokenized by GoLexer starting in the state the *
+* previous line ended in; the end state is returned, so a change of *
+* it tells the caller the next line must be summarized again.       *
+********************************************************************/
+class MinimapSummary {
+public:
+    static constexpr int Columns = 100;
+    static constexpr int TabWidth = 4;
+
+    enum Kind : uint8_t {
+        Text = 0,
+        Keyword,
+        Literal,
+        Comment,
+        KindCount
+    };
+    struct Span {
+        uint8_t column;
+        uint8_t length;
+        uint8_t kind;
+    };
+
+    MinimapSummary() = delete;
+    ~MinimapSummary() = delete;
+    MinimapSummary(const MinimapSummary&) = delete;
+    MinimapSummary(const MinimapSummary&&) = delete;
+
+    static uint8_t line(const char16_t*, const int, const uint8_t, std::vector<Span>&);
+private:
+    static void add(const char16_t*, const int, const int, const uint8_t, int&, std::vector<Span>&);
+};
+
+#endif // GOEDIT_MINIMAP_SUMMARY_H
@@ -0,0 +1,413 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : MultiCursor.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QPlainTextEdit>
+#include <QTextDocument>
+#include <QTextBlock>
+#include <QKeyEvent>
+#include <QClipboard>
+#include <QGuiApplication>
+#include <algorithm>
+#include "MultiCursor.h"
+#include "Shared/Trace.h"
+
+//*******************************************************************
+//                            MultiCursor                       CTOR
+//*******************************************************************
+MultiCursor::MultiCursor(QPlainTextEdit* editor)
+    : _editor(editor)
+{}
+
+/********************************************************************
+*                                add                         public *
+*-------------------------------------------------------------------*
+* Adds the cursor unless it overlaps one of the cursors already in. *
+********************************************************************/
+void MultiCursor::add(const QTextCursor& cursor) {
+    if (overlap(cursor, _editor->textCursor())) {
+        return;
+    }
+    for (const auto& other : _cursors) {
+        if (overlap(cursor, other)) {
+            return;
+        }
+    }
+    _cursors.append(cursor);
+    normalize();
+}
+
+/********************************************************************
+*                            addVertical                     public *
+*-------------------------------------------------------------------*
+* New cursor on the (visible) line above the topmost cursor, when   *
+* 'direction' < 0, or below the bottommost one, in the column of    *
+* the editor's cursor.                                              *
+********************************************************************/
+bool MultiCursor::addVertical(const int direction) {
+    const QList<QTextCursor> all = sorted();
+    QTextBlock block = (direction < 0) ? all.first().block() : all.last().block();
+    do {
+        block = (direction < 0) ? block.previous() : block.next();
+    } while (block.isValid() && !block.isVisible());
+    if (!block.isValid()) {
+        return false;
+    }
+    const int column = _editor->textCursor().positionInBlock();
+    QTextCursor cursor(block);
+    cursor.setPosition(block.position() + qMin(column, block.length() - 1));
+    add(cursor);
+    return true;
+}
+
+/********************************************************************
+*                         addNextOccurrence                  public *
+*-------------------------------------------------------------------*
+* Without a selection the word under the cursor is selected first.  *
+* Then every call adds a cursor selecting the next occurrence of    *
+* the selected text, after the last cursor and wrapping around.     *
+********************************************************************/
+bool MultiCursor::addNextOccurrence() {
+    QTextCursor primary = _editor->textCursor();
+    if (!primary.hasSelection()) {
+        primary.select(QTextCursor::WordUnderCursor);
+        if (!primary.hasSelection()) {
+            return false;
+        }
+        _editor->setTextCursor(primary);
+        return true;
+    }
+    const QString text = primary.selectedText();
+    if (text.contains(QChar::ParagraphSeparator)) {
+        return false;
+    }
+
+    const QList<QTextCursor> all = sorted();
+    QTextDocument* const doc = _editor->document();
+    QTextCursor found = doc->find(text, all.last().selectionEnd(), QTextDocument::FindCaseSensitively);
+    if (found.isNull()) {
+        found = doc->find(text, 0, QTextDocument::FindCaseSensitively);
+    }
+    if (found.isNull()) {
+        return false;
+    }
+    const int count = _cursors.size();
+    add(found);
+    return _cursors.size() > count;
+}
+
+/********************************************************************
+*                       selectAllOccurrences                 public *
+*-------------------------------------------------------------------*
+* A cursor on every occurrence of the selected text (or of the word *
+* under the cursor, as a whole word). Returns number of cursors.    *
+********************************************************************/
+int MultiCursor::selectAllOccurrences() {
+    TraceScope trace("selectAllOccurrences", "editor");
+    QTextCursor primary = _editor->textCursor();
+    QTextDocument::FindFlags flags = QTextDocument::FindCaseSensitively;
+    if (!primary.hasSelection()) {
+        primary.select(QTextCursor::WordUnderCursor);
+        flags |= QTextDocument::FindWholeWords;
+    }
+    const QString text = primary.selectedText();
+    if (text.isEmpty() || text.contains(QChar::ParagraphSeparator)) {
+        return 0;
+    }
+
+    QTextDocument* const doc = _editor->document();
+    _cursors.clear();
+    for (QTextCursor found = doc->find(text, 0, flags); !found.isNull(); found = doc->find(text, found, flags)) {
+        if (found.selectionStart() != primary.selectionStart()) {
+            _cursors.append(found);
+        }
+    }
+    _editor->setTextCursor(primary);
+    return _cursors.size() + 1;
+}
+
+/********************************************************************
+*                           selectColumns                    public *
+*-------------------------------------------------------------------*
+* Column selection: a cursor on every visible line between the      *
+* lines 'anchorLine' and 'line', selecting the columns between      *
+* 'anchorColumn' and 'column'.                                      *
+* Lines too short to reach the columns are skipped. Columns are in  *
+* characters, a tab counts as one.                                  *
+********************************************************************/
+void MultiCursor::selectColumns(const int anchorLine, const int anchorColumn, const int line, const int column) {
+    QTextDocument* const doc = _editor->document();
+    QTextBlock block = doc->findBlockByNumber(anchorLine);
+    const bool down = line >= anchorLine;
+    _cursors.clear();
+
+    QTextCursor primary;
+    for (; block.isValid(); block = down ? block.next() : block.previous()) {
+        const int length = block.length() - 1;
+        if (block.isVisible() && (anchorColumn == column || length >= qMin(anchorColumn, column))) {
+            QTextCursor cursor(block);
+            cursor.setPosition(block.position() + qMin(anchorColumn, length));
+            cursor.setPosition(block.position() + qMin(column, length), QTextCursor::KeepAnchor);
+            if (block.blockNumber() == line) {
+                primary = cursor;
+            } else {
+                _cursors.append(cursor);
+            }
+        }
+        if (block.blockNumber() == line) {
+            break;
+        }
+    }
+    if (primary.isNull()) {
+        if (_cursors.isEmpty()) {
+            return;
+        }
+        primary = down ? _cursors.takeLast() : _cursors.takeFirst();
+    }
+    _editor->setTextCursor(primary);
+    normalize();
+}
+
+/********************************************************************
+*                              keyPress                      public *
+*-------------------------------------------------------------------*
+* Applies the key to all cursors. Returns false for keys it does    *
+* not handle, the editor then goes back to a single cursor.         *
+********************************************************************/
+bool MultiCursor::keyPress(QKeyEvent* event) {
+    const bool ctrl = event->modifiers() & Qt::ControlModifier;
+    const auto mode = (event->modifiers() & Qt::ShiftModifier) ? QTextCursor::KeepAnchor : QTextCursor::MoveAnchor;
+
+    if (event->matches(QKeySequence::Copy)) {
+        QGuiApplication::clipboard()->setText(selectedText());
+        return true;
+    }
+    if (event->matches(QKeySequence::Cut)) {
+        QGuiApplication::clipboard()->setText(selectedText());
+        remove(QTextCursor::NoMove);
+        return true;
+    }
+    if (event->matches(QKeySequence::Paste)) {
+        // Lines of the clipboard are shared out when there is one per cursor.
+        const QString text = QGuiApplication::clipboard()->text();
+        const QStringList lines = text.split('\n');
+        insert(lines.size() == _cursors.size() + 1 ? lines : QStringList{text});
+        return true;
+    }
+
+    switch (event->key()) {
+    case Qt::Key_Left:
+        move(ctrl ? QTextCursor::PreviousWord : QTextCursor::Left, mode);
+        return true;
+    case Qt::Key_Right:
+        move(ctrl ? QTextCursor::NextWord : QTextCursor::Right, mode);
+        return true;
+    case Qt::Key_Up:
+        move(QTextCursor::Up, mode);
+        return true;
+    case Qt::Key_Down:
+        move(QTextCursor::Down, mode);
+        return true;
+    case Qt::Key_Home:
+        move(QTextCursor::StartOfLine, mode);
+        return true;
+    case Qt::Key_End:
+        move(QTextCursor::EndOfLine, mode);
+        return true;
+    case Qt::Key_Backspace:
+        remove(ctrl ? QTextCursor::PreviousWord : QTextCursor::PreviousCharacter);
+        return true;
+    case Qt::Key_Delete:
+        remove(ctrl ? QTextCursor::NextWord : QTextCursor::NextCharacter);
+        return true;
+    case Qt::Key_Return:
+    case Qt::Key_Enter:
+        insert({"\n"});
+        return true;
+    }
+    const QString text = event->text();
+    if (!text.isEmpty() && !ctrl && (text[0].isPrint() || text[0] == '\t')) {
+        insert({text});
+        return true;
+    }
+    return false;
+}
+
+/********************************************************************
+*                            selections                      public *
+*-------------------------------------------------------------------*
+* Selections of the cursors for QPlainTextEdit::setExtraSelections. *
+********************************************************************/
+QList<QTextEdit::ExtraSelection> MultiCursor::selections() const {
+    QList<QTextEdit::ExtraSelection> result;
+    const QPalette& palette = _editor->palette();
+    for (const auto& cursor : _cursors) {
+        if (cursor.hasSelection()) {
+            QTextEdit::ExtraSelection selection;
+            selection.format.setBackground(palette.color(QPalette::Highlight));
+            selection.format.setForeground(palette.color(QPalette::HighlightedText));
+            selection.cursor = cursor;
+            result.append(selection);
+        }
+    }
+    return result;
+}
+
+/********************************************************************
+*                              insert                       private *
+*-------------------------------------------------------------------*
+* 'parts' holds a text for every cursor (in document order) or one  *
+* text for all of them.                                             *
+********************************************************************/
+void MultiCursor::insert(const QStringList& parts) {
+    const bool shared = parts.size() == 1;
+    edit([&parts, shared](QTextCursor& cursor, const int idx) {
+        cursor.insertText(shared ? parts.first() : parts[idx]);
+    });
+}
+
+/********************************************************************
+*                              remove                       private *
+*-------------------------------------------------------------------*
+* Removes the selected text, or what 'operation' moves the cursor   *
+* over when nothing is selected.                                    *
+********************************************************************/
+void MultiCursor::remove(const QTextCursor::MoveOperation operation) {
+    edit([operation](QTextCursor& cursor, const int) {
+        if (!cursor.hasSelection()) {
+            cursor.movePosition(operation, QTextCursor::KeepAnchor);
+        }
+        cursor.removeSelectedText();
+    });
+}
+
+/********************************************************************
+*                               move                        private *
+********************************************************************/
+void MultiCursor::move(const QTextCursor::MoveOperation operation, const QTextCursor::MoveMode mode) {
+    QTextCursor primary = _editor->textCursor();
+    primary.movePosition(operation, mode);
+    _editor->setTextCursor(primary);
+    for (auto& cursor : _cursors) {
+        cursor.movePosition(operation, mode);
+    }
+    normalize();
+}
+
+/********************************************************************
+*                           selectedText                    private *
+*-------------------------------------------------------------------*
+* Texts selected by all cursors, in document order, one per line.   *
+********************************************************************/
+QString MultiCursor::selectedText() const {
+    QStringList parts;
+    for (const auto& cursor : sorted()) {
+        if (cursor.hasSelection()) {
+            parts.append(cursor.selectedText().replace(QChar::ParagraphSeparator, '\n'));
+        }
+    }
+    return parts.join('\n');
+}
+
+/********************************************************************
+*                              sorted                       private *
+*-------------------------------------------------------------------*
+* All cursors, the editor's one included, in document order.        *
+********************************************************************/
+QList<QTextCursor> MultiCursor::sorted() const {
+    QList<QTextCursor> all = _cursors;
+    all.append(_editor->textCursor());
+    std::sort(all.begin(), all.end(), [](const QTextCursor& a, const QTextCursor& b) {
+        return a.selectionStart() < b.selectionStart();
+    });
+    return all;
+}
+
+/********************************************************************
+*                               edit                        private *
+*-------------------------------------------------------------------*
+* Runs 'change' for every cursor inside one edit block. Document    *
+* positions of cursors follow changes made by the others, so the    *
+* order does not matter for them; 'change' gets the index of the    *
+* cursor in document order.                                         *
+********************************************************************/
+void MultiCursor::edit(const std::function<void(QTextCursor&, const int)>& change) {
+    TraceScope trace("multiCursorEdit", "editor");
+    QList<QTextCursor> all = sorted();
+    const QTextCursor current = _editor->textCursor();
+    int primary = 0;
+    for (int i = 0; i < all.size(); i++) {
+        if (all[i] == current) {
+            primary = i;
+            break;
+        }
+    }
+
+    QTextCursor batch(_editor->document());
+    batch.beginEditBlock();
+    for (int i = 0; i < all.size(); i++) {
+        change(all[i], i);
+    }
+    batch.endEditBlock();
+
+    _editor->setTextCursor(all.takeAt(primary));
+    _cursors = all;
+    normalize();
+}
+
+/********************************************************************
+*                             normalize                     private *
+*-------------------------------------------------------------------*
+* Keeps cursors sorted and drops the ones that ran into another.    *
+********************************************************************/
+void MultiCursor::normalize() {
+    std::sort(_cursors.begin(), _cursors.end(), [](const QTextCursor& a, const QTextCursor& b) {
+        return a.selectionStart() < b.selectionStart();
+    });
+    const QTextCursor primary = _editor->textCursor();
+    QList<QTextCursor> kept;
+    kept.reserve(_cursors.size());
+    for (const auto& cursor : _cursors) {
+        if (cursor.isNull() || overlap(cursor, primary)) {
+            continue;
+        }
+        if (!kept.isEmpty() && overlap(kept.last(), cursor)) {
+            continue;
+        }
+        kept.append(cursor);
+    }
+    _cursors = kept;
+}
+
+/********************************************************************
+*                              overlap               private static *
+********************************************************************/
+bool MultiCursor::overlap(const QTextCursor& a, const QTextCursor& b) {
+    if (a.selectionStart() == b.selectionStart() && a.selectionEnd() == b.selectionEnd()) {
+        return true;
+    }
+    return a.selectionStart() < b.selectionEnd() && b.selectionStart() < a.selectionEnd();
+}
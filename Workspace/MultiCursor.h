@@ -0,0 +1,86 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : MultiCursor.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_MULTI_CURSOR_H
+#define GOEDIT_MULTI_CURSOR_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QList>
+#include <QStringList>
+#include <QTextCursor>
+#include <QTextEdit>
+#include <functional>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QPlainTextEdit;
+class QKeyEvent;
+
+/********************************************************************
+*                            MultiCursor                            *
+*-------------------------------------------------------------------*
+* Cursors of the editor besides its own one. Keys typed while there *
+* are any go to all cursors. Every edit is made in one edit block   *
+* of the document: the editor gets a single change notification     *
+* (one layout and bracket pass over the range of the edit) and the  *
+* undo stack a single entry, however many cursors took part.        *
+********************************************************************/
+class MultiCursor {
+    QPlainTextEdit* const _editor;
+    QList<QTextCursor> _cursors;
+public:
+    explicit MultiCursor(QPlainTextEdit*);
+    MultiCursor(const MultiCursor&) = delete;
+    MultiCursor& operator=(const MultiCursor&) = delete;
+
+    bool isEmpty() const {
+        return _cursors.isEmpty();
+    }
+    const QList<QTextCursor>& cursors() const {
+        return _cursors;
+    }
+    void clear() {
+        _cursors.clear();
+    }
+    void add(const QTextCursor&);
+    bool addVertical(const int);
+    bool addNextOccurrence();
+    int selectAllOccurrences();
+    void selectColumns(const int, const int, const int, const int);
+    bool keyPress(QKeyEvent*);
+    QList<QTextEdit::ExtraSelection> selections() const;
+
+private:
+    void insert(const QStringList&);
+    void remove(const QTextCursor::MoveOperation);
+    void move(const QTextCursor::MoveOperation, const QTextCursor::MoveMode);
+    QString selectedText() const;
+    QList<QTextCursor> sorted() const;
+    void edit(const std::function<void(QTextCursor&, const int)>&);
+    void normalize();
+    static bool overlap(const QTextCursor&, const QTextCursor&);
+};
+
+#endif // GOEDIT_MULTI_CURSOR_H
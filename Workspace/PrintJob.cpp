@@ -0,0 +1,293 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : PrintJob.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QPainter>
+#include <QPrinter>
+#include <QPagedPaintDevice>
+#include <QFontMetricsF>
+#include <QFile>
+#include <QtConcurrent>
+#include <QDebug>
+#include "PrintJob.h"
+#include "Go/GoLexer.h"
+
+/*------- local constants:
+-------------------------------------------------------------------*/
+static constexpr int ProgressLines = 2000;   // progress reported every that many lines
+static constexpr int HeaderRows = 2;         // title and a gap
+
+/*------- local types:
+-------------------------------------------------------------------*/
+namespace {
+    enum Kind : uint8_t {
+        Text,
+        Keyword,
+        Literal,
+        Comment,
+        Margin              // line numbers and the header
+    };
+}
+
+/*------- local functions:
+-------------------------------------------------------------------*/
+
+// Colors for paper, the same hues as in the editor.
+static QColor color(const uint8_t kind) {
+    switch (kind) {
+    case Keyword: return QColor(0x3b, 0x7d, 0xd8);
+    case Literal: return QColor(0xc0, 0x6a, 0x2b);
+    case Comment: return QColor(0x6a, 0x99, 0x55);
+    case Margin:  return QColor(0x90, 0x90, 0x90);
+    }
+    return Qt::black;
+}
+
+//*******************************************************************
+//                             PrintJob                         CTOR
+//*******************************************************************
+PrintJob::PrintJob(std::unique_ptr<QPagedPaintDevice> device, const QString& fileName, const QString& text, const Options& options, QObject* parent)
+    : QObject(parent)
+    , _device(std::move(device))
+    , _fileName(fileName)
+    , _text(text)
+    , _options(options)
+    , _cancelled(false)
+{
+    _pool.setMaxThreadCount(1);
+}
+
+/********************************************************************
+*                             ~PrintJob                        dtor *
+********************************************************************/
+PrintJob::~PrintJob() {
+    cancel();
+    _pool.waitForDone();
+}
+
+/********************************************************************
+*                               start                        public *
+*-------------------------------------------------------------------*
+* Runs the job in the background; 'finished' tells how it ended.    *
+* A cancelled PDF is removed, a printer is told to drop the job.    *
+********************************************************************/
+void PrintJob::start() {
+    QtConcurrent::run(&_pool, [this] {
+        int pages = 0;
+        const bool ok = run(pages);
+        if (!ok && !_fileName.isEmpty()) {
+            QFile::remove(_fileName);
+        }
+        QMetaObject::invokeMethod(this, [this, ok, pages] {
+            emit finished(ok, pages);
+        }, Qt::QueuedConnection);
+    });
+}
+
+/********************************************************************
+*                               cancel                       public *
+********************************************************************/
+void PrintJob::cancel() {
+    _cancelled = true;
+}
+
+/********************************************************************
+*                             lineCount                      public *
+********************************************************************/
+int PrintJob::lineCount() const {
+    return _text.count('\n') + 1;
+}
+
+/********************************************************************
+*                                run                        private *
+*-------------------------------------------------------------------*
+* Runs in the pool thread. Every line is laid out into cells when   *
+* it is reached, wrapped to the width of the page and drawn in runs *
+* of the same color. Pages outside the range asked for are counted  *
+* but not painted.                                                  *
+********************************************************************/
+bool PrintJob::run(int& pages) {
+    QPainter painter;
+    if (!painter.begin(_device.get())) {
+        qWarning() << "PrintJob: can't print" << _options.title;
+        return false;
+    }
+    QFont font = _options.font;
+    font.setPointSize(PointSize);
+    painter.setFont(font);
+
+    const QFontMetricsF metrics(painter.font(), _device.get());
+    const qreal lineHeight = metrics.lineSpacing();
+    const qreal charWidth = metrics.horizontalAdvance(' ');
+    const qreal ascent = metrics.ascent();
+    const qreal width = _device->width();
+    const int total = lineCount();
+    const int numberCells = QString::number(total).size() + 1;
+    const int columns = qMax(16, int(width / charWidth) - numberCells);
+    const int rowsPerPage = qMax(1, int(_device->height() / lineHeight) - HeaderRows);
+    const int fromPage = _options.fromPage;
+    const int toPage = _options.toPage;
+
+    int page = 0;
+    int row = rowsPerPage;
+    bool visible = false;
+    bool painted = false;
+    auto nextPage = [&] {
+        ++page;
+        row = 0;
+        visible = (fromPage == 0 || page >= fromPage) && (toPage == 0 || page <= toPage);
+        if (!visible) {
+            return true;
+        }
+        if (painted && !_device->newPage()) {
+            return false;
+        }
+        painted = true;
+        const QString number = QString("Page %1").arg(page);
+        painter.setPen(color(Margin));
+        painter.drawText(QPointF(0, ascent), _options.title);
+        painter.drawText(QPointF(width - metrics.horizontalAdvance(number), ascent), number);
+        painter.drawLine(QPointF(0, lineHeight * 1.25), QPointF(width, lineHeight * 1.25));
+        return true;
+    };
+
+    auto data = reinterpret_cast<const char16_t*>(_text.utf16());
+    uint8_t state = 0;
+    QString cells;
+    std::vector<uint8_t> kinds;
+    bool ok = true;
+    int line = 0;
+    for (int start = 0; start <= _text.size(); line++) {
+        if (_cancelled) {
+            ok = false;
+            break;
+        }
+        if (line && line % ProgressLines == 0) {
+            QMetaObject::invokeMethod(this, [this, line] {
+                emit progress(line);
+            }, Qt::QueuedConnection);
+        }
+        int end = _text.indexOf('\n', start);
+        if (end < 0) {
+            end = _text.size();
+        }
+        layoutLine(data + start, end - start, state, cells, kinds);
+        start = end + 1;
+
+        const int rows = qMax(1, (cells.size() + columns - 1) / columns);
+        for (int r = 0; r < rows && ok; r++) {
+            if (row == rowsPerPage) {
+                ok = nextPage();
+            }
+            if (!ok || (toPage && page > toPage)) {
+                break;
+            }
+            if (visible) {
+                const qreal baseline = (row + HeaderRows) * lineHeight + ascent;
+                if (r == 0) {
+                    const QString number = QString::number(line + 1);
+                    painter.setPen(color(Margin));
+                    painter.drawText(QPointF((numberCells - 1 - number.size()) * charWidth, baseline), number);
+                }
+                const int first = r * columns;
+                const int last = qMin(cells.size(), first + columns);
+                for (int i = first, j; i < last; i = j) {
+                    for (j = i + 1; j < last && kinds[size_t(j)] == kinds[size_t(i)]; j++) {}
+                    painter.setPen(color(kinds[size_t(i)]));
+                    painter.drawText(QPointF((numberCells + i - first) * charWidth, baseline), cells.mid(i, j - i));
+                }
+            }
+            ++row;
+        }
+        if (!ok || (toPage && page > toPage)) {
+            break;
+        }
+    }
+
+    if (!ok) {
+        if (auto const printer = dynamic_cast<QPrinter*>(_device.get())) {
+            printer->abort();
+        }
+    }
+    painter.end();
+    pages = page;
+    return ok;
+}
+
+/********************************************************************
+*                             layoutLine                    private *
+*-------------------------------------------------------------------*
+* Cells of the line (tabs expanded) and the kind of each. 'state'   *
+* is the lexer state at the start of the line, updated to the state *
+* at its end, so comments and raw strings spanning lines are known. *
+********************************************************************/
+void PrintJob::layoutLine(const char16_t* text, const int size, uint8_t& state, QString& cells, std::vector<uint8_t>& kinds) const {
+    using Lexer = GoLexer<char16_t>;
+    std::vector<uint8_t> units(size_t(size), Text);
+
+    if (_options.highlight) {
+        Lexer lexer(text, size, Lexer::State(state));
+        for (;;) {
+            const GoToken token = lexer.next();
+            if (token.kind == GoToken::End) {
+                break;
+            }
+            uint8_t kind = Text;
+            switch (token.kind) {
+            case GoToken::Keyword:
+                kind = Keyword;
+                break;
+            case GoToken::Number:
+            case GoToken::String:
+            case GoToken::RawString:
+            case GoToken::Rune:
+                kind = Literal;
+                break;
+            case GoToken::Comment:
+                kind = Comment;
+                break;
+            default:
+                continue;
+            }
+            const int end = qMin(size, token.begin + token.length);
+            std::fill(units.begin() + token.begin, units.begin() + end, kind);
+        }
+        state = lexer.state();
+    }
+
+    cells.clear();
+    kinds.clear();
+    for (int i = 0; i < size; i++) {
+        if (text[i] == u'\t') {
+            const int n = _options.tabWidth - cells.size() % _options.tabWidth;
+            cells.append(QString(n, ' '));
+            kinds.insert(kinds.end(), size_t(n), units[size_t(i)]);
+        } else if (text[i] != u'\r') {
+            cells.append(QChar(text[i]));
+            kinds.push_back(units[size_t(i)]);
+        }
+    }
+}
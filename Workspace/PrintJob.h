@@ -0,0 +1,90 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : PrintJob.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_PRINT_JOB_H
+#define GOEDIT_PRINT_JOB_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QObject>
+#include <QString>
+#include <QFont>
+#include <QThreadPool>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class QPagedPaintDevice;
+class QPainter;
+
+/********************************************************************
+*                             PrintJob                              *
+*-------------------------------------------------------------------*
+* Prints a text (a printer or a PDF file) in a background thread.   *
+* Pages are made directly from lines of the text, one line at a     *
+* time: tabs expanded, long lines wrapped, Go code colored by the   *
+* lexer carried from line to line. Nothing is laid out in advance,  *
+* so memory does not grow with the size of the text and the job     *
+* can be cancelled between any two lines.                           *
+********************************************************************/
+class PrintJob : public QObject {
+    Q_OBJECT
+public:
+    struct Options {
+        QString title;          // in the header of every page
+        QFont font;
+        int tabWidth;
+        bool highlight;         // color Go syntax
+        int fromPage;           // 1-based, 0: all pages
+        int toPage;
+    };
+private:
+    static constexpr int PointSize = 9;
+
+    const std::unique_ptr<QPagedPaintDevice> _device;
+    const QString _fileName;    // of a PDF, removed when cancelled
+    const QString _text;
+    const Options _options;
+    std::atomic<bool> _cancelled;
+    QThreadPool _pool;
+public:
+    PrintJob(std::unique_ptr<QPagedPaintDevice>, const QString&, const QString&, const Options&, QObject* = nullptr);
+    ~PrintJob() override;
+
+    void start();
+    void cancel();
+    int lineCount() const;
+
+private:
+    bool run(int&);
+    void layoutLine(const char16_t*, const int, uint8_t&, QString&, std::vector<uint8_t>&) const;
+
+signals:
+    void progress(int);
+    void finished(bool, int);
+};
+
+#endif // GOEDIT_PRINT_JOB_H
@@ -0,0 +1,186 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TextFile.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFile>
+#include <QSaveFile>
+#include <QTextCodec>
+#include <QDebug>
+#include "TextFile.h"
+#include "Shared/Trace.h"
+
+/********************************************************************
+*                               read                  public static *
+*-------------------------------------------------------------------*
+* Whole text of the file.                                           *
+********************************************************************/
+bool TextFile::read(const QString& path, QString& text, Format& format) {
+    TraceScope trace("read", "file");
+    QByteArray data;
+    if (!readAll(path, data)) {
+        return false;
+    }
+    decode(data, TextScan::scan(data.constData(), size_t(data.size())), text, format);
+    return true;
+}
+
+/********************************************************************
+*                             readLines               public static *
+*-------------------------------------------------------------------*
+* Text of the file split into lines (without line endings). For     *
+* UTF-8 the line index of the scan is used, every line is decoded   *
+* straight from the file bytes.                                     *
+********************************************************************/
+bool TextFile::readLines(const QString& path, std::vector<QString>& lines, Format& format) {
+    TraceScope trace("read lines", "file");
+    QByteArray data;
+    if (!readAll(path, data)) {
+        return false;
+    }
+    std::vector<size_t> starts;
+    const TextScan::Result scan = TextScan::scan(data.constData(), size_t(data.size()), &starts);
+    lines.clear();
+
+    if (!scan.utf8) {
+        QString text;
+        decode(data, scan, text, format);
+        for (const auto& line : text.splitRef('\n')) {
+            lines.push_back(line.toString());
+        }
+        return true;
+    }
+
+    format.encoding = (scan.bom == TextScan::Bom::Utf8) ? Encoding::Utf8Bom : Encoding::Utf8;
+    format.eol = (scan.crlf * 2 > scan.lf) ? Eol::Crlf : Eol::Lf;
+    starts.push_back(size_t(data.size()) + 1);
+    lines.reserve(starts.size());
+
+    const char* const bytes = data.constData();
+    size_t begin = TextScan::bomSize(scan.bom);
+    for (const size_t next : starts) {
+        size_t end = next - 1;      // at '\n' (or at the end of data)
+        if (end > begin && bytes[end - 1] == '\r') {
+            end--;
+        }
+        lines.push_back(QString::fromUtf8(bytes + begin, int(end - begin)));
+        begin = next;
+    }
+    return true;
+}
+
+/********************************************************************
+*                               write                 public static *
+********************************************************************/
+bool TextFile::write(const QString& path, const QString& text, const Format& format) {
+    TraceScope trace("write", "file");
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "TextFile: can't save" << path << file.errorString();
+        return false;
+    }
+    file.write(encode(text, format));
+    if (!file.commit()) {
+        qWarning() << "TextFile: can't save" << path << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+/********************************************************************
+*                               encode                public static *
+********************************************************************/
+QByteArray TextFile::encode(QString text, const Format& format) {
+    if (format.eol == Eol::Crlf) {
+        text.replace(QLatin1Char('\n'), QLatin1String("\r\n"));
+    }
+    switch (format.encoding) {
+    case Encoding::Utf8Bom:
+        return QByteArray("\xEF\xBB\xBF") + text.toUtf8();
+    case Encoding::Utf16Le:
+        return QByteArray("\xFF\xFE") + QTextCodec::codecForName("UTF-16LE")->fromUnicode(text);
+    case Encoding::Utf16Be:
+        return QByteArray("\xFE\xFF") + QTextCodec::codecForName("UTF-16BE")->fromUnicode(text);
+    case Encoding::Latin1:
+        return text.toLatin1();
+    default:
+        return text.toUtf8();
+    }
+}
+
+/********************************************************************
+*                               decode               private static *
+*-------------------------------------------------------------------*
+* Valid UTF-8 is decoded at once, other encodings go through their  *
+* codec. Line endings of the result are always '\n'.                *
+********************************************************************/
+void TextFile::decode(const QByteArray& data, const TextScan::Result& scan, QString& text, Format& format) {
+    const int skip = int(TextScan::bomSize(scan.bom));
+    format = Format{};
+
+    switch (scan.bom) {
+    case TextScan::Bom::Utf16Le:
+        format.encoding = Encoding::Utf16Le;
+        text = QTextCodec::codecForName("UTF-16LE")->toUnicode(data.constData() + skip, data.size() - skip);
+        break;
+    case TextScan::Bom::Utf16Be:
+        format.encoding = Encoding::Utf16Be;
+        text = QTextCodec::codecForName("UTF-16BE")->toUnicode(data.constData() + skip, data.size() - skip);
+        break;
+    default:
+        if (scan.utf8) {
+            format.encoding = (scan.bom == TextScan::Bom::Utf8) ? Encoding::Utf8Bom : Encoding::Utf8;
+            text = QString::fromUtf8(data.constData() + skip, data.size() - skip);
+        } else {
+            format.encoding = Encoding::Latin1;
+            text = QString::fromLatin1(data);
+        }
+    }
+
+    // UTF-16 is not scanned, its line endings are counted in the text.
+    size_t lf = scan.lf;
+    size_t crlf = scan.crlf;
+    if (format.encoding == Encoding::Utf16Le || format.encoding == Encoding::Utf16Be) {
+        lf = size_t(text.count('\n'));
+        crlf = size_t(text.count(QLatin1String("\r\n")));
+    }
+    if (crlf) {
+        text.replace(QLatin1String("\r\n"), QLatin1String("\n"));
+    }
+    format.eol = (crlf * 2 > lf) ? Eol::Crlf : Eol::Lf;
+}
+
+/********************************************************************
+*                              readAll               private static *
+********************************************************************/
+bool TextFile::readAll(const QString& path, QByteArray& data) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "TextFile: can't open" << path << file.errorString();
+        return false;
+    }
+    data = file.readAll();
+    return true;
+}
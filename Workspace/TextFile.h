@@ -0,0 +1,71 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : TextFile.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_TEXT_FILE_H
+#define GOEDIT_TEXT_FILE_H
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QString>
+#include <QByteArray>
+#include <vector>
+#include "Shared/TextScan.h"
+
+/********************************************************************
+*                             TextFile                              *
+*-------------------------------------------------------------------*
+* Reading and writing of edited files. The encoding and the line    *
+* ending used by most lines are detected while the file is loaded   *
+* (see TextScan) and written back, so opening and saving a file     *
+* touches only lines the user edited - unless line endings were     *
+* mixed: then every line is saved with the dominant one. Text in    *
+* memory always has '\n' line endings.                              *
+* Bytes which are neither UTF-8 nor UTF-16 are read as Latin-1, the *
+* only encoding that round-trips any sequence of bytes.             *
+********************************************************************/
+class TextFile {
+public:
+    enum class Encoding { Utf8, Utf8Bom, Utf16Le, Utf16Be, Latin1 };
+    enum class Eol { Lf, Crlf };
+
+    struct Format {
+        Encoding encoding = Encoding::Utf8;
+        Eol eol = Eol::Lf;
+    };
+
+    TextFile() = delete;
+    ~TextFile() = delete;
+    TextFile(const TextFile&) = delete;
+    TextFile(const TextFile&&) = delete;
+
+    static bool read(const QString&, QString&, Format&);
+    static bool readLines(const QString&, std::vector<QString>&, Format&);
+    static bool write(const QString&, const QString&, const Format&);
+    static QByteArray encode(QString, const Format&);
+private:
+    static void decode(const QByteArray&, const TextScan::Result&, QString&, Format&);
+    static bool readAll(const QString&, QByteArray&);
+};
+
+#endif // GOEDIT_TEXT_FILE_H
@@ -1,6 +1,556 @@
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Workspace.cpp
+ * DATE   : 19.10.2026
+ *******************************************************************/
+
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QFileInfo>
+#include <QFileDialog>
+#include <QMessageBox>
+#include <QTabBar>
+#include <QStyle>
+#include <QSet>
 #include "Workspace.h"
+#include "Editor.h"
+#include "ChangeBar.h"
+#include "Completer.h"
+#include "Formatter.h"
+#include "LongLineEditor.h"
+#include "TextFile.h"
+#include "Project/FileWatcher.h"
+#include "Shared/Settings.h"
 
-Workspace::Workspace(QWidget *parent) : QWidget(parent)
+//*******************************************************************
+//                             Workspace                        CTOR
+//*******************************************************************
+Workspace::Workspace(QWidget *parent)
+    : QTabWidget(parent)
+    , _completer(new Completer(this))
+    , _formatter(new Formatter(this))
+    , _restoring(false)
 {
+    setDocumentMode(true);
+    setTabsClosable(true);
+    setMovable(true);
+    connect(this, &QTabWidget::tabCloseRequested, this, &Workspace::closeTab);
+    connect(this, &QTabWidget::currentChanged, this, &Workspace::currentTabChanged);
+    connect(_formatter, &Formatter::formatted, this, &Workspace::formatted);
+}
+
+/********************************************************************
+*                               open                         public *
+*-------------------------------------------------------------------*
+* Activates the buffer with the file, opens it if needed.           *
+********************************************************************/
+Buffer* Workspace::open(const QString& fpath) {
+    const QString path = QFileInfo(fpath).absoluteFilePath();
+    if (const int idx = indexOf(path); idx != -1) {
+        setCurrentIndex(idx);
+        emit fileOpened(path);
+        return buffer(idx);
+    }
+
+    // Files with huge lines would freeze the text layout.
+    if (LongLineEditor::detect(path)) {
+        auto const view = new LongLineEditor;
+        if (!view->load(path)) {
+            delete view;
+            return nullptr;
+        }
+        addBuffer(view, QFileInfo(path).fileName());
+        emit fileOpened(path);
+        return view;
+    }
+
+    auto const editor = new Editor;
+    if (!editor->load(path)) {
+        delete editor;
+        return nullptr;
+    }
+    addBuffer(editor, QFileInfo(path).fileName());
+    emit documentOpened(path, editor->document());
+    emit fileOpened(path);
+    return editor;
+}
+
+/********************************************************************
+*                              create                        public *
+********************************************************************/
+Buffer* Workspace::create() {
+    auto const editor = new Editor;
+    addBuffer(editor, "Untitled");
+    return editor;
+}
+
+/********************************************************************
+*                          current/buffer(s)                 public *
+********************************************************************/
+Buffer* Workspace::current() const {
+    return buffer(currentIndex());
+}
+
+Buffer* Workspace::buffer(const int idx) const {
+    return dynamic_cast<Buffer*>(widget(idx));
+}
+
+QList<Buffer*> Workspace::buffers() const {
+    QList<Buffer*> result;
+    for (int i = 0; i < count(); i++) {
+        if (auto const buf = buffer(i); buf) {
+            result.append(buf);
+        }
+    }
+    return result;
+}
+
+/********************************************************************
+*                            save/saveAs                     public *
+********************************************************************/
+bool Workspace::save(Buffer* buf) {
+    if (!buf) return false;
+    if (buf->isUntitled()) {
+        return saveAs(buf);
+    }
+    const bool ok = buf->save();
+    updateTab(buf);
+    if (ok) {
+        emit saved(buf->path());
+        if (auto const editor = dynamic_cast<Editor*>(buf); editor && Settings::values().formatOnSave && buf->path().endsWith(".go")) {
+            _formatter->format(editor);
+        }
+    }
+    return ok;
+}
+
+bool Workspace::saveAs(Buffer* buf) {
+    if (!buf) return false;
+
+    const QString path = QFileDialog::getSaveFileName(this, "Save As", buf->path());
+    if (path.isEmpty()) {
+        return false;
+    }
+    const QString previous = buf->path();
+    const bool ok = buf->saveAs(path);
+    updateTab(buf);
+    if (ok) {
+        if (auto const editor = dynamic_cast<Editor*>(buf); editor && previous != buf->path()) {
+            if (!previous.isEmpty()) {
+                emit documentClosed(previous);
+            }
+            emit documentOpened(buf->path(), editor->document());
+        }
+        emit saved(buf->path());
+    }
+    return ok;
+}
+
+bool Workspace::saveAll() {
+    bool ok = true;
+    for (auto const buf : buffers()) {
+        if (buf->isModified()) {
+            ok = save(buf) && ok;
+        }
+    }
+    return ok;
+}
+
+/********************************************************************
+*                            filesChanged                    public *
+*-------------------------------------------------------------------*
+* External changes reported by the project watcher. Buffers of      *
+* changed files are marked stale, the current one is resolved at    *
+* once, others when the user switches to them.                      *
+********************************************************************/
+void Workspace::filesChanged(const FileChanges& changes) {
+    const QSet<QString> files(changes.files.cbegin(), changes.files.cend());
+
+    for (auto const buf : buffers()) {
+        if (buf->isUntitled() || buf->isStale()) {
+            continue;
+        }
+        // Deferred buffers read the file when they are shown anyway.
+        if (auto const editor = dynamic_cast<Editor*>(buf); editor && editor->isDeferred()) {
+            continue;
+        }
+        if (!changes.overflow && !files.contains(buf->path())) {
+            continue;
+        }
+        if (buf->changedOnDisk()) {
+            buf->setStale(true);
+            updateTab(buf);
+        }
+    }
+    resolveStale(current());
+}
+
+/********************************************************************
+*                              setBase                       public *
+*-------------------------------------------------------------------*
+* Version of the file at HEAD for the bar of changes of its editor. *
+********************************************************************/
+void Workspace::setBase(const QString& path, const QByteArray& text, const bool tracked) {
+    auto const editor = dynamic_cast<Editor*>(buffer(indexOf(path)));
+    if (!editor || editor->isDeferred()) {
+        return;
+    }
+    if (tracked) {
+        editor->changeBar()->setBase(text);
+    } else {
+        editor->changeBar()->clearBase();
+    }
+}
+
+/********************************************************************
+*                              setBlame                      public *
+********************************************************************/
+void Workspace::setBlame(const QString& path, const Blame& blame) {
+    if (auto const editor = dynamic_cast<Editor*>(buffer(indexOf(path))); editor) {
+        editor->changeBar()->setBlame(blame);
+    }
+}
+
+/********************************************************************
+*                            headChanged                     public *
+*-------------------------------------------------------------------*
+* HEAD of the repository moved (or the repository is gone): bases   *
+* of loaded documents are wanted again, blame is out of date.       *
+********************************************************************/
+void Workspace::headChanged() {
+    for (int i = 0; i < count(); i++) {
+        auto const editor = dynamic_cast<Editor*>(widget(i));
+        if (!editor || editor->isUntitled() || editor->isDeferred()) {
+            continue;
+        }
+        editor->changeBar()->clearBlame();
+        emit baseWanted(editor->path());
+    }
+}
+
+/********************************************************************
+*                  compareWithSaved/compareWithHead          public *
+*-------------------------------------------------------------------*
+* Text of the editor against the file on disk or its version at     *
+* HEAD of the git repository. False when there is nothing to diff.  *
+********************************************************************/
+bool Workspace::compareWithSaved(Buffer* buf) {
+    auto const editor = dynamic_cast<Editor*>(buf);
+    if (!editor || editor->isUntitled() || editor->isDeferred()) {
+        return false;
+    }
+    QString saved;
+    TextFile::Format format;
+    if (!TextFile::read(editor->path(), saved, format)) {
+        return false;
+    }
+    const QString name = QFileInfo(editor->path()).fileName();
+    showDiff({name + " (saved)", saved.toUtf8()}, {name, editor->toPlainText().toUtf8()});
+    return true;
+}
+
+bool Workspace::compareWithHead(Buffer* buf) {
+    auto const editor = dynamic_cast<Editor*>(buf);
+    if (!editor || editor->isUntitled() || !editor->changeBar()->hasBase()) {
+        return false;
+    }
+    const QString name = QFileInfo(editor->path()).fileName();
+    showDiff({name + " (HEAD)", editor->changeBar()->base()}, {name, editor->toPlainText().toUtf8()});
+    return true;
+}
+
+/********************************************************************
+*                           compareFiles                     public *
+*-------------------------------------------------------------------*
+* Any two files chosen by the user.                                 *
+********************************************************************/
+bool Workspace::compareFiles() {
+    const QString first = QFileDialog::getOpenFileName(this, "Compare");
+    if (first.isEmpty()) {
+        return false;
+    }
+    const QString second = QFileDialog::getOpenFileName(this, "Compare with", QFileInfo(first).absolutePath());
+    if (second.isEmpty()) {
+        return false;
+    }
+    QString left;
+    QString right;
+    TextFile::Format format;
+    if (!TextFile::read(first, left, format) || !TextFile::read(second, right, format)) {
+        return false;
+    }
+    showDiff({first, left.toUtf8()}, {second, right.toUtf8()});
+    return true;
+}
+
+/********************************************************************
+*                              snapshot                      public *
+*-------------------------------------------------------------------*
+* Documents of the session. Untitled buffers are not part of it.    *
+********************************************************************/
+void Workspace::snapshot(Session::Snapshot& session) const {
+    session.documents.clear();
+    session.current = -1;
+    for (int i = 0; i < count(); i++) {
+        auto const editor = dynamic_cast<Editor*>(widget(i));
+        if (!editor || editor->isUntitled()) {
+            continue;
+        }
+        if (i == currentIndex()) {
+            session.current = session.documents.size();
+        }
+        session.documents.append(editor->snapshot());
+    }
+}
+
+/********************************************************************
+*                              restore                       public *
+*-------------------------------------------------------------------*
+* Only the current document of the session is read now, others get  *
+* a tab and are loaded when the user switches to them. So restoring *
+* many documents costs about as much as opening one.                *
+********************************************************************/
+void Workspace::restore(const Session::Snapshot& session) {
+    int current = -1;
+    _restoring = true;
+    for (int i = 0; i < session.documents.size(); i++) {
+        const Session::Document& doc = session.documents[i];
+        if (const int idx = indexOf(doc.path); idx != -1) {
+            if (i == session.current) current = idx;
+            continue;
+        }
+        if (!QFileInfo::exists(doc.path)) {
+            continue;
+        }
+        auto const editor = new Editor;
+        editor->defer(doc);
+        addBuffer(editor, QFileInfo(doc.path).fileName(), false);
+        if (i == session.current) current = indexOf(editor);
+    }
+    _restoring = false;
+
+    if (current != -1) {
+        setCurrentIndex(current);
+    }
+    currentTabChanged(currentIndex());
+}
+
+/********************************************************************
+*                              indexOf                      private *
+********************************************************************/
+int Workspace::indexOf(const QString& path) const {
+    for (int i = 0; i < count(); i++) {
+        if (auto const buf = buffer(i); buf && buf->path() == path) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int Workspace::indexOf(Buffer* buf) const {
+    return buf ? QTabWidget::indexOf(buf->widget()) : -1;
+}
+
+/********************************************************************
+*                             addBuffer                     private *
+********************************************************************/
+void Workspace::addBuffer(Buffer* buf, const QString& title, const bool activate) {
+    const int idx = addTab(buf->widget(), title);
+    watchBuffer(buf);
+    updateTab(buf);
+    if (activate) {
+        setCurrentIndex(idx);
+    }
+}
+
+/********************************************************************
+*                           replaceBuffer                   private *
+*-------------------------------------------------------------------*
+* Puts another buffer into the tab, the old one is deleted.         *
+********************************************************************/
+void Workspace::replaceBuffer(const int idx, Buffer* buf) {
+    QWidget* const old = widget(idx);
+    const bool wasCurrent = (idx == currentIndex());
+
+    _restoring = true;
+    removeTab(idx);
+    insertTab(idx, buf->widget(), QString());
+    _restoring = false;
+    delete old;
+
+    watchBuffer(buf);
+    updateTab(buf);
+    if (wasCurrent) {
+        setCurrentIndex(idx);
+    }
+}
+
+/********************************************************************
+*                            watchBuffer                    private *
+********************************************************************/
+void Workspace::watchBuffer(Buffer* buf) {
+    if (auto const editor = dynamic_cast<Editor*>(buf); editor) {
+        connect(editor->document(), &QTextDocument::modificationChanged, this, [this, buf] {
+            updateTab(buf);
+        });
+        connect(editor->changeBar(), &ChangeBar::blameWanted, this, [this, editor] {
+            emit blameWanted(editor->path());
+        });
+    } else if (auto const view = dynamic_cast<LongLineEditor*>(buf); view) {
+        connect(view, &LongLineEditor::modificationChanged, this, [this, buf] {
+            updateTab(buf);
+        });
+    }
+}
+
+/********************************************************************
+*                              hydrate                      private *
+*-------------------------------------------------------------------*
+* Loads the deferred document of the tab. A tab whose file can't be *
+* read anymore is closed.                                           *
+********************************************************************/
+bool Workspace::hydrate(const int idx) {
+    auto const editor = dynamic_cast<Editor*>(widget(idx));
+    if (!editor || !editor->isDeferred()) {
+        return true;
+    }
+    if (LongLineEditor::detect(editor->path())) {
+        const Session::Document doc = editor->snapshot();
+        auto const view = new LongLineEditor;
+        if (view->load(doc.path)) {
+            replaceBuffer(idx, view);
+            view->gotoPosition(doc.line, doc.column);
+            return true;
+        }
+        delete view;
+    } else if (editor->hydrate()) {
+        updateTab(editor);
+        emit documentOpened(editor->path(), editor->document());
+        return true;
+    }
+    removeTab(idx);
+    delete editor;
+    return false;
+}
+
+/********************************************************************
+*                             updateTab                     private *
+********************************************************************/
+void Workspace::updateTab(Buffer* buf) {
+    const int idx = indexOf(buf);
+    if (idx == -1) return;
+
+    QString title = buf->isUntitled() ? QString("Untitled") : QFileInfo(buf->path()).fileName();
+    if (buf->isModified()) {
+        title += '*';
+    }
+    setTabText(idx, title);
+    setTabToolTip(idx, buf->isStale() ? buf->path() + "\n(changed on disk)" : buf->path());
+    setTabIcon(idx, buf->isStale() ? style()->standardIcon(QStyle::SP_MessageBoxWarning) : QIcon());
+}
+
+/********************************************************************
+*                            resolveStale                   private *
+*-------------------------------------------------------------------*
+* Unmodified buffer is reloaded silently. When the buffer has       *
+* unsaved changes, the user decides.                                *
+********************************************************************/
+void Workspace::resolveStale(Buffer* buf) {
+    if (!buf || !buf->isStale()) {
+        return;
+    }
+    buf->setStale(false);
+
+    if (!QFileInfo::exists(buf->path())) {
+        if (auto const editor = dynamic_cast<Editor*>(buf); editor) {
+            editor->document()->setModified(true);
+        }
+    } else if (!buf->isModified()) {
+        buf->load(buf->path());
+    } else {
+        const auto answer = QMessageBox::question(this, "File changed",
+            QString("The file %1 has been changed on disk.\n"
+                    "Reload it and lose your changes?").arg(buf->path()));
+        if (answer == QMessageBox::Yes) {
+            buf->load(buf->path());
+        }
+    }
+    updateTab(buf);
+}
+
+/********************************************************************
+*                              showDiff                     private *
+*-------------------------------------------------------------------*
+* Diff views are tabs without a Buffer: nothing to save or restore. *
+********************************************************************/
+void Workspace::showDiff(const DiffView::Side& left, const DiffView::Side& right) {
+    auto const view = new DiffView(left, right);
+    const int idx = addTab(view, "Diff: " + QFileInfo(right.title).fileName());
+    setTabToolTip(idx, left.title + '\n' + right.title);
+    setCurrentIndex(idx);
+    view->setFocus();
+}
+
+/********************************************************************
+*                              closeTab                     private *
+********************************************************************/
+void Workspace::closeTab(const int idx) {
+    auto const buf = buffer(idx);
+    if (buf && buf->isModified()) {
+        const auto answer = QMessageBox::question(this, "Close",
+            QString("Save changes in %1?").arg(tabText(idx)),
+            QMessageBox::Save | QMessageBox::Discard | QMessageBox::Cancel);
+        if (answer == QMessageBox::Cancel) return;
+        if (answer == QMessageBox::Save && !save(buf)) return;
+    }
+    QWidget* const w = widget(idx);
+    removeTab(idx);
+    delete w;
+}
+
+/********************************************************************
+*                             formatted                     private *
+*-------------------------------------------------------------------*
+* The formatter changed the saved text: it is written again, but    *
+* not formatted once more.                                          *
+********************************************************************/
+void Workspace::formatted(Editor* editor) {
+    if (indexOf(editor) < 0) {
+        return;
+    }
+    const bool ok = editor->save();
+    updateTab(editor);
+    if (ok) {
+        emit saved(editor->path());
+    }
+}
 
+/********************************************************************
+*                         currentTabChanged                 private *
+********************************************************************/
+void Workspace::currentTabChanged(const int idx) {
+    if (_restoring || !hydrate(idx)) {
+        return;
+    }
+    _completer->attach(dynamic_cast<Editor*>(widget(idx)));
+    resolveStale(buffer(idx));
 }
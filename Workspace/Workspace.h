@@ -1,16 +1,101 @@
-#ifndef WORKSPACE_H
-#define WORKSPACE_H
+/********************************************************************
+ * Copyright (C) 2020 Piotr Pszczolkowski
+ *-------------------------------------------------------------------
+ * This file is part of Goedit.
+ *
+ * Goedit is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Goedit is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Goedit; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *-------------------------------------------------------------------
+ * AUTHOR : Piotr Pszczolkowski (piotr@beesoft.pl)
+ * PROJECT: Goedit
+ * FILE   : Workspace.h
+ * DATE   : 19.10.2026
+ *******************************************************************/
+#ifndef GOEDIT_WORKSPACE_H
+#define GOEDIT_WORKSPACE_H
 
-#include <QWidget>
+/*------- include files:
+-------------------------------------------------------------------*/
+#include <QTabWidget>
+#include <QList>
+#include "Project/Session.h"
+#include "Workspace/DiffView.h"
 
-class Workspace : public QWidget
-{
+/*------- forward declarations:
+-------------------------------------------------------------------*/
+class Buffer;
+class Blame;
+class QTextDocument;
+class Completer;
+class Editor;
+class Formatter;
+struct FileChanges;
+
+/********************************************************************
+*                             Workspace                             *
+********************************************************************/
+class Workspace : public QTabWidget {
     Q_OBJECT
+
+    Completer* const _completer;
+    Formatter* const _formatter;
+    bool _restoring;
 public:
-    explicit Workspace(QWidget *parent = nullptr);
+    explicit Workspace(QWidget* = nullptr);
 
-signals:
+    Buffer* open(const QString&);
+    Buffer* create();
+    Buffer* current() const;
+    Completer* completer() const {
+        return _completer;
+    }
+    Buffer* buffer(const int) const;
+    QList<Buffer*> buffers() const;
+    bool save(Buffer*);
+    bool saveAs(Buffer*);
+    bool saveAll();
+    void filesChanged(const FileChanges&);
+    void setBase(const QString&, const QByteArray&, const bool);
+    void setBlame(const QString&, const Blame&);
+    void headChanged();
+    bool compareWithSaved(Buffer*);
+    bool compareWithHead(Buffer*);
+    bool compareFiles();
+    void snapshot(Session::Snapshot&) const;
+    void restore(const Session::Snapshot&);
 
+private:
+    int indexOf(const QString&) const;
+    int indexOf(Buffer*) const;
+    void addBuffer(Buffer*, const QString&, const bool = true);
+    void replaceBuffer(const int, Buffer*);
+    void watchBuffer(Buffer*);
+    bool hydrate(const int);
+    void updateTab(Buffer*);
+    void resolveStale(Buffer*);
+    void showDiff(const DiffView::Side&, const DiffView::Side&);
+    void closeTab(const int);
+    void formatted(Editor*);
+    void currentTabChanged(const int);
+
+signals:
+    void saved(const QString&);
+    void fileOpened(const QString&);
+    void documentOpened(const QString&, QTextDocument*);
+    void documentClosed(const QString&);
+    void baseWanted(const QString&);
+    void blameWanted(const QString&);
 };
 
-#endif // WORKSPACE_H
+#endif // GOEDIT_WORKSPACE_H
@@ -1,13 +1,29 @@
 #include "MainWindow.h"
+#include "Shared/StartupTimer.h"
+#include "Shared/Trace.h"
 #include <QApplication>
 
 int main(int argc, char *argv[]) {
+    StartupTimer::start();
+    // GOEDIT_TRACE=<file>: trace the whole run, written on exit.
+    const QByteArray tracePath = qgetenv("GOEDIT_TRACE");
+    Trace::setThreadName("main");
+    Trace::setEnabled(!tracePath.isEmpty());
+
     QCoreApplication::setOrganizationName("Beesoft Software");
     QCoreApplication::setOrganizationDomain("beesoft.pl");
     QCoreApplication::setApplicationName("Goedit");
 
     QApplication a(argc, argv);
+    StartupTimer::mark("application");
     MainWindow w;
+    StartupTimer::mark("main window");
     w.show();
-    return a.exec();
+    StartupTimer::mark("show");
+    const int code = a.exec();
+
+    if (!tracePath.isEmpty() && !Trace::write(tracePath.toStdString())) {
+        qWarning("Can't write the trace to %s", tracePath.constData());
+    }
+    return code;
 }